@@ -253,6 +253,38 @@ set(MPIX_IALLGATHER_CODE
      }")
 check_cxx_source_compiles("${MPIX_IALLGATHER_CODE}"
   EL_HAVE_MPIX_NONBLOCKING_COLLECTIVES)
+set(MPI_SHARED_MEMORY_CODE
+    "#include \"mpi.h\"
+     int main( int argc, char* argv[] )
+     {
+       MPI_Init( &argc, &argv );
+       MPI_Comm nodeComm;
+       MPI_Comm_split_type
+       ( MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &nodeComm );
+       double* baseptr;
+       MPI_Win win;
+       MPI_Win_allocate_shared
+       ( 5*sizeof(double), sizeof(double), MPI_INFO_NULL, nodeComm,
+         &baseptr, &win );
+       MPI_Finalize();
+       return 0;
+     }")
+check_cxx_source_compiles("${MPI_SHARED_MEMORY_CODE}"
+  EL_HAVE_MPI3_SHARED_MEMORY)
+set(MPI_COMM_CREATE_GROUP_CODE
+    "#include \"mpi.h\"
+     int main( int argc, char* argv[] )
+     {
+       MPI_Init( &argc, &argv );
+       MPI_Group group;
+       MPI_Comm_group( MPI_COMM_WORLD, &group );
+       MPI_Comm comm;
+       MPI_Comm_create_group( MPI_COMM_WORLD, group, 0, &comm );
+       MPI_Finalize();
+       return 0;
+     }")
+check_cxx_source_compiles("${MPI_COMM_CREATE_GROUP_CODE}"
+  EL_HAVE_MPI_COMM_CREATE_GROUP)
 set(MPI_INIT_THREAD_CODE
     "#include \"mpi.h\"
      int main( int argc, char* argv[] )
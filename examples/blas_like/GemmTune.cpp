@@ -0,0 +1,116 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Pre-populate a Gemm tuning file (see El::LoadGemmTuning) for a list of
+// shapes. Each line of the shapes file has the form
+//
+//   <orientations> <m> <n> <k> [datatype]
+//
+// e.g., "NT 4096 4096 512 float", where the datatype is one of float,
+// double, Complex<float>, and Complex<double> (the default is double).
+// Existing tunings in the output file are kept unless they are retuned.
+// Tunings are specific to the grid's shape and order, so --gridHeight and
+// --colMajor should match the runs which will load the file.
+
+template<typename T>
+void Tune
+( El::Orientation orientA, El::Orientation orientB,
+  El::Int m, El::Int n, El::Int k, const El::Grid& grid )
+{
+    El::Timer timer;
+    timer.Start();
+    const El::GemmTuning tuning =
+      El::TuneGemm<T>( orientA, orientB, m, n, k, grid );
+    const double tuneTime = timer.Stop();
+    El::OutputFromRoot
+    (grid.Comm(),El::OrientationToChar(orientA),
+     El::OrientationToChar(orientB)," ",m," x ",n," x ",k," (",
+     El::TypeName<T>(),"): ",El::GemmAlgorithmToString(tuning.alg),
+     " with a blocksize of ",tuning.blocksize," (tuned in ",tuneTime,
+     " seconds)");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    El::Environment env( argc, argv );
+    El::mpi::Comm comm = El::mpi::COMM_WORLD;
+
+    try
+    {
+        const std::string shapesFile =
+          El::Input("--shapes","file listing the shapes to tune",
+                    std::string("shapes.txt"));
+        const std::string tuningFile =
+          El::Input("--output","tuning file to update",
+                    std::string("gemm_tuning.txt"));
+        int gridHeight = El::Input("--gridHeight","process grid height",0);
+        const bool colMajor =
+          El::Input("--colMajor","column-major ordering?",true);
+        El::ProcessInput();
+        El::PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = El::Grid::DefaultHeight( El::mpi::Size(comm) );
+        const El::GridOrder order = colMajor ? El::COLUMN_MAJOR : El::ROW_MAJOR;
+        const El::Grid grid( comm, gridHeight, order );
+        El::LoadGemmTuning( tuningFile, comm );
+
+        // Every process parses the same list of shapes
+        std::string contents;
+        if( El::mpi::Rank(comm) == 0 )
+        {
+            std::ifstream file( shapesFile );
+            if( !file.is_open() )
+                El::RuntimeError("Could not open ",shapesFile);
+            std::stringstream stream;
+            stream << file.rdbuf();
+            contents = stream.str();
+        }
+        int size = contents.size();
+        El::mpi::Broadcast( size, 0, comm );
+        contents.resize( size );
+        if( size > 0 )
+            El::mpi::Broadcast
+            ( reinterpret_cast<El::byte*>(&contents[0]), size, 0, comm );
+
+        std::istringstream is( contents );
+        std::string line;
+        while( std::getline( is, line ) )
+        {
+            std::istringstream lineStream( line );
+            std::string orient, type="double";
+            El::Int m, n, k;
+            if( !(lineStream >> orient >> m >> n >> k) )
+                continue;
+            lineStream >> type;
+            if( orient.size() != 2 )
+                El::LogicError("Invalid orientations ",orient);
+            const El::Orientation orientA = El::CharToOrientation(orient[0]);
+            const El::Orientation orientB = El::CharToOrientation(orient[1]);
+            if( type == "float" )
+                Tune<float>( orientA, orientB, m, n, k, grid );
+            else if( type == "double" )
+                Tune<double>( orientA, orientB, m, n, k, grid );
+            else if( type == "Complex<float>" )
+                Tune<El::Complex<float>>( orientA, orientB, m, n, k, grid );
+            else if( type == "Complex<double>" )
+                Tune<El::Complex<double>>( orientA, orientB, m, n, k, grid );
+            else
+                El::LogicError("Unsupported datatype ",type);
+        }
+        El::SaveGemmTuning( tuningFile, comm );
+        El::OutputFromRoot
+        (comm,"Wrote ",El::NumGemmTunings()," tunings to ",tuningFile);
+    }
+    catch( std::exception& e ) { El::ReportException(e); }
+
+    return 0;
+}
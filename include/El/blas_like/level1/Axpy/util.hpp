@@ -9,6 +9,8 @@
 #ifndef EL_BLAS_AXPY_UTIL_HPP
 #define EL_BLAS_AXPY_UTIL_HPP
 
+#include "../Copy/kernels.hpp"
+
 #ifdef HYDROGEN_HAVE_CUDA
 #include "../GPU/Axpy.hpp"
 #endif
@@ -32,12 +34,11 @@ struct Impl<T,Device::CPU>
         T const* A, Int colStrideA, Int rowStrideA,
         T* B, Int colStrideB, Int rowStrideB )
     {
-        // TODO: Add OpenMP parallelization and/or optimize
-        for( Int j=0; j<width; ++j )
-            blas::Axpy
-                ( height, alpha,
-                  &A[rowStrideA*j], colStrideA,
-                  &B[rowStrideB*j], colStrideB );
+        copy::util::cpu::UpdateStridedBlocks<T>
+            ( alpha,
+              {{height, width,
+                A, colStrideA, rowStrideA,
+                B, colStrideB, rowStrideB}} );
     }
 };// struct Impl<T,Device::CPU>
 
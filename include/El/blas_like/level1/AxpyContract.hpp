@@ -186,7 +186,8 @@ void ColScatter
           buffer.data(),    recvSize );
 
         // Communicate
-        mpi::ReduceScatter( buffer.data(), recvSize, B.ColComm() );
+        mpi::ReduceScatter<D>
+        ( buffer.data(), recvSize, mpi::SUM, B.ColComm(), B.Grid() );
 
         // Update with our received data
         axpy::util::InterleaveMatrixUpdate<T,D>
@@ -220,7 +221,8 @@ void ColScatter
           secondBuf,        recvSize_RS );
 
         // Reduce-scatter over each col
-        mpi::ReduceScatter( secondBuf, firstBuf, recvSize_RS, B.ColComm() );
+        mpi::ReduceScatter<D>
+        ( secondBuf, firstBuf, recvSize_RS, mpi::SUM, B.ColComm(), B.Grid() );
 
         // Trade reduced data with the appropriate col
         const Int sendCol = Mod( B.RowRank()+rowDiff, B.RowStride() );
@@ -296,7 +298,8 @@ void RowScatter
               buffer.data(), portionSize );
 
             // Communicate
-            mpi::ReduceScatter( buffer.data(), portionSize, B.RowComm() );
+            mpi::ReduceScatter<D>
+            ( buffer.data(), portionSize, mpi::SUM, B.RowComm(), B.Grid() );
 
             // Update with our received data
             axpy::util::InterleaveMatrixUpdate<T,D>
@@ -370,7 +373,9 @@ void RowScatter
               secondBuf,        recvSize_RS );
 
             // Reduce-scatter over each process row
-            mpi::ReduceScatter( secondBuf, firstBuf, recvSize_RS, B.RowComm() );
+            mpi::ReduceScatter<D>
+            ( secondBuf, firstBuf, recvSize_RS, mpi::SUM,
+              B.RowComm(), B.Grid() );
 
             // Trade reduced data with the appropriate process row
             mpi::SendRecv
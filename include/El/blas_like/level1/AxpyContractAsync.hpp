@@ -0,0 +1,227 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_AXPYCONTRACTASYNC_HPP
+#define EL_BLAS_AXPYCONTRACTASYNC_HPP
+
+namespace El {
+
+template<typename T>
+ContractHandle<T>::ContractHandle( ContractHandle<T>&& handle )
+{ *this = std::move(handle); }
+
+template<typename T>
+ContractHandle<T>& ContractHandle<T>::operator=( ContractHandle<T>&& handle )
+{
+    if( this != &handle )
+    {
+        Wait();
+        pending_ = handle.pending_;
+        sendBuf_ = std::move(handle.sendBuf_);
+        recvBuf_ = std::move(handle.recvBuf_);
+        request_ = std::move(handle.request_);
+        update_ = std::move(handle.update_);
+        handle.pending_ = false;
+    }
+    return *this;
+}
+
+template<typename T>
+ContractHandle<T>::~ContractHandle()
+{
+    if( pending_ && !mpi::Finalized() )
+        Wait();
+}
+
+template<typename T>
+void ContractHandle<T>::Start
+( mpi::Comm comm, Int portionSize,
+  vector<T>&& sendBuf, std::function<void(const T*)> update )
+{
+    EL_DEBUG_CSE
+    Wait();
+    sendBuf_ = std::move(sendBuf);
+    recvBuf_.resize( portionSize );
+    update_ = std::move(update);
+    mpi::IReduceScatter
+    ( sendBuf_.data(), recvBuf_.data(), portionSize, mpi::SUM, comm,
+      request_ );
+    pending_ = true;
+    Test();
+}
+
+template<typename T>
+bool ContractHandle<T>::Test()
+{
+    EL_DEBUG_CSE
+    if( !pending_ )
+        return true;
+    if( !mpi::Test( request_ ) )
+        return false;
+    Finish();
+    return true;
+}
+
+template<typename T>
+void ContractHandle<T>::Wait()
+{
+    EL_DEBUG_CSE
+    if( pending_ )
+        Finish();
+}
+
+template<typename T>
+void ContractHandle<T>::Finish()
+{
+    EL_DEBUG_CSE
+    // Completes the request (and unpacks the result for types which are
+    // reduced in serialized form)
+    mpi::Wait( request_ );
+    pending_ = false;
+    update_( recvBuf_.data() );
+    SwapClear( sendBuf_ );
+    SwapClear( recvBuf_ );
+    update_ = nullptr;
+}
+
+namespace axpy_contract {
+namespace async {
+
+// (U,Collect(V)) -> (U,V)
+template<typename T>
+void RowScatter
+( T alpha, const ElementalMatrix<T>& A, ElementalMatrix<T>& B,
+  ContractHandle<T>& handle )
+{
+    EL_DEBUG_CSE
+    const Int width = B.Width();
+    const Int rowStride = B.RowStride();
+    const Int localHeight = B.LocalHeight();
+    const Int localWidth = B.LocalWidth();
+    const Int portionSize =
+      mpi::Pad( localHeight*MaxLength(width,rowStride) );
+
+    // The padding is zeroed to avoid floating-point exceptions in its
+    // reduction
+    vector<T> sendBuf( rowStride*portionSize, T(0) );
+    copy::util::RowStridedPack<T,Device::CPU>
+    ( localHeight, width,
+      B.RowAlign(), rowStride,
+      A.LockedBuffer(), A.LDim(),
+      sendBuf.data(),   portionSize );
+
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    handle.Start
+    ( B.RowComm(), portionSize, std::move(sendBuf),
+      [=]( const T* recvBuf )
+      {
+          axpy::util::InterleaveMatrixUpdate<T,Device::CPU>
+          ( alpha, localHeight, localWidth,
+            recvBuf, 1, localHeight,
+            BBuf,    1, BLDim );
+      } );
+}
+
+// (Collect(U),V) -> (U,V)
+template<typename T>
+void ColScatter
+( T alpha, const ElementalMatrix<T>& A, ElementalMatrix<T>& B,
+  ContractHandle<T>& handle )
+{
+    EL_DEBUG_CSE
+    const Int height = B.Height();
+    const Int colStride = B.ColStride();
+    const Int localHeight = B.LocalHeight();
+    const Int localWidth = B.LocalWidth();
+    const Int portionSize =
+      mpi::Pad( MaxLength(height,colStride)*localWidth );
+
+    vector<T> sendBuf( colStride*portionSize, T(0) );
+    copy::util::ColStridedPack<T,Device::CPU>
+    ( height, localWidth,
+      B.ColAlign(), colStride,
+      A.LockedBuffer(), A.LDim(),
+      sendBuf.data(),   portionSize );
+
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    handle.Start
+    ( B.ColComm(), portionSize, std::move(sendBuf),
+      [=]( const T* recvBuf )
+      {
+          axpy::util::InterleaveMatrixUpdate<T,Device::CPU>
+          ( alpha, localHeight, localWidth,
+            recvBuf, 1, localHeight,
+            BBuf,    1, BLDim );
+      } );
+}
+
+} // namespace async
+} // namespace axpy_contract
+
+template<typename T>
+ContractHandle<T> AxpyContractAsync
+( T alpha, const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    AssertSameGrids( A, B );
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError("A and B must be the same size");
+    ContractHandle<T> handle;
+    const Dist U = B.ColDist(), V = B.RowDist();
+    const bool onCPU = A.GetLocalDevice() == Device::CPU &&
+                       B.GetLocalDevice() == Device::CPU;
+    bool started = false;
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    if( onCPU && B.Participating() && A.CrossComm() == mpi::COMM_SELF )
+    {
+        if( V != STAR && A.ColDist() == U && A.RowDist() == Collect(V) &&
+            A.ColAlign() == B.ColAlign() )
+        {
+            axpy_contract::async::RowScatter( alpha, A, B, handle );
+            started = true;
+        }
+        else if( U != STAR && A.ColDist() == Collect(U) && A.RowDist() == V &&
+                 A.RowAlign() == B.RowAlign() )
+        {
+            axpy_contract::async::ColScatter( alpha, A, B, handle );
+            started = true;
+        }
+    }
+#else
+    (void)onCPU;
+#endif
+    if( !started )
+        AxpyContract( alpha, A, B );
+    return handle;
+}
+
+#ifdef EL_INSTANTIATE_BLAS_LEVEL1
+# define EL_EXTERN
+#else
+# define EL_EXTERN extern
+#endif
+
+#define PROTO(T) \
+  EL_EXTERN template class ContractHandle<T>; \
+  EL_EXTERN template ContractHandle<T> AxpyContractAsync \
+  ( T alpha, const ElementalMatrix<T>& A, ElementalMatrix<T>& B );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+#undef EL_EXTERN
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_AXPYCONTRACTASYNC_HPP
@@ -12,6 +12,75 @@
 namespace El {
 namespace copy {
 
+// Gather any distribution into a node-shared [* ,* ] matrix. Only the first
+// redundant copy of each portion is sent and only the node leaders receive,
+// each unpacking into the single copy read by the rest of its node.
+template<typename T,Dist U,Dist V,Device D>
+void NodeSharedAllGather
+( DistMatrix<T,U,V,ELEMENT,D> const& A,
+  DistMatrix<T,STAR,STAR,ELEMENT,D>& B )
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::NodeSharedAllGather")
+    AssertSameGrids( A, B );
+
+    const Grid& g = A.Grid();
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.SetGrid( g );
+    B.Resize( height, width );
+    if( !g.InGrid() )
+        return;
+
+    const Int colStride = A.ColStride();
+    const Int rowStride = A.RowStride();
+    const Int distStride = colStride*rowStride;
+    const Int maxLocalHeight = MaxLength(height,colStride);
+    const Int maxLocalWidth = MaxLength(width,rowStride);
+    const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
+
+    // Every process announces which portion (if any) it contributes
+    const int ownPortion =
+      ( A.Participating() && A.RedundantRank() == 0 ?
+        A.ColRank()+A.RowRank()*colStride : -1 );
+    const int commSize = g.Size();
+    if( portionSize != 0 &&
+        distStride > std::numeric_limits<Int>::max()/portionSize )
+        LogicError("The gathered portions overflow an Int");
+    vector<int> portions( commSize );
+    vector<Int> rcs( commSize ), rds( commSize );
+    mpi::AllGather( &ownPortion, 1, portions.data(), 1, g.VCComm() );
+    for( int q=0; q<commSize; ++q )
+    {
+        rcs[q] = ( portions[q] >= 0 ? portionSize : 0 );
+        rds[q] = Max(portions[q],0)*portionSize;
+    }
+
+    const bool leader = B.NodeLeader();
+    simple_buffer<T,D> sendBuf( ownPortion >= 0 ? portionSize : 0 );
+    simple_buffer<T,D> recvBuf( leader ? distStride*portionSize : 0 );
+    if( ownPortion >= 0 )
+        util::InterleaveMatrix<T,D>
+        ( A.LocalHeight(), A.LocalWidth(),
+          A.LockedBuffer(), 1, A.LDim(),
+          sendBuf.data(),   1, A.LocalHeight() );
+
+    // The hierarchy orders the processes as the VC communicator does
+    mpi::LeaderAllGather
+    ( sendBuf.data(), rcs[g.VCRank()],
+      leader ? recvBuf.data() : nullptr, rcs.data(), rds.data(),
+      g.Nodes() );
+
+    if( leader )
+        util::StridedUnpack<T,D>
+        ( height, width,
+          A.ColAlign(), colStride,
+          A.RowAlign(), rowStride,
+          recvBuf.data(), portionSize,
+          B.Buffer(), B.LDim() );
+    B.NodeBarrier();
+}
+
 // FIXME (trb 04/03/2018): This would not be hard to extend to
 // inter-device AllGather
 template<typename T,Dist U,Dist V,Device D>
@@ -20,11 +89,18 @@ void AllGather
   DistMatrix<T,Collect<U>(),Collect<V>(),ELEMENT,D>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::AllGather")
     AssertSameGrids( A, B );
+    if( B.NodeShared() )
+    {
+        NodeSharedAllGather( A, B );
+        return;
+    }
 
+    const Grid& g = A.Grid();
     const Int height = A.Height();
     const Int width = A.Width();
-    B.SetGrid( A.Grid() );
+    B.SetGrid( g );
     B.Resize( height, width );
 
     if( A.Participating() )
@@ -58,8 +134,8 @@ void AllGather
               sendBuf,          1, A.LocalHeight() );
 
             // Communicate
-            mpi::AllGather
-            ( sendBuf, portionSize, recvBuf, portionSize, A.DistComm() );
+            mpi::AllGather<D>
+            ( sendBuf, portionSize, recvBuf, portionSize, A.DistComm(), g );
 
             // Unpack
             util::StridedUnpack<T,D>// D2
@@ -80,6 +156,7 @@ void AllGather
         DistMatrix<T,Collect<U>(),Collect<V>(),BLOCK>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::AllGather")
     AssertSameGrids( A, B );
     // TODO(poulson): More efficient implementation
     GeneralPurpose( A, B );
@@ -68,8 +68,9 @@ void ColAllGather_impl( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                   sendBuf,          1, A.LocalHeight() );
 
                 // Communicate
-                mpi::AllGather
-                ( sendBuf, portionSize, recvBuf, portionSize, A.ColComm() );
+                mpi::AllGather<D>
+                ( sendBuf, portionSize, recvBuf, portionSize,
+                  A.ColComm(), A.Grid() );
 
                 // Unpack
                 util::ColStridedUnpack<T,D>
@@ -119,8 +120,9 @@ void ColAllGather_impl( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 }
 
                 // Communicate
-                mpi::Broadcast
-                ( bcastBuf, localWidthB, A.ColAlign(), A.ColComm() );
+                mpi::Broadcast<D>
+                ( bcastBuf, localWidthB, A.ColAlign(), A.ColComm(),
+                  A.Grid() );
 
                 // Unpack
                 if (D != Device::CPU)
@@ -152,9 +154,9 @@ void ColAllGather_impl( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                   firstBuf,  portionSize, recvRowRank, A.RowComm() );
 
                 // AllGather the aligned data
-                mpi::AllGather
+                mpi::AllGather<D>
                 ( firstBuf,  portionSize,
-                  secondBuf, portionSize, A.ColComm() );
+                  secondBuf, portionSize, A.ColComm(), A.Grid() );
 
                 // Unpack the contents of each member of the column team
                 util::ColStridedUnpack<T,D>
@@ -176,6 +178,7 @@ void ColAllGather
 ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColAllGather")
     if (A.GetLocalDevice() != B.GetLocalDevice())
         LogicError(
             "ColAllGather: For now, A and B must be on same device.");
@@ -200,6 +203,7 @@ void ColAllGather
 ( const BlockMatrix<T>& A, BlockMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColAllGather")
     AssertSameGrids( A, B );
 
     EL_DEBUG_ONLY(
@@ -265,7 +269,8 @@ void ColAllGather
 
                 // Communicate
                 mpi::AllGather
-                ( sendBuf, portionSize, recvBuf, portionSize, A.ColComm() );
+                ( sendBuf, portionSize, recvBuf, portionSize,
+                  A.ColComm(), A.Grid() );
 
                 // Unpack
                 util::BlockedColStridedUnpack
@@ -323,7 +328,7 @@ void ColAllGather
                 // Perform the column AllGather
                 mpi::AllGather
                 ( firstBuf,  portionSize,
-                  secondBuf, portionSize, A.ColComm() );
+                  secondBuf, portionSize, A.ColComm(), A.Grid() );
 
                 // Unpack
                 util::BlockedColStridedUnpack
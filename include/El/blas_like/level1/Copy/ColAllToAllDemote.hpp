@@ -18,6 +18,7 @@ void ColAllToAllDemote
   DistMatrix<T,        U,                     V   ,ELEMENT,D>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColAllToAllDemote")
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -125,6 +126,7 @@ void ColAllToAllDemote
         DistMatrix<T,        U,                     V   ,BLOCK>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColAllToAllDemote")
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
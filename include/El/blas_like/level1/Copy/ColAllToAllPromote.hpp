@@ -19,6 +19,7 @@ void ColAllToAllPromote
   DistMatrix<T,Partial<U>(),PartialUnionRow<U,V>(),ELEMENT,D>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColAllToAllPromote")
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -120,6 +121,7 @@ void ColAllToAllPromote
         DistMatrix<T,Partial<U>(),PartialUnionRow<U,V>(),BLOCK>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColAllToAllPromote")
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
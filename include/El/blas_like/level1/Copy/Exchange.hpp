@@ -19,6 +19,7 @@ void Exchange_impl
   int sendRank, int recvRank, mpi::Comm comm )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::Exchange")
     EL_DEBUG_ONLY(AssertSameGrids( A, B ))
 
 
@@ -18,6 +18,7 @@ void Gather
   DistMatrix<T,CIRC,CIRC,ELEMENT,D>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::Gather")
     AssertSameGrids(A, B);
 
     if (A.GetLocalDevice() != D)
@@ -51,12 +52,12 @@ void Gather
     // Gather the payload data
     // =======================
     const bool irrelevant = (A.RedundantRank()!=0 || A.CrossRank()!=A.Root());
-    int totalSend = (irrelevant ? 0 : A.LocalHeight()*A.LocalWidth());
-    vector<int> recvCounts, recvOffsets;
+    Int totalSend = (irrelevant ? 0 : A.LocalHeight()*A.LocalWidth());
+    vector<Int> recvCounts, recvOffsets;
     if(B.CrossRank() == B.Root())
         recvCounts.resize(crossSize);
     mpi::Gather(&totalSend, 1, recvCounts.data(), 1, B.Root(), B.CrossComm());
-    int totalRecv = Scan(recvCounts, recvOffsets);
+    Int totalRecv = Scan(recvCounts, recvOffsets);
 
     simple_buffer<T,D> sendBuf(totalSend), recvBuf(totalRecv);
     if(!irrelevant)
@@ -97,6 +98,7 @@ void Gather
         DistMatrix<T,CIRC,CIRC,BLOCK>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::Gather")
     AssertSameGrids(A, B);
     if(A.DistSize() == 1 && A.CrossSize() == 1)
     {
@@ -125,12 +127,12 @@ void Gather
     // Gather the payload data
     // =======================
     const bool irrelevant = (A.RedundantRank()!=0 || A.CrossRank()!=A.Root());
-    int totalSend = (irrelevant ? 0 : A.LocalHeight()*A.LocalWidth());
-    vector<int> recvCounts, recvOffsets;
+    Int totalSend = (irrelevant ? 0 : A.LocalHeight()*A.LocalWidth());
+    vector<Int> recvCounts, recvOffsets;
     if(B.CrossRank() == B.Root())
         recvCounts.resize(crossSize);
     mpi::Gather(&totalSend, 1, recvCounts.data(), 1, B.Root(), B.CrossComm());
-    int totalRecv = Scan(recvCounts, recvOffsets);
+    Int totalRecv = Scan(recvCounts, recvOffsets);
     vector<T> sendBuf, recvBuf;
     FastResize(sendBuf, totalSend);
     FastResize(recvBuf, totalRecv);
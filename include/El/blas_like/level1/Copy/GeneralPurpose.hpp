@@ -14,168 +14,393 @@ namespace El
 namespace copy
 {
 
-template<typename S,typename T,typename=EnableIf<CanCast<S,T>>>
-void Helper
+// Compute the type-independent metadata for redistributing A into B (which
+// must already have been resized)
+template<typename S,typename T>
+RedistributionPlan BuildRedistributionPlan
 (const AbstractDistMatrix<S>& A,
-        AbstractDistMatrix<T>& B)
+ const AbstractDistMatrix<T>& B)
 {
     EL_DEBUG_CSE
-
-    // TODO: Decide whether S or T should be used as the transmission type
-    //       based upon which is smaller. Transmit S by default.
-    const Int height = A.Height();
-    const Int width = A.Width();
     const Grid& g = B.Grid();
-    B.Resize(height, width);
-    Zero(B);
     const bool BPartic = B.Participating();
     const int BRoot = B.Root();
+    const int colStride = B.ColStride();
+    const int rowStride = B.RowStride();
 
-    const bool includeViewers = (A.Grid() != B.Grid());
+    RedistributionPlan plan;
+    plan.includeViewers = (A.Grid() != B.Grid());
+    plan.copyLocally = (BPartic && B.RedundantSize() == 1);
+    if (!plan.includeViewers && !g.InGrid())
+        return plan;
 
-    const Int localHeight = A.LocalHeight();
-    const Int localWidth = A.LocalWidth();
-
-    // TODO: Break into smaller pieces to avoid excessive memory usage?
-    vector<Entry<S>> remoteEntries;
-    vector<int> distOwners;
+    // For each local row and column of A, find its owner and local index in B
+    // (only the first redundant copy of A takes part in the exchange)
+    plan.ownerRowCounts.resize(colStride,0);
     if (A.RedundantRank() == 0)
     {
-        const bool noRedundant = B.RedundantSize() == 1;
-        const int colStride = B.ColStride();
-        const int rowRank = B.RowRank();
-        const int colRank = B.ColRank();
-
-        vector<Int> globalRows(localHeight), localRows(localHeight);
-        vector<int> ownerRows(localHeight);
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        plan.ownerRows.resize(localHeight);
+        plan.targetRows.resize(localHeight);
         for(Int iLoc=0; iLoc<localHeight; ++iLoc)
         {
             const Int i = A.GlobalRow(iLoc);
             const int ownerRow = B.RowOwner(i);
-            globalRows[iLoc] = i;
-            ownerRows[iLoc] = ownerRow;
-            localRows[iLoc] = B.LocalRow(i,ownerRow);
+            plan.ownerRows[iLoc] = ownerRow;
+            plan.targetRows[iLoc] = B.LocalRow(i,ownerRow);
+            ++plan.ownerRowCounts[ownerRow];
         }
-
-        remoteEntries.reserve(localHeight*localWidth);
-        distOwners.reserve(localHeight*localWidth);
+        plan.ownerCols.resize(localWidth);
+        plan.targetCols.resize(localWidth);
         for(Int jLoc=0; jLoc<localWidth; ++jLoc)
         {
             const Int j = A.GlobalCol(jLoc);
             const int ownerCol = B.ColOwner(j);
-            const Int localCol = B.LocalCol(j,ownerCol);
-            const bool isLocalCol = (BPartic && ownerCol == rowRank);
-            for(Int iLoc=0; iLoc<localHeight; ++iLoc)
-            {
-                const int ownerRow = ownerRows[iLoc];
-                const Int localRow = localRows[iLoc];
-                const bool isLocalRow = (BPartic && ownerRow == colRank);
-                const S& alpha = A.GetLocal(iLoc,jLoc);
-                if (noRedundant && isLocalRow && isLocalCol)
-                {
-                    B.SetLocal(localRow,localCol,Caster<S,T>::Cast(alpha));
-                }
-                else
-                {
-                    remoteEntries.push_back
-                    (Entry<S>{localRow,localCol,alpha});
-                    distOwners.push_back(ownerRow + colStride*ownerCol);
-                }
-            }
+            plan.ownerCols[jLoc] = ownerCol;
+            plan.targetCols[jLoc] = B.LocalCol(j,ownerCol);
         }
     }
 
     // We will first push to redundant rank 0 of B
     const int redundantRootB = 0;
-
-    // Compute the metadata
-    // ====================
-    const Int totalSend = remoteEntries.size();
-    mpi::Comm comm;
-    vector<int> sendCounts, owners(totalSend);
-    if (includeViewers)
+    const int distBSize = mpi::Size(B.DistComm());
+    plan.distToComm.resize(distBSize);
+    for(int distBRank=0; distBRank<distBSize; ++distBRank)
     {
-        comm = g.ViewingComm();
-        const int viewingSize = mpi::Size(g.ViewingComm());
-        const int distBSize = mpi::Size(B.DistComm());
+        const int vcOwner =
+          g.CoordsToVC
+          (B.ColDist(),B.RowDist(),distBRank,BRoot,redundantRootB);
+        plan.distToComm[distBRank] =
+          (plan.includeViewers ? g.VCToViewing(vcOwner) : vcOwner);
+    }
 
-        vector<int> distBToViewing(distBSize);
-        for(int distBRank=0; distBRank<distBSize; ++distBRank)
+    if (plan.includeViewers)
+    {
+        // The entries will be sent along with their indices, so we only need
+        // the send counts, which follow from the row and column histograms
+        const int commSize = mpi::Size(g.ViewingComm());
+        vector<Int> ownerColCounts(rowStride,0);
+        for(const int ownerCol : plan.ownerCols)
+            ++ownerColCounts[ownerCol];
+        plan.sendCounts.resize(commSize,0);
+        for(int ownerCol=0; ownerCol<rowStride; ++ownerCol)
         {
-            const int vcOwner =
-              g.CoordsToVC
-              (B.ColDist(),B.RowDist(),distBRank,BRoot,redundantRootB);
-            distBToViewing[distBRank] = g.VCToViewing(vcOwner);
+            for(int ownerRow=0; ownerRow<colStride; ++ownerRow)
+            {
+                if (plan.copyLocally &&
+                    ownerRow == B.ColRank() && ownerCol == B.RowRank())
+                    continue;
+                const int owner =
+                  plan.distToComm[ownerRow+colStride*ownerCol];
+                plan.sendCounts[owner] +=
+                  plan.ownerRowCounts[ownerRow]*ownerColCounts[ownerCol];
+            }
         }
-
-        sendCounts.resize(viewingSize,0);
-        for(Int k=0; k<totalSend; ++k)
+        plan.totalSend = Scan(plan.sendCounts, plan.sendOffs);
+    }
+    else
+    {
+        // The first redundant copy of B determines which process sends it
+        // each of its local entries
+        const int colStrideA = A.ColStride();
+        const int rowStrideA = A.RowStride();
+        plan.sourceOwnerRowCounts.resize(colStrideA,0);
+        if (BPartic && B.RedundantRank() == redundantRootB)
         {
-            owners[k] = distBToViewing[distOwners[k]];
-            ++sendCounts[owners[k]];
+            const Int localHeightB = B.LocalHeight();
+            const Int localWidthB = B.LocalWidth();
+            plan.sourceOwnerRows.resize(localHeightB);
+            for(Int iLoc=0; iLoc<localHeightB; ++iLoc)
+            {
+                const int ownerRow = A.RowOwner(B.GlobalRow(iLoc));
+                plan.sourceOwnerRows[iLoc] = ownerRow;
+                ++plan.sourceOwnerRowCounts[ownerRow];
+            }
+            plan.sourceOwnerCols.resize(localWidthB);
+            for(Int jLoc=0; jLoc<localWidthB; ++jLoc)
+                plan.sourceOwnerCols[jLoc] = A.ColOwner(B.GlobalCol(jLoc));
         }
+        plan.sourceDistToComm.resize(colStrideA*rowStrideA);
+        for(int distARank=0; distARank<colStrideA*rowStrideA; ++distARank)
+            plan.sourceDistToComm[distARank] =
+              g.CoordsToVC(A.ColDist(),A.RowDist(),distARank,A.Root(),0);
     }
-    else
+
+    return plan;
+}
+
+// Exchange only the values, in the order described in RedistributionPlan,
+// over rounds of at most roughly RedistributionChunkSize() entries per
+// process. Each value is transmitted as the narrower of S and T.
+template<typename S,typename T>
+void ValueExchange
+(const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B,
+  const RedistributionPlan& plan)
+{
+    EL_DEBUG_CSE
+    typedef typename std::conditional<(sizeof(T) < sizeof(S)),T,S>::type W;
+    const Grid& g = B.Grid();
+    mpi::Comm comm = g.VCComm();
+    const int commSize = g.VCSize();
+    const int vcRank = g.VCRank();
+    const Int height = A.Height();
+    const Int width = A.Width();
+
+    const int colStride = B.ColStride();
+    const int rowStride = B.RowStride();
+    const int colRank = B.ColRank();
+    const int rowRank = B.RowRank();
+    const int colStrideA = A.ColStride();
+    const int rowStrideA = A.RowStride();
+
+    const Int localHeight = plan.ownerRows.size();
+    const Int localWidth = plan.ownerCols.size();
+    const Int localHeightB = plan.sourceOwnerRows.size();
+    const Int localWidthB = plan.sourceOwnerCols.size();
+
+    // Every process must agree upon the column blocks forming each round
+    const Int numChunkCols = (height == 0 ? Max(width,Int(1)) :
+      Int(Max(1., Min(double(width),
+        double(RedistributionChunkSize())*commSize/height))));
+
+    vector<W> sendBuf, recvBuf;
+    vector<int> sendCounts(commSize), sendOffs,
+                recvCounts(commSize), recvOffs;
+    vector<Int> ownerColCounts(rowStride), sourceOwnerColCounts(rowStrideA);
+    Int jLocEnd=0, jLocEndB=0;
+    for(Int jStart=0; jStart<width; jStart+=numChunkCols)
     {
-        if (!g.InGrid())
-            return;
-        comm = g.VCComm();
+        const Int jEnd = Min(jStart+numChunkCols,width);
+        const Int jLocBeg = jLocEnd;
+        while (jLocEnd < localWidth && A.GlobalCol(jLocEnd) < jEnd)
+            ++jLocEnd;
+        const Int jLocBegB = jLocEndB;
+        while (jLocEndB < localWidthB && B.GlobalCol(jLocEndB) < jEnd)
+            ++jLocEndB;
+
+        // Count what we send and receive in this round
+        // ----------------------------------------------
+        std::fill(sendCounts.begin(), sendCounts.end(), 0);
+        std::fill(ownerColCounts.begin(), ownerColCounts.end(), 0);
+        for(Int jLoc=jLocBeg; jLoc<jLocEnd; ++jLoc)
+            ++ownerColCounts[plan.ownerCols[jLoc]];
+        for(int ownerCol=0; ownerCol<rowStride; ++ownerCol)
+        {
+            if (ownerColCounts[ownerCol] == 0)
+                continue;
+            for(int ownerRow=0; ownerRow<colStride; ++ownerRow)
+            {
+                if (plan.copyLocally &&
+                    ownerRow == colRank && ownerCol == rowRank)
+                    continue;
+                const int owner =
+                  plan.distToComm[ownerRow+colStride*ownerCol];
+                sendCounts[owner] +=
+                  plan.ownerRowCounts[ownerRow]*ownerColCounts[ownerCol];
+            }
+        }
+        const int totalSend = Scan(sendCounts, sendOffs);
 
-        const int distBSize = mpi::Size(B.DistComm());
-        vector<int> distBToVC(distBSize);
-        for(int distBRank=0; distBRank<distBSize; ++distBRank)
+        std::fill(recvCounts.begin(), recvCounts.end(), 0);
+        std::fill
+        (sourceOwnerColCounts.begin(), sourceOwnerColCounts.end(), 0);
+        for(Int jLoc=jLocBegB; jLoc<jLocEndB; ++jLoc)
+            ++sourceOwnerColCounts[plan.sourceOwnerCols[jLoc]];
+        for(int ownerCol=0; ownerCol<rowStrideA; ++ownerCol)
         {
-            distBToVC[distBRank] =
-              g.CoordsToVC
-              (B.ColDist(),B.RowDist(),distBRank,BRoot,redundantRootB);
+            if (sourceOwnerColCounts[ownerCol] == 0)
+                continue;
+            for(int ownerRow=0; ownerRow<colStrideA; ++ownerRow)
+            {
+                const int sender =
+                  plan.sourceDistToComm[ownerRow+colStrideA*ownerCol];
+                if (plan.copyLocally && sender == vcRank)
+                    continue;
+                recvCounts[sender] +=
+                  plan.sourceOwnerRowCounts[ownerRow]*
+                  sourceOwnerColCounts[ownerCol];
+            }
         }
+        const int totalRecv = Scan(recvCounts, recvOffs);
 
-        const int vcSize = mpi::Size(g.VCComm());
-        sendCounts.resize(vcSize,0);
-        for(Int k=0; k<totalSend; ++k)
+        // Pack the data
+        // =============
+        FastResize(sendBuf, totalSend);
+        auto offs = sendOffs;
+        for(Int jLoc=jLocBeg; jLoc<jLocEnd; ++jLoc)
         {
-            owners[k] = distBToVC[distOwners[k]];
-            ++sendCounts[owners[k]];
+            const int ownerCol = plan.ownerCols[jLoc];
+            const Int localCol = plan.targetCols[jLoc];
+            const bool isLocalCol = (plan.copyLocally && ownerCol == rowRank);
+            const int* distToComm = &plan.distToComm[colStride*ownerCol];
+            for(Int iLoc=0; iLoc<localHeight; ++iLoc)
+            {
+                const int ownerRow = plan.ownerRows[iLoc];
+                const S& alpha = A.GetLocal(iLoc,jLoc);
+                if (isLocalCol && ownerRow == colRank)
+                    B.SetLocal
+                    (plan.targetRows[iLoc],localCol,Caster<S,T>::Cast(alpha));
+                else
+                    sendBuf[offs[distToComm[ownerRow]]++] =
+                      Caster<S,W>::Cast(alpha);
+            }
+        }
+
+        // Exchange and unpack the data
+        // ============================
+        FastResize(recvBuf, totalRecv);
+        mpi::AllToAll
+        (sendBuf.data(), sendCounts.data(), sendOffs.data(),
+         recvBuf.data(), recvCounts.data(), recvOffs.data(), comm);
+        offs = recvOffs;
+        for(Int jLoc=jLocBegB; jLoc<jLocEndB; ++jLoc)
+        {
+            const int* sourceDistToComm =
+              &plan.sourceDistToComm[colStrideA*plan.sourceOwnerCols[jLoc]];
+            for(Int iLoc=0; iLoc<localHeightB; ++iLoc)
+            {
+                const int sender = sourceDistToComm[plan.sourceOwnerRows[iLoc]];
+                if (plan.copyLocally && sender == vcRank)
+                    continue;
+                B.SetLocal
+                (iLoc,jLoc,Caster<W,T>::Cast(recvBuf[offs[sender]++]));
+            }
         }
     }
-    SwapClear(distOwners);
+}
+
+// Exchange the entries along with their target indices over the viewing
+// communicator (used when A and B are distributed over different grids)
+template<typename S,typename T>
+void EntryExchange
+(const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B,
+  const RedistributionPlan& plan)
+{
+    EL_DEBUG_CSE
+    const Grid& g = B.Grid();
 
     // Pack the data
     // =============
-    vector<int> sendOffs;
-    Scan(sendCounts, sendOffs);
+    // TODO: Break into smaller pieces to avoid excessive memory usage?
     vector<Entry<S>> sendBuf;
-    FastResize(sendBuf, totalSend);
-    auto offs = sendOffs;
-    for(Int k=0; k<totalSend; ++k)
-        sendBuf[offs[owners[k]]++] = remoteEntries[k];
-    SwapClear(remoteEntries);
-    SwapClear(owners);
+    FastResize(sendBuf, plan.totalSend);
+    {
+        const Int localHeight = plan.ownerRows.size();
+        const Int localWidth = plan.ownerCols.size();
+        const int colStride = B.ColStride();
+        const int colRank = B.ColRank();
+        const int rowRank = B.RowRank();
+        auto offs = plan.sendOffs;
+        for(Int jLoc=0; jLoc<localWidth; ++jLoc)
+        {
+            const int ownerCol = plan.ownerCols[jLoc];
+            const Int localCol = plan.targetCols[jLoc];
+            const bool isLocalCol = (plan.copyLocally && ownerCol == rowRank);
+            const int* distToComm = &plan.distToComm[colStride*ownerCol];
+            for(Int iLoc=0; iLoc<localHeight; ++iLoc)
+            {
+                const int ownerRow = plan.ownerRows[iLoc];
+                const Int localRow = plan.targetRows[iLoc];
+                const S& alpha = A.GetLocal(iLoc,jLoc);
+                if (isLocalCol && ownerRow == colRank)
+                {
+                    B.SetLocal(localRow,localCol,Caster<S,T>::Cast(alpha));
+                }
+                else
+                {
+                    sendBuf[offs[distToComm[ownerRow]]++] =
+                      Entry<S>{localRow,localCol,alpha};
+                }
+            }
+        }
+    }
 
     // Exchange and unpack the data
     // ============================
-    auto recvBuf = mpi::AllToAll(sendBuf, sendCounts, sendOffs, comm);
-    if (BPartic)
+    auto recvBuf =
+      mpi::AllToAll(sendBuf, plan.sendCounts, plan.sendOffs, g.ViewingComm());
+    SwapClear(sendBuf);
+    if (B.Participating() && B.RedundantRank() == 0)
     {
-        if (B.RedundantRank() == redundantRootB)
+        Int recvBufSize = recvBuf.size();
+        for(Int k=0; k<recvBufSize; ++k)
         {
-            Int recvBufSize = recvBuf.size();
-            for(Int k=0; k<recvBufSize; ++k)
-            {
-                const auto& entry = recvBuf[k];
-                B.SetLocal(entry.i,entry.j,Caster<S,T>::Cast(entry.value));
-            }
+            const auto& entry = recvBuf[k];
+            B.SetLocal(entry.i,entry.j,Caster<S,T>::Cast(entry.value));
         }
-        El::Broadcast(B, B.RedundantComm(), redundantRootB);
     }
 }
 
+template<typename S,typename T,typename=EnableIf<CanCast<S,T>>>
+void Helper
+(const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B)
+{
+    EL_DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Grid& g = B.Grid();
+    B.Resize(height, width);
+    Zero(B);
+
+    // Reuse the owners and index maps from a previous redistribution with the
+    // same distributions, alignments, and shape when possible
+    auto& plans = RedistributionPlans();
+    const RedistributionKey key(A, B);
+    auto plan = plans.Find(key);
+    if (!plan)
+        plan = plans.Insert(key, BuildRedistributionPlan(A, B));
+
+    if (plan->includeViewers)
+    {
+        EntryExchange(A, B, *plan);
+    }
+    else
+    {
+        if (!g.InGrid())
+            return;
+        ValueExchange(A, B, *plan);
+    }
+
+    // The first redundant copy of B now holds the result
+    if (B.Participating())
+        El::Broadcast(B, B.RedundantComm(), 0);
+}
+
+// Redistribute into a private [* ,* ] matrix and have each node leader
+// write it into the node-shared copy of B (returns false, doing nothing, if
+// B is not node-shared)
+template<typename S,typename T>
+bool NodeSharedGeneralPurpose
+(const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B)
+{
+    EL_DEBUG_CSE
+    if (B.Wrap() != ELEMENT ||
+        !static_cast<const ElementalMatrix<T>&>(B).NodeShared())
+        return false;
+    auto& BElem = static_cast<ElementalMatrix<T>&>(B);
+    DistMatrix<T,STAR,STAR> BPrivate(B.Grid());
+    GeneralPurpose(A, BPrivate);
+    B.Resize(A.Height(), A.Width());
+    if (B.Participating() && BElem.NodeLeader())
+        Copy(BPrivate.LockedMatrix(), B.Matrix());
+    BElem.NodeBarrier();
+    return true;
+}
+
 template<typename S,typename T,typename>
 void GeneralPurpose
 (const AbstractDistMatrix<S>& A,
         AbstractDistMatrix<T>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::GeneralPurpose")
+    if (NodeSharedGeneralPurpose(A, B))
+        return;
 
     if (A.Grid().Size() == 1 && B.Grid().Size() == 1)
     {
@@ -193,6 +418,9 @@ void GeneralPurpose
         AbstractDistMatrix<T>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::GeneralPurpose")
+    if (NodeSharedGeneralPurpose(A, B))
+        return;
 
     const Int height = A.Height();
     const Int width = A.Width();
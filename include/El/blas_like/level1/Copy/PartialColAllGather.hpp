@@ -18,6 +18,7 @@ void PartialColAllGather
   DistMatrix<T,Partial<U>(),V,ELEMENT,D>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::PartialColAllGather")
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -133,6 +134,7 @@ void PartialColAllGather
         DistMatrix<T,Partial<U>(),V,BLOCK>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::PartialColAllGather")
     AssertSameGrids( A, B );
     // TODO(poulson): More efficient implementation
     GeneralPurpose( A, B );
@@ -35,8 +35,9 @@ void RowAllGather_impl(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
             {
                 if (A.RowRank() == A.RowAlign())
                     B.Matrix() = A.LockedMatrix();
-                mpi::Broadcast
-                (B.Buffer(), B.LocalHeight(), A.RowAlign(), A.RowComm());
+                mpi::Broadcast<D>
+                (B.Buffer(), B.LocalHeight(), A.RowAlign(), A.RowComm(),
+                 A.Grid());
             }
             else
             {
@@ -56,8 +57,9 @@ void RowAllGather_impl(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
                   sendBuf,          1, localHeight);
 
                 // Communicate
-                mpi::AllGather
-                (sendBuf, portionSize, recvBuf, portionSize, A.RowComm());
+                mpi::AllGather<D>
+                (sendBuf, portionSize, recvBuf, portionSize,
+                 A.RowComm(), A.Grid());
 
                 // Unpack
                 util::RowStridedUnpack<T,D>
@@ -84,8 +86,9 @@ void RowAllGather_impl(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
                       A.ColComm());
 
                 // Perform the row broadcast
-                mpi::Broadcast
-                (B.Buffer(), B.LocalHeight(), A.RowAlign(), A.RowComm());
+                mpi::Broadcast<D>
+                (B.Buffer(), B.LocalHeight(), A.RowAlign(), A.RowComm(),
+                 A.Grid());
             }
             else
             {
@@ -113,9 +116,9 @@ void RowAllGather_impl(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
                   firstBuf,  portionSize, recvColRank, A.ColComm());
 
                 // Perform the row AllGather
-                mpi::AllGather
+                mpi::AllGather<D>
                 (firstBuf,  portionSize,
-                  secondBuf, portionSize, A.RowComm());
+                  secondBuf, portionSize, A.RowComm(), A.Grid());
 
                 // Unpack
                 util::RowStridedUnpack<T,D>
@@ -137,6 +140,7 @@ void RowAllGather
 ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowAllGather")
     if (A.GetLocalDevice() != B.GetLocalDevice())
         LogicError(
             "RowAllGather: For now, A and B must be on same device.");
@@ -166,6 +170,7 @@ template<typename T>
 void RowAllGather(const BlockMatrix<T>& A, BlockMatrix<T>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowAllGather")
     AssertSameGrids(A, B);
 
     EL_DEBUG_ONLY(
@@ -230,7 +235,8 @@ void RowAllGather(const BlockMatrix<T>& A, BlockMatrix<T>& B)
 
                 // Communicate
                 mpi::AllGather
-                (sendBuf, portionSize, recvBuf, portionSize, A.RowComm());
+                (sendBuf, portionSize, recvBuf, portionSize,
+                 A.RowComm(), A.Grid());
 
                 // Unpack
                 util::BlockedRowStridedUnpack
@@ -288,7 +294,7 @@ void RowAllGather(const BlockMatrix<T>& A, BlockMatrix<T>& B)
                 // Perform the row AllGather
                 mpi::AllGather
                 (firstBuf,  portionSize,
-                  secondBuf, portionSize, A.RowComm());
+                  secondBuf, portionSize, A.RowComm(), A.Grid());
 
                 // Unpack
                 util::BlockedRowStridedUnpack
@@ -18,6 +18,7 @@ void RowAllToAllDemote
   DistMatrix<T,U,V,ELEMENT,D>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowAllToAllDemote")
     AssertSameGrids(A, B);
 
     const Int height = A.Height();
@@ -120,6 +121,7 @@ void RowAllToAllDemote
           DistMatrix<T,                U,             V   ,BLOCK>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowAllToAllDemote")
     AssertSameGrids(A, B);
     // TODO(poulson): More efficient implementation
     GeneralPurpose(A, B);
@@ -19,6 +19,7 @@ void RowAllToAllPromote
   DistMatrix<T,PartialUnionCol<U,V>(),Partial<V>(),ELEMENT,D>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowAllToAllPromote")
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -122,6 +123,7 @@ void RowAllToAllPromote
         DistMatrix<T,PartialUnionCol<U,V>(),Partial<V>(),BLOCK>& B )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowAllToAllPromote")
     AssertSameGrids( A, B );
     // TODO(poulson): More efficient implementation
     GeneralPurpose( A, B );
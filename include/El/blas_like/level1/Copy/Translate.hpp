@@ -18,6 +18,7 @@ void Translate(
     DistMatrix<T,U,V,ELEMENT,D2>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::Translate")
     // if (D1 != D2)
     //     LogicError("Implementation in progress...");
 
@@ -47,7 +48,10 @@ void Translate(
     const bool aligned = colAlign == B.ColAlign() && rowAlign == B.RowAlign();
     if(aligned && root == B.Root())
     {
-        Copy(A.LockedMatrix(), B.Matrix());
+        // Node-shared storage is written once per node
+        if(B.NodeLeader())
+            Copy(A.LockedMatrix(), B.Matrix());
+        B.NodeBarrier();
     }
     else
     {
@@ -130,6 +134,7 @@ void Translate
         DistMatrix<T,U,V,BLOCK>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::Translate")
     const Int height = A.Height();
     const Int width = A.Width();
     const Int blockHeight = A.BlockHeight();
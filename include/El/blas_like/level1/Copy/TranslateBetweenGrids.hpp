@@ -14,6 +14,251 @@ namespace El
 namespace copy
 {
 
+namespace translate_between_grids {
+
+// The VC rank of the process of g with the given ranks in the communicators
+// over which the distribution dist is spread and replicated
+inline int VCRank
+( const El::Grid& g, Dist dist, int distRank, int redundantRank )
+{
+    switch( dist )
+    {
+    case VC: return distRank;
+    case VR: return g.VRToVC( distRank );
+    case MC: return distRank + redundantRank*g.Height();
+    case MR: return redundantRank + distRank*g.Height();
+    default:
+        LogicError("Unsupported distribution");
+        return 0;
+    }
+}
+
+// The members of {first, first+step, ...} within [begin,end), where first
+// is the smallest such member congruent to residue modulo step
+inline Int ClassLength( Int begin, Int end, Int residue, Int step, Int& first )
+{
+    first = begin + Mod( residue-begin, step );
+    return ( first < end ? (end-first-1)/step + 1 : 0 );
+}
+
+} // namespace translate_between_grids
+
+// Translates between grids the matrices which are distributed in one
+// dimension over (a subset of) the grid and replicated in the other, e.g.,
+// [VC,* ], [* ,VR], [MC,* ], and [* ,MR]. Each process of A's grid sends
+// directly to the processes of B's grid which own its indices, and the
+// transfer is split into chunks of Blocksize() columns so that the sends of
+// each chunk are in flight while the previous one is unpacked.
+template<typename T,Dist U,Dist V,Device D1,Device D2>
+void VectorTranslateBetweenGrids
+(DistMatrix<T,U,V,ELEMENT,D1> const& A,
+  DistMatrix<T,U,V,ELEMENT,D2>& B)
+{
+    EL_DEBUG_CSE
+    namespace tbg = translate_between_grids;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    B.Resize(m, n);
+    const bool inAGrid = A.Participating();
+    const bool inBGrid = B.Participating();
+    if(!inAGrid && !inBGrid)
+        return;
+
+    // The processes which own an index are distinguished by their ranks in
+    // the distribution's communicator; the first copy of B's replicas
+    // receives from the (Mod(rankB,redundantSizeA))'th copy of A's replicas
+    // and then broadcasts over B's redundant communicator.
+    const bool colDist = (V == STAR);
+    const Dist dist = (colDist ? U : V);
+    const El::Grid& gA = A.Grid();
+    const El::Grid& gB = B.Grid();
+    const Int strideA = (colDist ? A.ColStride() : A.RowStride());
+    const Int strideB = (colDist ? B.ColStride() : B.RowStride());
+    const Int alignA = (colDist ? A.ColAlign() : A.RowAlign());
+    const Int alignB = (colDist ? B.ColAlign() : B.RowAlign());
+    const Int redundantSizeA = A.RedundantSize();
+    const Int gcd = GCD(strideA, strideB);
+    const Int sendStep = strideB / gcd;
+    const Int recvStep = strideA / gcd;
+    const bool receiving = inBGrid && B.RedundantRank() == 0;
+
+    Int shiftA=0, rankB=0, shiftB=0;
+    if(inAGrid)
+        shiftA = (colDist ? A.ColShift() : A.RowShift());
+    if(inBGrid)
+    {
+        rankB = (colDist ? B.ColRank() : B.RowRank());
+        shiftB = (colDist ? B.ColShift() : B.RowShift());
+    }
+
+    // Map the owning ranks of A's grid into B's viewing communicator, which
+    // all of the messages are exchanged over
+    mpi::Comm viewingCommB = gB.ViewingComm();
+    const int sizeA = gA.Size();
+    vector<int> owningRanksA(sizeA), viewingRanksA(sizeA);
+    for(int q=0; q<sizeA; ++q)
+        owningRanksA[q] = q;
+    mpi::Translate
+    (gA.OwningGroup(), sizeA, owningRanksA.data(),
+      viewingCommB, viewingRanksA.data());
+    auto viewingRankA = [&](Int distRank, Int redundantRank)
+    {
+        const int vcRank = tbg::VCRank(gA, dist, distRank, redundantRank);
+        return viewingRanksA[
+          gA.Order() == COLUMN_MAJOR ? vcRank : gA.VCToVR(vcRank)];
+    };
+
+    // The range of local distributed indices which lie in a chunk, and the
+    // size of the local portion of the chunk for a given number of them
+    const Int chunkSize = Max(Blocksize(), Int(1));
+    const Int numChunks = (n == 0 ? 0 : MaxLength(n, chunkSize));
+    auto localRange = [&](Int chunk, Int shift, Int stride, Int localLength)
+    {
+        if(colDist)
+            return std::make_pair(Int(0), localLength);
+        const Int j0 = chunk*chunkSize;
+        const Int j1 = Min(j0+chunkSize, n);
+        return std::make_pair(Length(j0,shift,stride), Length(j1,shift,stride));
+    };
+    auto entries = [&](Int chunk, Int numIndices)
+    {
+        return numIndices*(colDist ? Min(chunkSize,n-chunk*chunkSize) : m);
+    };
+    const Int localLengthA =
+      (inAGrid ? (colDist ? A.LocalHeight() : A.LocalWidth()) : 0);
+    const Int localLengthB =
+      (inBGrid ? (colDist ? B.LocalHeight() : B.LocalWidth()) : 0);
+    const Int maxChunkA = (colDist ? entries(0, localLengthA) :
+      entries(0, Min(localLengthA, MaxLength(chunkSize,strideA))));
+    const Int maxChunkB = (colDist ? entries(0, localLengthB) :
+      entries(0, Min(localLengthB, MaxLength(chunkSize,strideB))));
+
+    // Each process of A sends each of its (at most sendStep) classes of
+    // local indices which are congruent modulo sendStep to a single process
+    // of B, and each process of B receives each of its classes modulo
+    // recvStep from a single process of A, both in increasing order.
+    simple_buffer<T,Device::CPU> sendBuffer(inAGrid ? 2*maxChunkA : 0);
+    simple_buffer<T,Device::CPU> recvBuffer(inBGrid ? 2*maxChunkB : 0);
+    vector<mpi::Request<T>> sendRequests[2], recvRequests[2];
+
+    auto postRecvs = [&](Int chunk)
+    {
+        if(!receiving)
+            return;
+        auto& requests = recvRequests[chunk%2];
+        requests.clear();
+        T* recvBuf = recvBuffer.data() + (chunk%2)*maxChunkB;
+        const auto range = localRange(chunk, shiftB, strideB, localLengthB);
+        Int offset = 0;
+        for(Int residue=0; residue<recvStep; ++residue)
+        {
+            Int first;
+            const Int numIndices = tbg::ClassLength
+              (range.first, range.second, residue, recvStep, first);
+            if(numIndices == 0)
+                continue;
+            const Int sendRank =
+              Mod(shiftB+first*strideB+alignA, strideA);
+            const Int count = entries(chunk, numIndices);
+            requests.emplace_back();
+            mpi::IRecv
+            (recvBuf+offset, count,
+              viewingRankA(sendRank, Mod(rankB,redundantSizeA)),
+              viewingCommB, requests.back());
+            offset += count;
+        }
+    };
+
+    auto postSends = [&](Int chunk)
+    {
+        if(!inAGrid)
+            return;
+        auto& requests = sendRequests[chunk%2];
+        mpi::WaitAll(requests.size(), requests.data());
+        requests.clear();
+        T* sendBuf = sendBuffer.data() + (chunk%2)*maxChunkA;
+        const auto range = localRange(chunk, shiftA, strideA, localLengthA);
+        const Int j0 = chunk*chunkSize;
+        const Int redundantRankA = A.RedundantRank();
+        Int offset = 0;
+        for(Int residue=0; residue<sendStep; ++residue)
+        {
+            Int first;
+            const Int numIndices = tbg::ClassLength
+              (range.first, range.second, residue, sendStep, first);
+            if(numIndices == 0)
+                continue;
+            const Int recvRank = Mod(shiftA+first*strideA+alignB, strideB);
+            if(Mod(recvRank,redundantSizeA) != redundantRankA)
+                continue;
+            const Int count = entries(chunk, numIndices);
+            if(colDist)
+                util::InterleaveMatrix<T,Device::CPU>
+                (numIndices, count/numIndices,
+                  A.LockedBuffer(first,j0), sendStep, A.LDim(),
+                  sendBuf+offset, 1, numIndices);
+            else
+                util::InterleaveMatrix<T,Device::CPU>
+                (m, numIndices,
+                  A.LockedBuffer(0,first), 1, sendStep*A.LDim(),
+                  sendBuf+offset, 1, m);
+            const int recvVCRank = tbg::VCRank(gB, dist, recvRank, 0);
+            requests.emplace_back();
+            mpi::ISend
+            (sendBuf+offset, count, gB.VCToViewing(recvVCRank),
+              viewingCommB, requests.back());
+            offset += count;
+        }
+    };
+
+    auto unpack = [&](Int chunk)
+    {
+        if(!inBGrid)
+            return;
+        auto& requests = recvRequests[chunk%2];
+        mpi::WaitAll(requests.size(), requests.data());
+        T* recvBuf = recvBuffer.data() + (chunk%2)*maxChunkB;
+        const auto range = localRange(chunk, shiftB, strideB, localLengthB);
+        mpi::Broadcast
+        (recvBuf, entries(chunk,range.second-range.first), 0,
+          B.RedundantComm());
+        const Int j0 = chunk*chunkSize;
+        Int offset = 0;
+        for(Int residue=0; residue<recvStep; ++residue)
+        {
+            Int first;
+            const Int numIndices = tbg::ClassLength
+              (range.first, range.second, residue, recvStep, first);
+            if(numIndices == 0)
+                continue;
+            const Int count = entries(chunk, numIndices);
+            if(colDist)
+                util::InterleaveMatrix<T,Device::CPU>
+                (numIndices, count/numIndices,
+                  recvBuf+offset, 1, numIndices,
+                  B.Buffer(first,j0), recvStep, B.LDim());
+            else
+                util::InterleaveMatrix<T,Device::CPU>
+                (m, numIndices,
+                  recvBuf+offset, 1, m,
+                  B.Buffer(0,first), 1, recvStep*B.LDim());
+            offset += count;
+        }
+    };
+
+    if(numChunks > 0)
+        postRecvs(0);
+    for(Int chunk=0; chunk<numChunks; ++chunk)
+    {
+        if(chunk+1 < numChunks)
+            postRecvs(chunk+1);
+        postSends(chunk);
+        unpack(chunk);
+    }
+    for(auto& requests : sendRequests)
+        mpi::WaitAll(requests.size(), requests.data());
+}
+
 // FIXME (trb 03/06/18) -- Need to do the GPU impl
 template<typename T,Dist U,Dist V,Device D1,Device D2>
 void TranslateBetweenGrids
@@ -21,6 +266,7 @@ void TranslateBetweenGrids
   DistMatrix<T,U,V,ELEMENT,D2>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::TranslateBetweenGrids")
 
     if (D1 != Device::CPU)
         LogicError("TranslateBetweenGrids: Device not implemented.");
@@ -29,7 +275,13 @@ void TranslateBetweenGrids
         LogicError("TranslateBetweenGrids: ",
                    "Mixed-device implementation not implemented.");
 
-    GeneralPurpose(A, B);
+    const Dist dist = (V == STAR ? U : V);
+    const bool oneDimensional = (U == STAR) != (V == STAR);
+    if (oneDimensional &&
+        (dist == VC || dist == VR || dist == MC || dist == MR))
+        VectorTranslateBetweenGrids(A, B);
+    else
+        GeneralPurpose(A, B);
 }
 
 // TODO(poulson): Compare against copy::GeneralPurpose
@@ -40,6 +292,7 @@ void TranslateBetweenGrids
   DistMatrix<T,MC,MR,ELEMENT,D2>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::TranslateBetweenGrids")
 
     if (D1 != Device::CPU)
         LogicError("TranslateBetweenGrids<MC,MR,ELEMENT>: "
@@ -240,6 +493,7 @@ void TranslateBetweenGrids
   DistMatrix<T,STAR,STAR,ELEMENT,D2>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::TranslateBetweenGrids")
 
     const Int height = A.Height();
     const Int width = A.Width();
@@ -260,12 +514,9 @@ void TranslateBetweenGrids
     const int commSizeB = mpi::Size(commB);
     const int viewingCommSizeA = mpi::Size(viewingCommA);
     const int viewingCommSizeB = mpi::Size(viewingCommB);
-    bool usingViewingA=false, usingViewingB=false;
     mpi::Comm activeCommA, activeCommB;
     if(viewingCommSizeA == viewingCommSizeB)
     {
-        usingViewingA = true;
-        usingViewingB = true;
         activeCommA = viewingCommA;
         activeCommB = viewingCommB;
         if(!mpi::Congruent(viewingCommA, viewingCommB))
@@ -273,8 +524,6 @@ void TranslateBetweenGrids
     }
     else if(viewingCommSizeA == commSizeB)
     {
-        usingViewingA = true;
-        usingViewingB = false;
         activeCommA = viewingCommA;
         activeCommB = commB;
         if(!mpi::Congruent(viewingCommA, commB))
@@ -282,8 +531,6 @@ void TranslateBetweenGrids
     }
     else if(commSizeA == viewingCommSizeB)
     {
-        usingViewingA = false;
-        usingViewingB = true;
         activeCommA = commA;
         activeCommB = viewingCommB;
         if(!mpi::Congruent(commA, viewingCommB))
@@ -291,8 +538,6 @@ void TranslateBetweenGrids
     }
     else
     {
-        usingViewingA = false;
-        usingViewingB = false;
         activeCommA = commA;
         activeCommB = commB;
         LogicError("Unsupported TranslateBetweenGrids instance");
@@ -323,8 +568,8 @@ void TranslateBetweenGrids
         (height, width,
           A.LockedBuffer(), 1, A.LDim(),
           sendBuf,          1, height);
-        // TODO(poulson): Use mpi::Translate instead?
-        const Int recvRank = (usingViewingB ? B.Grid().VCToViewing(0) : 0);
+        const Int recvRank =
+          mpi::Translate(B.Grid().OwningGroup(), 0, activeCommB);
         mpi::ISend
         (sendBuf, height*width, recvRank, activeCommB, sendRequest);
     }
@@ -335,9 +580,8 @@ void TranslateBetweenGrids
     {
         if(rankB == 0)
         {
-            // TODO(poulson): Use mpi::Translate instead?
             const Int sendRank =
-              (usingViewingA ? A.Grid().VCToViewing(0) : 0);
+              mpi::Translate(A.Grid().OwningGroup(), 0, activeCommB);
             mpi::Recv(bcastBuffer, height*width, sendRank, activeCommB);
         }
 
@@ -21,6 +21,7 @@ void TransposeDist(DistMatrix<T,U,V,ELEMENT,D> const& A,
                    DistMatrix<T,V,U,ELEMENT,D>& B)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("copy::TransposeDist")
     AssertSameGrids(A, B);
 
     const Grid& g = B.Grid();
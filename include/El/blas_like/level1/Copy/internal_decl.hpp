@@ -42,7 +42,12 @@ template<typename T,Device D1,Device D2>
 void TranslateBetweenGrids
 ( DistMatrix<T,STAR,STAR,ELEMENT,D1> const& A,
   DistMatrix<T,STAR,STAR,ELEMENT,D2>& B );
-// The fallback case that simply throws an exception
+// The general case, which translates the [VC,* ], [* ,VR], [MC,* ], and
+// [* ,MR] families directly and otherwise falls back to GeneralPurpose
+template<typename T,Dist U,Dist V,Device D1,Device D2>
+void VectorTranslateBetweenGrids
+( DistMatrix<T,U,V,ELEMENT,D1> const& A,
+  DistMatrix<T,U,V,ELEMENT,D2>& B );
 template<typename T,Dist U,Dist V,Device D1,Device D2>
 void TranslateBetweenGrids
 ( const DistMatrix<T,U,V,ELEMENT,D1>& A,
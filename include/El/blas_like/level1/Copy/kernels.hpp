@@ -0,0 +1,175 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPY_KERNELS_HPP
+#define EL_BLAS_COPY_KERNELS_HPP
+
+#include <algorithm>
+
+namespace El
+{
+namespace copy
+{
+namespace util
+{
+namespace cpu
+{
+
+// A height x width block of A, with the given distances between consecutive
+// rows and columns, and the block of B which it is copied into (or added to)
+template <typename T>
+struct StridedBlock
+{
+    Int height, width;
+    T const* A; Int colStrideA, rowStrideA;
+    T* B; Int colStrideB, rowStrideB;
+};
+
+// Columns are split into pieces of at most this many entries so that a few
+// tall columns can still keep every thread busy
+constexpr Int kernelPieceSize = 8192;
+// Smaller batches are handled serially to avoid the threading overhead
+constexpr Int kernelParallelThreshold = 32768;
+
+// The column strides of the packing routines are almost always either one or
+// the (small) number of processes in a row or column of the grid, so these
+// cases are instantiated with compile-time strides to allow vectorization
+template <Int colStrideA, Int colStrideB, typename T, typename EntryOp>
+void StridedColumnKernel
+(Int height, T const* EL_RESTRICT A, T* EL_RESTRICT B, EntryOp op)
+{
+    EL_SIMD
+    for (Int i=0; i<height; ++i)
+        op(B[i*colStrideB], A[i*colStrideA]);
+}
+
+template <typename T, typename EntryOp>
+void StridedColumn
+(Int height,
+ T const* EL_RESTRICT A, Int colStrideA,
+ T* EL_RESTRICT B, Int colStrideB, EntryOp op)
+{
+    if (colStrideA == 1)
+    {
+        switch (colStrideB)
+        {
+        case 1: StridedColumnKernel<1,1>(height, A, B, op); return;
+        case 2: StridedColumnKernel<1,2>(height, A, B, op); return;
+        case 3: StridedColumnKernel<1,3>(height, A, B, op); return;
+        case 4: StridedColumnKernel<1,4>(height, A, B, op); return;
+        default: break;
+        }
+    }
+    else if (colStrideB == 1)
+    {
+        switch (colStrideA)
+        {
+        case 2: StridedColumnKernel<2,1>(height, A, B, op); return;
+        case 3: StridedColumnKernel<3,1>(height, A, B, op); return;
+        case 4: StridedColumnKernel<4,1>(height, A, B, op); return;
+        default: break;
+        }
+    }
+    EL_SIMD
+    for (Int i=0; i<height; ++i)
+        op(B[i*colStrideB], A[i*colStrideA]);
+}
+
+// Apply columnOp to every column of every block, threading over pieces of
+// columns across all of the blocks at once
+template <typename T, typename ColumnOp>
+void ForEachStridedColumn(vector<StridedBlock<T>> blocks, ColumnOp columnOp)
+{
+    const Int numBlocks = blocks.size();
+    vector<Int> numPieces(numBlocks), taskOffs(numBlocks+1, 0);
+    Int totalSize = 0;
+    for (Int b=0; b<numBlocks; ++b)
+    {
+        auto& block = blocks[b];
+        // Contiguous blocks are treated as a single (long) column
+        if (block.width > 1 &&
+            block.colStrideA == 1 && block.rowStrideA == block.height &&
+            block.colStrideB == 1 && block.rowStrideB == block.height)
+        {
+            block.height *= block.width;
+            block.width = 1;
+        }
+        numPieces[b] = (block.height + kernelPieceSize - 1) / kernelPieceSize;
+        taskOffs[b+1] = taskOffs[b] + numPieces[b]*block.width;
+        totalSize += block.height*block.width;
+    }
+
+    auto runTask = [&](Int task)
+    {
+        const Int b =
+            std::upper_bound(taskOffs.begin(), taskOffs.end(), task)
+            - taskOffs.begin() - 1;
+        const auto& block = blocks[b];
+        const Int blockTask = task - taskOffs[b];
+        const Int j = blockTask / numPieces[b];
+        const Int iBeg = (blockTask % numPieces[b])*kernelPieceSize;
+        const Int pieceHeight = Min(kernelPieceSize, block.height-iBeg);
+        columnOp
+            (pieceHeight,
+             &block.A[iBeg*block.colStrideA+j*block.rowStrideA],
+             block.colStrideA,
+             &block.B[iBeg*block.colStrideB+j*block.rowStrideB],
+             block.colStrideB);
+    };
+
+    const Int numTasks = taskOffs[numBlocks];
+    if (totalSize < kernelParallelThreshold)
+    {
+        for (Int task=0; task<numTasks; ++task)
+            runTask(task);
+    }
+    else
+    {
+        EL_PARALLEL_FOR
+        for (Int task=0; task<numTasks; ++task)
+            runTask(task);
+    }
+}
+
+// B := A for each block
+template <typename T>
+void CopyStridedBlocks(vector<StridedBlock<T>> blocks)
+{
+    ForEachStridedColumn
+        (std::move(blocks),
+         [](Int height, T const* A, Int colStrideA, T* B, Int colStrideB)
+         {
+             if (colStrideA == 1 && colStrideB == 1)
+                 MemCopy(B, A, height);
+             else
+                 StridedColumn
+                     (height, A, colStrideA, B, colStrideB,
+                      [](T& b, T const& a) { b = a; });
+         });
+}
+
+// B := B + alpha A for each block
+template <typename T>
+void UpdateStridedBlocks(T alpha, vector<StridedBlock<T>> blocks)
+{
+    ForEachStridedColumn
+        (std::move(blocks),
+         [alpha](Int height, T const* A, Int colStrideA, T* B, Int colStrideB)
+         {
+             StridedColumn
+                 (height, A, colStrideA, B, colStrideB,
+                  [alpha](T& b, T const& a) { b += alpha*a; });
+         });
+}
+
+} // namespace cpu
+} // namespace util
+} // namespace copy
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPY_KERNELS_HPP
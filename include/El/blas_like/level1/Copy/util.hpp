@@ -9,6 +9,8 @@
 #ifndef EL_BLAS_COPY_UTIL_HPP
 #define EL_BLAS_COPY_UTIL_HPP
 
+#include "kernels.hpp"
+
 #ifdef HYDROGEN_HAVE_CUDA
 #include "../GPU/Copy.hpp"
 #endif
@@ -70,24 +72,20 @@ struct Impl<T, Device::CPU, true>
         T const* A, Int colStrideA, Int rowStrideA,
         T* B, Int colStrideB, Int rowStrideB)
     {
-        if (colStrideA == 1 && colStrideB == 1)
-        {
-            lapack::Copy('F', height, width, A, rowStrideA, B, rowStrideB);
-        }
-        else
-        {
 #ifdef HYDROGEN_HAVE_MKL
+        if (colStrideA != 1 || colStrideB != 1)
+        {
             mkl::omatcopy
                 (NORMAL, height, width, T(1),
                   A, rowStrideA, colStrideA,
                   B, rowStrideB, colStrideB);
-#else
-            for(Int j=0; j<width; ++j)
-                StridedMemCopy
-                    (&B[j*rowStrideB], colStrideB,
-                      &A[j*rowStrideA], colStrideA, height);
-#endif
+            return;
         }
+#endif
+        cpu::CopyStridedBlocks<T>
+            ({{height, width,
+               A, colStrideA, rowStrideA,
+               B, colStrideB, rowStrideB}});
     }
 
     static void RowStridedPack(Int height, Int width,
@@ -95,15 +93,17 @@ struct Impl<T, Device::CPU, true>
                                T const* A,Int ALDim,
                                T* BPortions, Int portionSize)
     {
+        vector<cpu::StridedBlock<T>> blocks(rowStride);
         for (Int k=0; k<rowStride; ++k)
         {
             const Int rowShift = Shift_(k, rowAlign, rowStride);
             const Int localWidth = Length_(width, rowShift, rowStride);
-            lapack::Copy
-                ('F', height, localWidth,
-                 &A[rowShift*ALDim],        rowStride*ALDim,
-                 &BPortions[k*portionSize], height);
+            blocks[k] =
+                {height, localWidth,
+                 &A[rowShift*ALDim],        1, rowStride*ALDim,
+                 &BPortions[k*portionSize], 1, height};
         }
+        cpu::CopyStridedBlocks(std::move(blocks));
     }
 
     static void RowStridedUnpack
@@ -112,15 +112,17 @@ struct Impl<T, Device::CPU, true>
       const T* APortions, Int portionSize,
       T* B,         Int BLDim)
     {
+        vector<cpu::StridedBlock<T>> blocks(rowStride);
         for (Int k=0; k<rowStride; ++k)
         {
             const Int rowShift = Shift_(k, rowAlign, rowStride);
             const Int localWidth = Length_(width, rowShift, rowStride);
-            lapack::Copy
-                ('F', height, localWidth,
-                 &APortions[k*portionSize], height,
-                 &B[rowShift*BLDim],        rowStride*BLDim);
+            blocks[k] =
+                {height, localWidth,
+                 &APortions[k*portionSize], 1, height,
+                 &B[rowShift*BLDim],        1, rowStride*BLDim};
         }
+        cpu::CopyStridedBlocks(std::move(blocks));
     }
 
     static void PartialRowStridedPack
@@ -131,17 +133,19 @@ struct Impl<T, Device::CPU, true>
      const T* A,         Int ALDim,
      T* BPortions, Int portionSize)
     {
+        vector<cpu::StridedBlock<T>> blocks(rowStrideUnion);
         for (Int k=0; k<rowStrideUnion; ++k)
         {
             const Int rowShift =
                 Shift_(rowRankPart+k*rowStridePart, rowAlign, rowStride);
             const Int rowOffset = (rowShift-rowShiftA) / rowStridePart;
             const Int localWidth = Length_(width, rowShift, rowStride);
-            lapack::Copy
-                ('F', height, localWidth,
-                 &A[rowOffset*ALDim],       rowStrideUnion*ALDim,
-                 &BPortions[k*portionSize], height);
+            blocks[k] =
+                {height, localWidth,
+                 &A[rowOffset*ALDim],       1, rowStrideUnion*ALDim,
+                 &BPortions[k*portionSize], 1, height};
         }
+        cpu::CopyStridedBlocks(std::move(blocks));
     }
 
     static void PartialRowStridedUnpack
@@ -152,17 +156,19 @@ struct Impl<T, Device::CPU, true>
      const T* APortions, Int portionSize,
      T* B, Int BLDim)
     {
+        vector<cpu::StridedBlock<T>> blocks(rowStrideUnion);
         for (Int k=0; k<rowStrideUnion; ++k)
         {
             const Int rowShift =
                 Shift_(rowRankPart+k*rowStridePart, rowAlign, rowStride);
             const Int rowOffset = (rowShift-rowShiftB) / rowStridePart;
             const Int localWidth = Length_(width, rowShift, rowStride);
-            lapack::Copy
-                ('F', height, localWidth,
-                 &APortions[k*portionSize], height,
-                 &B[rowOffset*BLDim],       rowStrideUnion*BLDim);
+            blocks[k] =
+                {height, localWidth,
+                 &APortions[k*portionSize], 1, height,
+                 &B[rowOffset*BLDim],       1, rowStrideUnion*BLDim};
         }
+        cpu::CopyStridedBlocks(std::move(blocks));
     }
 
     static void PartialColStridedColumnPack
@@ -173,16 +179,19 @@ struct Impl<T, Device::CPU, true>
      const T* A,
      T* BPortions, Int portionSize)
     {
+        vector<cpu::StridedBlock<T>> blocks(colStrideUnion);
         for (Int k=0; k<colStrideUnion; ++k)
         {
             const Int colShift =
                 Shift_(colRankPart+k*colStridePart, colAlign, colStride);
             const Int colOffset = (colShift-colShiftA) / colStridePart;
             const Int localHeight = Length_(height, colShift, colStride);
-            StridedMemCopy
-                (&BPortions[k*portionSize], 1,
-                 &A[colOffset],             colStrideUnion, localHeight);
+            blocks[k] =
+                {localHeight, 1,
+                 &A[colOffset],             colStrideUnion, localHeight,
+                 &BPortions[k*portionSize], 1,              localHeight};
         }
+        cpu::CopyStridedBlocks(std::move(blocks));
     }
 
 };
@@ -417,14 +426,17 @@ void ColStridedColumnPack
   const T* A,
         T* BPortions, Int portionSize)
 {
+    vector<cpu::StridedBlock<T>> blocks(colStride);
     for (Int k=0; k<colStride; ++k)
     {
         const Int colShift = Shift_(k, colAlign, colStride);
         const Int localHeight = Length_(height, colShift, colStride);
-        StridedMemCopy
-        (&BPortions[k*portionSize], 1,
-          &A[colShift],              colStride, localHeight);
+        blocks[k] =
+            {localHeight, 1,
+             &A[colShift],              colStride, localHeight,
+             &BPortions[k*portionSize], 1,         localHeight};
     }
+    cpu::CopyStridedBlocks(std::move(blocks));
 }
 
 template<typename T,Device D>
@@ -516,16 +528,10 @@ void PartialColStridedColumnPack
   const T* A,
         T* BPortions, Int portionSize)
 {
-    for (Int k=0; k<colStrideUnion; ++k)
-    {
-        const Int colShift =
-            Shift_(colRankPart+k*colStridePart, colAlign, colStride);
-        const Int colOffset = (colShift-colShiftA) / colStridePart;
-        const Int localHeight = Length_(height, colShift, colStride);
-        StridedMemCopy
-        (&BPortions[k*portionSize], 1,
-          &A[colOffset],             colStrideUnion, localHeight);
-    }
+    details::Impl<T,Device::CPU>::PartialColStridedColumnPack
+        (height, colAlign, colStride,
+         colStrideUnion, colStridePart, colRankPart, colShiftA,
+         A, BPortions, portionSize);
 }
 
 template<typename T,Device D>
@@ -559,16 +565,19 @@ void PartialColStridedColumnUnpack
   const T* APortions, Int portionSize,
         T* B)
 {
+    vector<cpu::StridedBlock<T>> blocks(colStrideUnion);
     for (Int k=0; k<colStrideUnion; ++k)
     {
         const Int colShift =
             Shift_(colRankPart+k*colStridePart, colAlign, colStride);
         const Int colOffset = (colShift-colShiftB) / colStridePart;
         const Int localHeight = Length_(height, colShift, colStride);
-        StridedMemCopy
-        (&B[colOffset],             colStrideUnion,
-          &APortions[k*portionSize], 1,              localHeight);
+        blocks[k] =
+            {localHeight, 1,
+             &APortions[k*portionSize], 1,              localHeight,
+             &B[colOffset],             colStrideUnion, localHeight};
     }
+    cpu::CopyStridedBlocks(std::move(blocks));
 }
 
 template<typename T,Device D>
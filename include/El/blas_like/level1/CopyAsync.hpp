@@ -0,0 +1,370 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPYASYNC_HPP
+#define EL_BLAS_COPYASYNC_HPP
+
+namespace El {
+
+template<typename T>
+CopyHandle<T>::CopyHandle( CopyHandle<T>&& handle )
+{ *this = std::move(handle); }
+
+template<typename T>
+CopyHandle<T>& CopyHandle<T>::operator=( CopyHandle<T>&& handle )
+{
+    if( this != &handle )
+    {
+        Wait();
+        comm_ = handle.comm_;
+        pending_ = handle.pending_;
+        sendBuf_ = std::move(handle.sendBuf_);
+        recvBuf_ = std::move(handle.recvBuf_);
+        requests_ = std::move(handle.requests_);
+        completed_ = std::move(handle.completed_);
+        unpack_ = std::move(handle.unpack_);
+        handle.comm_ = mpi::COMM_NULL;
+        handle.pending_ = false;
+    }
+    return *this;
+}
+
+template<typename T>
+CopyHandle<T>::~CopyHandle()
+{
+    if( pending_ && !mpi::Finalized() )
+        Wait();
+}
+
+template<typename T>
+void CopyHandle<T>::Start
+( mpi::Comm comm, Int portionSize, bool allToAll,
+  vector<T>&& sendBuf, std::function<void(const T*)> unpack )
+{
+    EL_DEBUG_CSE
+    Wait();
+    const int commSize = mpi::Size( comm );
+    sendBuf_ = std::move(sendBuf);
+    recvBuf_.resize( commSize*portionSize );
+    unpack_ = std::move(unpack);
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    // Collectives are matched in the order in which they are started on each
+    // communicator, so no tags are needed to tell the handles apart
+    requests_.resize( 1 );
+    if( allToAll )
+        mpi::IAllToAll
+        ( sendBuf_.data(), portionSize, recvBuf_.data(), portionSize, comm,
+          requests_[0] );
+    else
+        mpi::IAllGather
+        ( sendBuf_.data(), portionSize, recvBuf_.data(), portionSize, comm,
+          requests_[0] );
+#else
+    // Each handle communicates over its own duplicate of the communicator so
+    // that its messages cannot match those of another outstanding handle
+    mpi::Dup( comm, comm_ );
+    const int commRank = mpi::Rank( comm_ );
+    requests_.resize( 2*(commSize-1) );
+
+    // Post every receive before the matching sends are issued
+    Int numRequests = 0;
+    for( int q=0; q<commSize; ++q )
+        if( q != commRank )
+            mpi::IRecv
+            ( &recvBuf_[q*portionSize], portionSize, q, comm_,
+              requests_[numRequests++] );
+    for( int q=0; q<commSize; ++q )
+    {
+        const T* sendPortion =
+          allToAll ? &sendBuf_[q*portionSize] : sendBuf_.data();
+        if( q == commRank )
+            MemCopy( &recvBuf_[q*portionSize], sendPortion, portionSize );
+        else
+            mpi::ISend
+            ( sendPortion, portionSize, q, comm_, requests_[numRequests++] );
+    }
+#endif
+    completed_.assign( requests_.size(), false );
+    pending_ = true;
+    Test();
+}
+
+template<typename T>
+bool CopyHandle<T>::Test()
+{
+    EL_DEBUG_CSE
+    if( !pending_ )
+        return true;
+    bool done = true;
+    for( size_t k=0; k<requests_.size(); ++k )
+    {
+        if( !completed_[k] )
+            completed_[k] = mpi::Test( requests_[k] );
+        done = done && completed_[k];
+    }
+    if( done )
+        Finish();
+    return done;
+}
+
+template<typename T>
+void CopyHandle<T>::Wait()
+{
+    EL_DEBUG_CSE
+    if( pending_ )
+        Finish();
+}
+
+template<typename T>
+void CopyHandle<T>::Finish()
+{
+    EL_DEBUG_CSE
+    // Completes any outstanding requests (and unpacks the receives of
+    // types which are sent in serialized form)
+    mpi::WaitAll( requests_.size(), requests_.data() );
+    if( comm_ != mpi::COMM_NULL )
+        mpi::Free( comm_ );
+    pending_ = false;
+    unpack_( recvBuf_.data() );
+    SwapClear( sendBuf_ );
+    SwapClear( recvBuf_ );
+    requests_.clear();
+    completed_.clear();
+    unpack_ = nullptr;
+}
+
+namespace copy {
+namespace async {
+
+// (U,V) |-> (U,Collect(V))
+template<typename T>
+bool RowAllGather
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B, CopyHandle<T>& handle )
+{
+    EL_DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignColsAndResize( A.ColAlign(), height, width, false, false );
+    if( B.ColAlign() != A.ColAlign() )
+        return false;
+    if( !A.Participating() )
+        return true;
+
+    const Int rowStride = A.RowStride();
+    const Int rowAlign = A.RowAlign();
+    const Int localHeight = A.LocalHeight();
+    const Int portionSize = mpi::Pad( localHeight*MaxLength(width,rowStride) );
+
+    vector<T> sendBuf( portionSize );
+    util::InterleaveMatrix<T,Device::CPU>
+    ( localHeight, A.LocalWidth(),
+      A.LockedBuffer(), 1, A.LDim(),
+      sendBuf.data(),   1, localHeight );
+
+    handle.Start
+    ( A.RowComm(), portionSize, false, std::move(sendBuf),
+      [=,&B]( const T* recvBuf )
+      {
+          util::RowStridedUnpack<T,Device::CPU>
+          ( localHeight, width, rowAlign, rowStride,
+            recvBuf, portionSize,
+            B.Buffer(), B.LDim() );
+      } );
+    return true;
+}
+
+// (U,V) |-> (Collect(U),V)
+template<typename T>
+bool ColAllGather
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B, CopyHandle<T>& handle )
+{
+    EL_DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignRowsAndResize( A.RowAlign(), height, width, false, false );
+    if( B.RowAlign() != A.RowAlign() )
+        return false;
+    if( !A.Participating() )
+        return true;
+
+    const Int colStride = A.ColStride();
+    const Int colAlign = A.ColAlign();
+    const Int localWidth = A.LocalWidth();
+    const Int portionSize =
+      mpi::Pad( MaxLength(height,colStride)*localWidth );
+
+    vector<T> sendBuf( portionSize );
+    util::InterleaveMatrix<T,Device::CPU>
+    ( A.LocalHeight(), localWidth,
+      A.LockedBuffer(), 1, A.LDim(),
+      sendBuf.data(),   1, A.LocalHeight() );
+
+    handle.Start
+    ( A.ColComm(), portionSize, false, std::move(sendBuf),
+      [=,&B]( const T* recvBuf )
+      {
+          util::ColStridedUnpack<T,Device::CPU>
+          ( height, localWidth, colAlign, colStride,
+            recvBuf, portionSize,
+            B.Buffer(), B.LDim() );
+      } );
+    return true;
+}
+
+// (Partial(U),PartialUnionRow(U,V)) |-> (U,V), e.g., [MC,MR] -> [VC,* ]
+template<typename T>
+bool ColAllToAllDemote
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B, CopyHandle<T>& handle )
+{
+    EL_DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.AlignColsAndResize( A.ColAlign(), height, width, false, false );
+    const Int colStridePart = B.PartialColStride();
+    if( Mod(B.ColAlign(),colStridePart) != A.ColAlign() )
+        return false;
+    if( !B.Participating() )
+        return true;
+
+    const Int colAlign = B.ColAlign();
+    const Int rowAlignA = A.RowAlign();
+    const Int colStride = B.ColStride();
+    const Int colStrideUnion = B.PartialUnionColStride();
+    const Int localHeightB = B.LocalHeight();
+    const Int portionSize =
+      mpi::Pad( MaxLength(height,colStride)*MaxLength(width,colStrideUnion) );
+
+    vector<T> sendBuf( colStrideUnion*portionSize );
+    util::PartialColStridedPack<T,Device::CPU>
+    ( height, A.LocalWidth(),
+      colAlign, colStride,
+      colStrideUnion, colStridePart, B.PartialColRank(),
+      A.ColShift(),
+      A.LockedBuffer(), A.LDim(),
+      sendBuf.data(),   portionSize );
+
+    handle.Start
+    ( B.PartialUnionColComm(), portionSize, true, std::move(sendBuf),
+      [=,&B]( const T* recvBuf )
+      {
+          util::RowStridedUnpack<T,Device::CPU>
+          ( localHeightB, width, rowAlignA, colStrideUnion,
+            recvBuf, portionSize,
+            B.Buffer(), B.LDim() );
+      } );
+    return true;
+}
+
+// (U,V) |-> (Partial(U),PartialUnionRow(U,V)), e.g., [VC,* ] -> [MC,MR]
+template<typename T>
+bool ColAllToAllPromote
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B, CopyHandle<T>& handle )
+{
+    EL_DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Int colStridePart = A.PartialColStride();
+    B.AlignColsAndResize
+    ( Mod(A.ColAlign(),B.ColStride()), height, width, false, false );
+    if( B.ColAlign() != Mod(A.ColAlign(),colStridePart) )
+        return false;
+    if( !B.Participating() )
+        return true;
+
+    const Int colAlignA = A.ColAlign();
+    const Int colStride = A.ColStride();
+    const Int colStrideUnion = A.PartialUnionColStride();
+    const Int colRankPart = A.PartialColRank();
+    const Int colShiftB = B.ColShift();
+    const Int localWidthB = B.LocalWidth();
+    const Int portionSize =
+      mpi::Pad( MaxLength(height,colStride)*MaxLength(width,colStrideUnion) );
+
+    vector<T> sendBuf( colStrideUnion*portionSize );
+    util::RowStridedPack<T,Device::CPU>
+    ( A.LocalHeight(), width,
+      B.RowAlign(), colStrideUnion,
+      A.LockedBuffer(), A.LDim(),
+      sendBuf.data(),   portionSize );
+
+    handle.Start
+    ( A.PartialUnionColComm(), portionSize, true, std::move(sendBuf),
+      [=,&B]( const T* recvBuf )
+      {
+          util::PartialColStridedUnpack<T,Device::CPU>
+          ( height, localWidthB,
+            colAlignA, colStride,
+            colStrideUnion, colStridePart, colRankPart,
+            colShiftB,
+            recvBuf,    portionSize,
+            B.Buffer(), B.LDim() );
+      } );
+    return true;
+}
+
+} // namespace async
+} // namespace copy
+
+template<typename T>
+CopyHandle<T> CopyAsync( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    CopyHandle<T> handle;
+    const Dist colDistA = A.ColDist(), rowDistA = A.RowDist();
+    const Dist colDistB = B.ColDist(), rowDistB = B.RowDist();
+    const bool sameGrid = &A.Grid() == &B.Grid();
+    const bool onCPU = A.GetLocalDevice() == Device::CPU &&
+                       B.GetLocalDevice() == Device::CPU;
+    const bool standard =
+      (colDistA == MC && rowDistA == MR) || (colDistA == MR && rowDistA == MC);
+    bool started = false;
+    // Node-shared targets must only be written by their node leaders, which
+    // the synchronous redistributions take care of
+    if( sameGrid && onCPU && A.CrossComm() == mpi::COMM_SELF &&
+        !B.NodeShared() )
+    {
+        if( colDistB == colDistA && rowDistB == STAR && rowDistA != STAR )
+            started = copy::async::RowAllGather( A, B, handle );
+        else if( rowDistB == rowDistA && colDistB == STAR && colDistA != STAR )
+            started = copy::async::ColAllGather( A, B, handle );
+        else if( standard && rowDistB == STAR &&
+                 colDistB == (colDistA == MC ? VC : VR) )
+            started = copy::async::ColAllToAllDemote( A, B, handle );
+        else if( rowDistA == STAR && (colDistA == VC || colDistA == VR) &&
+                 colDistB == (colDistA == VC ? MC : MR) &&
+                 rowDistB == (colDistA == VC ? MR : MC) )
+            started = copy::async::ColAllToAllPromote( A, B, handle );
+    }
+    if( !started )
+        B = A;
+    return handle;
+}
+
+#ifdef EL_INSTANTIATE_BLAS_LEVEL1
+# define EL_EXTERN
+#else
+# define EL_EXTERN extern
+#endif
+
+#define PROTO(T) \
+  EL_EXTERN template class CopyHandle<T>; \
+  EL_EXTERN template CopyHandle<T> CopyAsync \
+  ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+#undef EL_EXTERN
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPYASYNC_HPP
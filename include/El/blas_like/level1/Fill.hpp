@@ -63,6 +63,18 @@ template<typename T>
 void Fill( AbstractDistMatrix<T>& A, T alpha )
 {
     EL_DEBUG_CSE
+    // Only the node leader writes the single copy of node-shared storage
+    if( A.Wrap() == ELEMENT )
+    {
+        auto& AElem = static_cast<ElementalMatrix<T>&>(A);
+        if( AElem.NodeShared() )
+        {
+            if( AElem.NodeLeader() )
+                Fill( A.Matrix(), alpha );
+            AElem.NodeBarrier();
+            return;
+        }
+    }
     Fill( A.Matrix(), alpha );
 }
 
@@ -72,6 +72,18 @@ template<typename T>
 void Zero( AbstractDistMatrix<T>& A )
 {
     EL_DEBUG_CSE
+    // Only the node leader writes the single copy of node-shared storage
+    if( A.Wrap() == ELEMENT )
+    {
+        auto& AElem = static_cast<ElementalMatrix<T>&>(A);
+        if( AElem.NodeShared() )
+        {
+            if( AElem.NodeLeader() )
+                Zero( A.Matrix() );
+            AElem.NodeBarrier();
+            return;
+        }
+    }
     Zero( A.Matrix() );
 }
 
@@ -118,6 +118,51 @@ template<typename Ring>
 void AxpyContract
 ( Ring alpha, const BlockMatrix<Ring>& A, BlockMatrix<Ring>& B );
 
+// AxpyContractAsync
+// =================
+// An update B += alpha Contract(A) started by AxpyContractAsync. A is packed
+// before AxpyContractAsync returns (and may then be modified), but the
+// storage of B must remain alive until Test() returns true or Wait()
+// returns, which is when B is updated; destroying a pending handle waits
+// for it.
+template<typename T>
+class ContractHandle
+{
+public:
+    ContractHandle() { }
+    ContractHandle( ContractHandle<T>&& handle );
+    ContractHandle<T>& operator=( ContractHandle<T>&& handle );
+    ~ContractHandle();
+
+    // Make progress and return whether B has now been updated
+    bool Test();
+    void Wait();
+    bool Completed() const EL_NO_EXCEPT { return !pending_; }
+
+    // Sum the portionSize-entry portions of sendBuf over the communicator
+    // and call update on the portion which this process receives
+    void Start
+    ( mpi::Comm comm, Int portionSize,
+      vector<T>&& sendBuf, std::function<void(const T*)> update );
+
+private:
+    bool pending_=false;
+    vector<T> sendBuf_, recvBuf_;
+    mpi::Request<T> request_;
+    std::function<void(const T*)> update_;
+
+    void Finish();
+};
+
+// Post the packing and the nonblocking reduce-scatter of
+// B += alpha Contract(A) and return immediately. [U,Collect(V)] -> [U,V]
+// and [Collect(U),V] -> [U,V] between aligned CPU matrices are asynchronous;
+// every other case is performed with AxpyContract before returning an
+// already completed handle.
+template<typename T>
+ContractHandle<T> AxpyContractAsync
+( T alpha, const ElementalMatrix<T>& A, ElementalMatrix<T>& B );
+
 // AxpyTrapezoid
 // =============
 template<typename Ring1,typename Ring2>
@@ -389,6 +434,58 @@ template<typename T>
 void CopyFromNonRoot( DistMatrix<T,CIRC,CIRC,BLOCK>& B,
   bool includingViewers=false );
 
+// CopyAsync
+// =========
+// A redistribution started by CopyAsync. Both matrices must remain alive
+// (and must not be modified) until Test() returns true or Wait() returns;
+// destroying a pending handle waits for it.
+template<typename T>
+class CopyHandle
+{
+public:
+    CopyHandle() { }
+    CopyHandle( CopyHandle<T>&& handle );
+    CopyHandle<T>& operator=( CopyHandle<T>&& handle );
+    ~CopyHandle();
+
+    // Make progress and return whether the target now holds the result
+    bool Test();
+    void Wait();
+    bool Completed() const EL_NO_EXCEPT { return !pending_; }
+
+    // Exchange portionSize entries with every process in the communicator
+    // (either the same portion of sendBuf, or the q'th one when allToAll is
+    // true) and call unpack on the received portions once they all arrive.
+    // This is a nonblocking all-gather (or all-to-all) when MPI supports
+    // nonblocking collectives and otherwise p-1 pairs of point-to-point
+    // messages over a private duplicate of comm; either way, any number of
+    // handles may be outstanding at once, but each communicator's handles
+    // must be started in the same order by all of its processes.
+    void Start
+    ( mpi::Comm comm, Int portionSize, bool allToAll,
+      vector<T>&& sendBuf, std::function<void(const T*)> unpack );
+
+private:
+    // The duplicate used by the point-to-point fallback
+    mpi::Comm comm_=mpi::COMM_NULL;
+
+    bool pending_=false;
+    vector<T> sendBuf_, recvBuf_;
+    vector<mpi::Request<T>> requests_;
+    vector<bool> completed_;
+    std::function<void(const T*)> unpack_;
+
+    void Finish();
+};
+
+// Post the packing and the nonblocking communication of B := A and return
+// immediately. [U,V] -> [U,* ], [U,V] -> [* ,V] and [MC,MR] <-> [VC,* ]
+// (and [MR,MC] <-> [VR,* ]) between aligned CPU matrices on the same grid
+// are asynchronous; every other redistribution is performed with Copy
+// before returning an already completed handle.
+template<typename T>
+CopyHandle<T> CopyAsync( const ElementalMatrix<T>& A, ElementalMatrix<T>& B );
+
 
 namespace copy {
 namespace util {
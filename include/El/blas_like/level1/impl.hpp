@@ -12,6 +12,7 @@
 #include <El/blas_like/level1/AllReduce.hpp>
 #include <El/blas_like/level1/Axpy.hpp>
 #include <El/blas_like/level1/AxpyContract.hpp>
+#include <El/blas_like/level1/AxpyContractAsync.hpp>
 #include <El/blas_like/level1/AxpyTrapezoid.hpp>
 #include <El/blas_like/level1/Broadcast.hpp>
 #include <El/blas_like/level1/Concatenate.hpp>
@@ -20,6 +21,7 @@
 #include <El/blas_like/level1/ConjugateSubmatrix.hpp>
 #include <El/blas_like/level1/Contract.hpp>
 #include <El/blas_like/level1/Copy.hpp>
+#include <El/blas_like/level1/CopyAsync.hpp>
 #include <El/blas_like/level1/DiagonalScale.hpp>
 #include <El/blas_like/level1/DiagonalScaleTrapezoid.hpp>
 #include <El/blas_like/level1/DiagonalSolve.hpp>
@@ -19,17 +19,8 @@ template<typename T> Int LocalTrr2kBlocksize();
 
 // Gemm
 // ====
-namespace GemmAlgorithmNS {
-enum GemmAlgorithm {
-  GEMM_DEFAULT,
-  GEMM_SUMMA_A,
-  GEMM_SUMMA_B,
-  GEMM_SUMMA_C,
-  GEMM_SUMMA_DOT,
-  GEMM_CANNON
-};
-}
-using namespace GemmAlgorithmNS;
+// NOTE: GemmAlgorithm is defined in El/core/types.hpp so that grids can be
+//       tailored to the Gemm variants (see Grid::Suggest)
 
 template<typename T>
 void Gemm
@@ -61,17 +52,24 @@ void Gemm
 ( Orientation orientA, Orientation orientB,
   T alpha, const Matrix<T,D>& A, const Matrix<T,D>& B, Matrix<T,D>& C );
 
+// GEMM_2_5D splits the grid into numLayers layers which each multiply a
+// block of the inner dimension before the results are summed (zero selects
+// the largest number of layers c which divides the grid size p with
+// c^3 <= p, which GEMM_3D always uses). The other algorithms ignore
+// numLayers.
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
   T alpha, const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
-  T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
+  T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT,
+  int numLayers=0 );
 
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
   T alpha, const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
-                 AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
+                 AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT,
+  int numLayers=0 );
 
 template<typename T>
 void LocalGemm
@@ -86,6 +84,57 @@ void LocalGemm
            const AbstractDistMatrix<T>& B,
                  AbstractDistMatrix<T>& C );
 
+// Gemm autotuning
+// ---------------
+// Distributed Gemm calls with GEMM_DEFAULT are grouped into classes by their
+// orientations, datatype, grid shape and order, and the powers of two
+// bounding m, n, and k. A class with a recorded tuning uses its variant and
+// algorithmic blocksize rather than the built-in heuristics.
+//
+// If autotuning is enabled, the first call in an untuned class times each
+// candidate on the call's operands (into a scratch C) and records the
+// fastest. Every process of the grid records the same winner.
+//
+// Initialize() enables autotuning if EL_GEMM_AUTOTUNE is set and loads the
+// tuning file named by EL_GEMM_TUNING_FILE (if it exists); Finalize() then
+// saves the tunings back into the file.
+struct GemmTuning
+{
+    GemmAlgorithm alg=GEMM_DEFAULT;
+    Int blocksize=0;
+};
+
+void EnableGemmAutotuning( bool enable=true ) EL_NO_EXCEPT;
+bool GemmAutotuningEnabled() EL_NO_EXCEPT;
+
+// The root of the communicator reads the file and broadcasts the tunings
+void LoadGemmTuning
+( const string& filename, mpi::Comm comm=mpi::COMM_WORLD );
+// Only the root of the communicator writes the file, with one class per line
+// in the form "NN double 2x2 C 64 64 128 SUMMA_C 256" (the grid order is C
+// for column-major and R for row-major)
+void SaveGemmTuning
+( const string& filename, mpi::Comm comm=mpi::COMM_WORLD );
+void ClearGemmTuning();
+Int NumGemmTunings() EL_NO_EXCEPT;
+
+template<typename T>
+bool LookupGemmTuning
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& grid, GemmTuning& tuning );
+template<typename T>
+void RecordGemmTuning
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& grid, const GemmTuning& tuning );
+
+// Time the candidates for the given class on random operands and record the
+// winner (replacing any previous tuning); must be called by every process
+// of the grid
+template<typename T>
+GemmTuning TuneGemm
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& grid );
+
 // Hemm
 // ====
 template<typename T>
@@ -263,6 +263,7 @@ template<typename T> struct IsStdField<Complex<T>>
 
 #include <El/core/limits.hpp>
 
+#include <El/core/Memory/arena.hpp>
 #include <El/core/Device.hpp>
 
 #include <El/core/Memory.hpp>
@@ -292,6 +293,7 @@ class DistMatrix;
 #include <El/core/Matrix/impl.hpp>
 #include <El/core/Grid.hpp>
 #include <El/core/DistMatrix.hpp>
+#include <El/core/RedistributionPlan.hpp>
 #include <El/core/Proxy.hpp>
 #include <El/core/ProxyDevice.hpp>
 
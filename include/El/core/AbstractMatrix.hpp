@@ -36,6 +36,13 @@ public:
 
     void ShallowSwap(AbstractMatrix<T>& A);
 
+    // Capacity management: Reserve guarantees room for numEntries entries
+    // (preserving the current contents) so that subsequent resizes which fit
+    // do not reallocate, while ShrinkToFit releases any excess
+    void Reserve(Int numEntries);
+    Int Capacity() const EL_NO_EXCEPT;
+    void ShrinkToFit();
+
     // Advanced functions
     void SetViewType(El::ViewType viewType) EL_NO_EXCEPT;
     El::ViewType ViewType() const EL_NO_EXCEPT;
@@ -149,6 +156,8 @@ private:
     virtual Device do_get_device_() const EL_NO_EXCEPT = 0;
     virtual void do_empty_(bool freeMemory) = 0;
     virtual void do_resize_() = 0;
+    virtual void do_reserve_(Int numEntries) = 0;
+    virtual void do_shrink_to_fit_() = 0;
 
 private:
 
@@ -276,6 +285,27 @@ inline void AbstractMatrix<T>::Resize_(
     }
 }
 
+template <typename T>
+inline void AbstractMatrix<T>::Reserve(Int numEntries)
+{
+    EL_DEBUG_CSE
+    if (this->Viewing())
+        LogicError("Cannot reserve memory for a view");
+    do_reserve_(numEntries);
+}
+
+template <typename T>
+inline Int AbstractMatrix<T>::Capacity() const EL_NO_EXCEPT
+{ return this->do_get_memory_size_(); }
+
+template <typename T>
+inline void AbstractMatrix<T>::ShrinkToFit()
+{
+    EL_DEBUG_CSE
+    if (!this->Viewing())
+        do_shrink_to_fit_();
+}
+
 template <typename T>
 void AbstractMatrix<T>::ShallowSwap(AbstractMatrix<T>& A)
 {
@@ -62,15 +62,42 @@ public:
     }
 
     simple_buffer(size_t size, T const& value)
-        : vec_(size, value)
     {
-        data_ = vec_.data();
+        this->allocate(size);
+        if (arenaBytes_ > 0)
+            std::fill_n(data_, size, value);
+        else
+        {
+            vec_.assign(size, value);
+            data_ = vec_.data();
+        }
     }
 
+    simple_buffer(simple_buffer const&) = delete;
+    simple_buffer& operator=(simple_buffer const&) = delete;
+
+    ~simple_buffer()
+    {
+        this->release_();
+    }
+
+    // Packed types are drawn from the calling thread's ScratchArena; other
+    // types (and requests the arena cannot hold) use a std::vector
     void allocate(size_t size)
     {
-        vec_.reserve(size);
+        this->release_();
         size_ = size;
+        if (IsPacked<T>::value && size > 0)
+        {
+            data_ = static_cast<T*>(
+                ThreadScratchArena().Allocate(size*sizeof(T)));
+            if (data_)
+            {
+                arenaBytes_ = size*sizeof(T);
+                return;
+            }
+        }
+        vec_.reserve(size);
         data_ = vec_.data();
     }
 
@@ -97,14 +124,26 @@ public:
 
     void shallowCopyIfPossible(simple_buffer<T,Device::CPU>& A)
     {
+        this->release_();
         data_ = A.data();
         size_ = A.size();
     }
 
 private:
+    void release_()
+    {
+        if (arenaBytes_ > 0)
+        {
+            ThreadScratchArena().Free(data_, arenaBytes_);
+            arenaBytes_ = 0;
+        }
+        data_ = nullptr;
+    }
+
     T* data_ = nullptr;// To be used as VIEW ONLY.
     std::vector<T> vec_;
     size_t size_ = 0;
+    size_t arenaBytes_ = 0;
 };// class simple_buffer<T,Device::CPU>
 
 #ifdef HYDROGEN_HAVE_CUDA
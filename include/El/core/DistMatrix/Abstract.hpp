@@ -68,6 +68,12 @@ public:
 
     size_t AllocatedMemory() const EL_NO_EXCEPT;
 
+    // Local capacity management (see AbstractMatrix::Reserve); note that
+    // Reserve(numRemoteEntries) instead reserves room for queued updates
+    virtual void ReserveMemory(Int height, Int width) = 0;
+    Int Capacity() const EL_NO_EXCEPT;
+    void ShrinkToFit();
+
     Ring* Buffer() EL_NO_RELEASE_EXCEPT;
     Ring* Buffer(Int iLoc, Int jLoc) EL_NO_RELEASE_EXCEPT;
 
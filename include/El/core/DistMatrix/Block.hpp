@@ -52,6 +52,7 @@ public:
     void Empty(bool freeMemory=true) override;
     void Resize(Int height, Int width) override;
     void Resize(Int height, Int width, Int ldim) override;
+    void ReserveMemory(Int height, Int width) override;
 
     void MakeConsistent(bool includingViewers=false);
 
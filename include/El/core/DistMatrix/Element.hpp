@@ -40,6 +40,7 @@ public:
     // ==============================
     void Resize(Int height, Int width) override;
     void Resize(Int height, Int width, Int ldim) override;
+    void ReserveMemory(Int height, Int width) override;
 
     void MakeConsistent(bool includingViewers=false);
 
@@ -136,13 +137,117 @@ public:
     int DiagonalRoot(Int offset=0) const override EL_NO_EXCEPT;
     int DiagonalAlign(Int offset=0) const override EL_NO_EXCEPT;
 
+    // Streaming remote updates
+    // ========================
+    // Once numUpdates remote updates have been queued, they are combined and
+    // sent to their owners with nonblocking messages while the caller keeps
+    // queueing, so that ProcessQueues only needs to exchange the remainder.
+    // A threshold of zero (the default) disables streaming, which first
+    // processes the queues. Changing the threshold is collective over the
+    // viewing communicator of the grid, as is every call to ProcessQueues
+    // while streaming is enabled.
+    //
+    // At most maxPendingBytes of streamed updates are kept in flight: while a
+    // flush would exceed the limit it is deferred (after testing the
+    // outstanding sends) and the updates stay queued until a later flush or
+    // ProcessQueues. A single flush may exceed the limit when nothing else is
+    // in flight.
+    void SetRemoteUpdateFlushThreshold
+    (Int numUpdates, Int maxPendingBytes=Int(1)<<26);
+    Int RemoteUpdateFlushThreshold() const EL_NO_EXCEPT;
+
+    // Node-shared storage
+    // ===================
+    // Back the local matrix of a [* ,* ] matrix on the CPU with a single copy
+    // per shared-memory node (see Grid::NodeComm), which every process of the
+    // node reads directly. Redistributions into the matrix (including
+    // CopyAsync, which falls back to them), Zero, and Fill write each copy
+    // once from the node leader; any other modification must be made by the
+    // node leader alone and followed by NodeBarrier. Changing the setting,
+    // resizing, and destroying the matrix are collective over the grid.
+    void SetNodeShared(bool nodeShared);
+    bool NodeShared() const EL_NO_EXCEPT { return nodeShared_ != nullptr; }
+    // Whether this process writes to the node-shared copy (true for every
+    // process if the storage is not node-shared)
+    bool NodeLeader() const EL_NO_RELEASE_EXCEPT;
+    // Make the writes of the node leader visible to the rest of the node
+    void NodeBarrier() const;
+
 protected:
     // Protected constructors
     // ======================
     // Create a 0 x 0 distributed matrix
     ElementalMatrix(const El::Grid& g=Grid::Default(), int root=0);
 
+    // Remote update helpers
+    // =====================
+    // Sort a list of updates by column and then row and sum the values of
+    // updates to the same entry
+    static void CombineUpdates(vector<Entry<Ring>>& updates);
+
+    bool RemoteUpdateFlushDue(Int numQueued) const EL_NO_EXCEPT
+    { return stream_ && numQueued >= stream_->flushAt; }
+
+    // Send (and clear) a batch of queued remote updates and apply any
+    // streamed updates which have arrived in the meantime
+    void FlushRemoteUpdates(vector<Entry<Ring>>& updates);
+
+    // Wait for every update streamed since the last call and return (in local
+    // coordinates) those which still need to be applied to the first
+    // redundant copy and broadcast to the others. Does nothing unless
+    // streaming is enabled.
+    vector<Entry<Ring>> DrainRemoteUpdates();
+
 private:
+    struct PendingUpdateSend
+    {
+        vector<Entry<Ring>> buffer;
+        mpi::Request<Entry<Ring>> request;
+    };
+
+    struct RemoteUpdateStream
+    {
+        Int threshold=0;
+        // The number of queued updates which triggers the next flush (beyond
+        // the threshold while flushes are being deferred)
+        Int flushAt=0;
+        // The limit on, and the current number of, bytes in flight
+        Int maxPendingBytes=0;
+        Int pendingBytes=0;
+        // A private duplicate of the viewing communicator
+        mpi::Comm comm;
+        // Alternates between consecutive calls to ProcessQueues so that
+        // messages from a process which has already moved on are not
+        // mistaken for those of the current round
+        int tag=0;
+        // The number of messages sent to each process in this round and the
+        // number received from anyone
+        vector<int> numSent;
+        Int numReceived=0;
+        // The sends which are still in flight, oldest first
+        vector<PendingUpdateSend> sends;
+        // Received updates (in local coordinates) which are held back so that
+        // all redundant copies apply them identically
+        vector<Entry<Ring>> received;
+        Int numCombined=0;
+    };
+    std::unique_ptr<RemoteUpdateStream> stream_;
+
+    struct NodeSharedStorage
+    {
+        mpi::Window window;
+        Ring* buffer=nullptr;
+        Int capacity=0;
+    };
+    std::unique_ptr<NodeSharedStorage> nodeShared_;
+
+    void ResizeNodeShared(Int height, Int width, Int ldim);
+    void FreeNodeShared();
+
+    void ReceiveStreamedUpdates();
+    void ApplyStreamedUpdates(const vector<Entry<Ring>>& updates);
+    void CompleteStreamedSends();
+
     // Exchange metadata with another matrix
     // =====================================
     void ShallowSwap(type& A);
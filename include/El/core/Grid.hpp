@@ -12,6 +12,28 @@
 
 namespace El {
 
+// Machine parameters for Grid::Suggest: the latency (in seconds) and the
+// inverse bandwidth (in seconds per byte) between processes on the same node
+// and on different nodes, the time per flop, the size of a matrix entry, and
+// the algorithmic blocksize (zero selects Blocksize())
+struct GridCostModel
+{
+    double alphaIntra=1.e-6, betaIntra=1.e-10;
+    double alphaInter=5.e-6, betaInter=1.e-9;
+    double gamma=1.e-10;
+    Int entrySize=sizeof(double);
+    Int blocksize=0;
+};
+
+struct GridSuggestion
+{
+    int height;
+    GridOrder order;
+    GemmAlgorithm alg;
+    // The predicted runtime (in seconds)
+    double cost;
+};
+
 class Grid
 {
 public:
@@ -84,14 +106,70 @@ public:
     EL_NO_RELEASE_EXCEPT;
     int VCToViewing( int VCRank ) const EL_NO_EXCEPT;
 
+    // Node-aware interface
+    // The owning processes on our shared-memory node and the first owning
+    // process on each node (mpi::COMM_NULL for the other processes). These
+    // are determined on first use, which is collective over the owning
+    // processes.
+    mpi::Comm NodeComm() const EL_NO_EXCEPT;
+    mpi::Comm NodeLeaderComm() const EL_NO_EXCEPT;
+    int NodeRank() const EL_NO_RELEASE_EXCEPT;
+    int NodeSize() const EL_NO_RELEASE_EXCEPT;
+    int NumNodes() const EL_NO_RELEASE_EXCEPT;
+    // The node hierarchy of VCComm()
+    const mpi::NodeHierarchy& Nodes() const EL_NO_EXCEPT;
+    // Whether the collectives over the MC, MR, VC, and VR communicators
+    // combine data within each node before communicating between nodes.
+    // Changing this is collective over the owning processes.
+    void SetHierarchicalCollectives( bool hierarchical );
+    bool HierarchicalCollectives() const EL_NO_EXCEPT;
+    // The node hierarchy of MCComm(), MRComm(), VCComm(), or VRComm() if
+    // hierarchical collectives are enabled (and nullptr otherwise)
+    const mpi::NodeHierarchy* Hierarchy( mpi::Comm comm ) const EL_NO_EXCEPT;
+
+    // The precision in which the AllGathers and Broadcasts over the
+    // communicators of the grid ship float and double data (e.g., so that
+    // the panels of SUMMA travel as single precision while the local updates
+    // are still accumulated in double precision). Every process of the grid
+    // must use the same setting.
+    void SetTransport( TransportPrecision precision ) EL_NO_EXCEPT;
+    TransportPrecision Transport() const EL_NO_EXCEPT;
+
+    // Layered (2.5D and 3D) interface
+    // The owning processes split into numLayers layers of Size()/numLayers
+    // consecutive VC ranks, each of which forms a column-major grid of height
+    // DefaultHeight(Size()/numLayers). LayerGrid is the grid of the given
+    // layer as viewed by all of our viewing processes (so that matrices can
+    // be translated between it and this grid), whereas OwnLayerGrid is the
+    // grid of our own layer over only its members (so that the layers can
+    // compute independently). DepthComm joins the owning processes with the
+    // same rank in each layer, ordered by layer. All of these are formed on
+    // the first request for a given number of layers, which is collective
+    // over the viewing processes.
+    int Layer( int numLayers ) const EL_NO_RELEASE_EXCEPT;
+    const Grid& LayerGrid( int numLayers, int layer ) const;
+    const Grid& OwnLayerGrid( int numLayers ) const;
+    mpi::Comm DepthComm( int numLayers ) const;
+
 #ifdef EL_HAVE_SCALAPACK
     // TODO(poulson): More distribution contexts and handles
+    // (formed on first use, which is collective over the viewing processes)
     int BlacsVCHandle() const;
     int BlacsVRHandle() const;
     int BlacsMCMRContext() const;
 #endif
 
     static int DefaultHeight( int gridSize ) EL_NO_EXCEPT;
+    // The height and order of a grid over comm which minimize the runtime of
+    // C := alpha A B + beta C, with C m x n and A m x k, predicted by an
+    // alpha-beta-gamma model of the given SUMMA variant (or of the best of
+    // GEMM_SUMMA_A, GEMM_SUMMA_B, and GEMM_SUMMA_C for GEMM_DEFAULT). The
+    // collectives over the rows and columns of the grid are charged the
+    // node-local costs for the members which share a node. Collective over
+    // comm.
+    static GridSuggestion Suggest
+    ( mpi::Comm comm, Int m, Int n, Int k, GemmAlgorithm alg=GEMM_DEFAULT,
+      const GridCostModel& model=GridCostModel() );
 
     // To be used internally by Elemental
     static void InitializeDefault();
@@ -101,6 +179,25 @@ public:
     static const Grid& Default() EL_NO_RELEASE_EXCEPT;
     static const Grid& Trivial() EL_NO_RELEASE_EXCEPT;
 
+    // Process-wide grid cache
+    // A grid with the given height and order over a communicator (and owning
+    // group) congruent to the given one, which is only constructed (a
+    // collective operation) if no such grid has been requested before. Cached
+    // grids live until ClearCache or Finalize is called.
+    static const Grid& Cached
+    ( mpi::Comm comm, GridOrder order=COLUMN_MAJOR );
+    static const Grid& Cached
+    ( mpi::Comm comm, int height, GridOrder order=COLUMN_MAJOR );
+    static const Grid& Cached
+    ( mpi::Comm viewers, mpi::Group owners, int height,
+      GridOrder order=COLUMN_MAJOR );
+    static void ClearCache();
+    // The total time (in seconds) this process has spent constructing grids
+    // and their communicators, and the number of requests for cached grids
+    // which did not require constructing a new one
+    static double ConstructionTime() EL_NO_EXCEPT;
+    static Int NumCacheHits() EL_NO_EXCEPT;
+
 private:
     bool haveViewers_;
     int height_, size_, gcd_;
@@ -109,6 +206,9 @@ private:
 
     static Grid* defaultGrid;
     static Grid* trivialGrid;
+    static vector<std::unique_ptr<Grid>> cachedGrids;
+    static double constructionTime;
+    static Int numCacheHits;
 
     vector<int> diagsAndRanks_;
     vector<int> vcToViewing_;
@@ -120,8 +220,10 @@ private:
               owningComm_,
               cartComm_,
               mcComm_, mrComm_,
-              mdComm_, mdPerpComm_,
-              vcComm_, vrComm_;
+              vcComm_;
+    mpi::Comm mdComm_=mpi::COMM_NULL,
+              mdPerpComm_=mpi::COMM_NULL,
+              vrComm_=mpi::COMM_NULL;
 
     int viewingRank_,
         owningRank_,
@@ -129,12 +231,43 @@ private:
         mdRank_, mdPerpRank_,
         vcRank_, vrRank_;
 
+    bool hierarchical_=false;
+    mpi::NodeHierarchy mcNodes_, mrNodes_, vrNodes_;
+    mutable mpi::NodeHierarchy vcNodes_;
+    TransportPrecision transport_=TRANSPORT_FULL;
+
+    struct Layers
+    {
+        int numLayers;
+        vector<std::unique_ptr<Grid>> grids;
+        std::unique_ptr<Grid> ownGrid;
+        mpi::Comm depthComm=mpi::COMM_NULL;
+    };
+    mutable vector<std::unique_ptr<Layers>> layers_;
+
 #ifdef EL_HAVE_SCALAPACK
-    int blacsVCHandle_, blacsVRHandle_;
-    int blacsMCMRContext_;
+    mutable bool haveBlacs_=false;
+    mutable int blacsVCHandle_, blacsVRHandle_;
+    mutable int blacsMCMRContext_;
 #endif
 
     void SetUpGrid();
+    int VCToOwning( int vcRank ) const EL_NO_EXCEPT;
+    void CreateFromVCRanks
+    ( const vector<int>& vcRanks, int tag, mpi::Comm& comm ) const;
+    // Name the communicators for the communication profile, e.g., "2x3.MC"
+    void NameComm( mpi::Comm comm, const string& suffix ) const;
+    void NameComms
+    ( const mpi::NodeHierarchy& hierarchy, const string& suffix ) const;
+    void SetUpLazily( void (Grid::*setUp)() const ) const;
+    void SetUpVRComm();
+    void SetUpMDComm();
+    void SetUpMDPerpComm();
+    void SetUpNodes() const;
+    const Layers& SetUpLayers( int numLayers ) const;
+#ifdef EL_HAVE_SCALAPACK
+    void SetUpBlacs() const;
+#endif
 
     // Disable copying this class due to MPI_Comm/MPI_Group ownership issues
     // and potential performance loss from duplicating MPI communicators, e.g.,
@@ -162,6 +295,79 @@ inline void AssertSameGrids( const Grid& g1, const Grid& g2, Args&... args )
     AssertSameGrids( g2, args... );
 }
 
+namespace mpi {
+
+// Collectives over a communicator of the grid, which use the node hierarchy of
+// the communicator when the grid has hierarchical collectives enabled and the
+// transport precision of the grid (data which does not reside on the CPU is
+// always sent with the flat, full-precision collectives, and messages too
+// large for the int counts of the hierarchical collectives with the flat ones)
+
+template<Device D=Device::CPU,typename T>
+void AllGather
+( const T* sbuf, Int sc, T* rbuf, Int rc, Comm comm, const Grid& grid )
+EL_NO_RELEASE_EXCEPT
+{
+    const bool onCPU = ( D == Device::CPU );
+    const bool large =
+      sizeof(T)*size_t(rc)*size_t(Size(comm)) > size_t(GetMaxMessageCount());
+    auto hierarchy = ( !onCPU || large ? nullptr : grid.Hierarchy(comm) );
+    const auto precision = ( onCPU ? grid.Transport() : TRANSPORT_FULL );
+    if( hierarchy != nullptr )
+        AllGather( sbuf, sc, rbuf, rc, *hierarchy, precision );
+    else if( precision != TRANSPORT_FULL )
+        AllGather( sbuf, sc, rbuf, rc, comm, precision );
+    else
+        AllGather( sbuf, sc, rbuf, rc, comm );
+}
+
+template<Device D=Device::CPU,typename T>
+void Broadcast( T* buf, Int count, int root, Comm comm, const Grid& grid )
+EL_NO_RELEASE_EXCEPT
+{
+    if( D == Device::CPU && grid.Transport() != TRANSPORT_FULL )
+        Broadcast( buf, count, root, comm, grid.Transport() );
+    else
+        Broadcast( buf, count, root, comm );
+}
+
+template<Device D=Device::CPU,typename T>
+void AllReduce( T* buf, Int count, Op op, Comm comm, const Grid& grid )
+EL_NO_RELEASE_EXCEPT
+{
+    const bool flat = D != Device::CPU || count > GetMaxMessageCount();
+    auto hierarchy = ( flat ? nullptr : grid.Hierarchy(comm) );
+    if( hierarchy != nullptr )
+        AllReduce( buf, count, op, *hierarchy );
+    else
+        AllReduce( buf, count, op, comm );
+}
+
+template<Device D=Device::CPU,typename T>
+void ReduceScatter
+( T* sbuf, T* rbuf, int rc, Op op, Comm comm, const Grid& grid )
+EL_NO_RELEASE_EXCEPT
+{
+    auto hierarchy = ( D == Device::CPU ? grid.Hierarchy(comm) : nullptr );
+    if( hierarchy != nullptr )
+        ReduceScatter( sbuf, rbuf, rc, op, *hierarchy );
+    else
+        ReduceScatter( sbuf, rbuf, rc, op, comm );
+}
+
+template<Device D=Device::CPU,typename T>
+void ReduceScatter( T* buf, int rc, Op op, Comm comm, const Grid& grid )
+EL_NO_RELEASE_EXCEPT
+{
+    auto hierarchy = ( D == Device::CPU ? grid.Hierarchy(comm) : nullptr );
+    if( hierarchy != nullptr )
+        ReduceScatter( buf, rc, op, *hierarchy );
+    else
+        ReduceScatter( buf, rc, op, comm );
+}
+
+} // namespace mpi
+
 inline bool GridCompare
 ( const Grid & g1, const Grid & g2 )
 {
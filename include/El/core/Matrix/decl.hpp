@@ -185,6 +185,8 @@ private:
     // ==================================
     void do_empty_(bool freeMemory) override;
     void do_resize_() override;
+    void do_reserve_(Int numEntries) override;
+    void do_shrink_to_fit_() override;
 
     void Control_
     (Int height, Int width, Ring* buffer, Int leadingDimension);
@@ -350,6 +352,8 @@ private:
     Device do_get_device_() const EL_NO_EXCEPT override;
     void do_empty_(bool freeMemory) override;
     void do_resize_() override;
+    void do_reserve_(Int numEntries) override;
+    void do_shrink_to_fit_() override;
 
     void Attach_(
         Int height, Int width, Ring* buffer, Int leadingDimension) override;
@@ -605,6 +605,32 @@ void Matrix<Ring, Device::CPU>::do_resize_()
     data_ = memory_.Require(this->LDim() * this->Width());
 }
 
+template<typename Ring>
+void Matrix<Ring, Device::CPU>::do_reserve_(Int numEntries)
+{
+    if (numEntries <= Int(memory_.Size()))
+        return;
+    Memory<Ring,Device::CPU> newMemory(numEntries, memory_.Mode());
+    const Int numUsed = this->LDim() * this->Width();
+    if (data_ != nullptr && numUsed > 0)
+        MemCopy(newMemory.Buffer(), data_, numUsed);
+    memory_.ShallowSwap(newMemory);
+    data_ = memory_.Buffer();
+}
+
+template<typename Ring>
+void Matrix<Ring, Device::CPU>::do_shrink_to_fit_()
+{
+    const Int numUsed = this->LDim() * this->Width();
+    if (numUsed >= Int(memory_.Size()))
+        return;
+    Memory<Ring,Device::CPU> newMemory(numUsed, memory_.Mode());
+    if (numUsed > 0)
+        MemCopy(newMemory.Buffer(), data_, numUsed);
+    memory_.ShallowSwap(newMemory);
+    data_ = memory_.Buffer();
+}
+
 // For supporting duck typing
 // ==========================
 template<typename Ring>
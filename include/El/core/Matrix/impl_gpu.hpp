@@ -291,6 +291,44 @@ void Matrix<Ring, Device::GPU>::do_resize_()
     data_ = memory_.Require(this->LDim() * this->Width());
 }
 
+template<typename Ring>
+void Matrix<Ring, Device::GPU>::do_reserve_(Int numEntries)
+{
+    if (numEntries <= Int(memory_.Size()))
+        return;
+    Memory<Ring,Device::GPU> newMemory(numEntries, memory_.Mode());
+    const Int numUsed = this->LDim() * this->Width();
+    if (data_ != nullptr && numUsed > 0)
+    {
+        EL_CHECK_CUDA(cudaMemcpyAsync(newMemory.Buffer(), data_,
+                                      numUsed*sizeof(Ring),
+                                      cudaMemcpyDeviceToDevice,
+                                      GPUManager::Stream()));
+        EL_CHECK_CUDA(cudaStreamSynchronize(GPUManager::Stream()));
+    }
+    memory_.ShallowSwap(newMemory);
+    data_ = memory_.Buffer();
+}
+
+template<typename Ring>
+void Matrix<Ring, Device::GPU>::do_shrink_to_fit_()
+{
+    const Int numUsed = this->LDim() * this->Width();
+    if (numUsed >= Int(memory_.Size()))
+        return;
+    Memory<Ring,Device::GPU> newMemory(numUsed, memory_.Mode());
+    if (numUsed > 0)
+    {
+        EL_CHECK_CUDA(cudaMemcpyAsync(newMemory.Buffer(), data_,
+                                      numUsed*sizeof(Ring),
+                                      cudaMemcpyDeviceToDevice,
+                                      GPUManager::Stream()));
+        EL_CHECK_CUDA(cudaStreamSynchronize(GPUManager::Stream()));
+    }
+    memory_.ShallowSwap(newMemory);
+    data_ = memory_.Buffer();
+}
+
 template<typename Ring>
 Ring* Matrix<Ring, Device::GPU>::Buffer() EL_NO_RELEASE_EXCEPT
 {
@@ -10,6 +10,8 @@
 #define EL_MEMORY_HPP
 
 #include <El/core/Memory/decl.hpp>
+#include <El/core/Memory/pool.hpp>
+#include <El/core/Memory/numa.hpp>
 #include <El/core/Memory/impl.hpp>
 
 #endif // ifndef EL_MEMORY_HPP
@@ -0,0 +1,68 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_MEMORY_ARENA_HPP_
+#define EL_CORE_MEMORY_ARENA_HPP_
+
+namespace El
+{
+
+// A per-thread, stack-disciplined workspace for short-lived temporaries
+// (e.g., the pack buffers around collectives). Allocations are carved off
+// the top of a single contiguous block and released in LIFO order; once
+// every allocation has been released the whole block is available again.
+//
+// A request which does not fit returns nullptr (and the caller falls back to
+// the heap); the shortfall is remembered so that the block is grown to the
+// observed high-water mark -- up to ScratchArenaLimit() -- the next time the
+// arena is empty.
+class ScratchArena
+{
+public:
+    static constexpr size_t Alignment = 64;
+
+    void* Allocate( size_t numBytes );
+    void Free( void* ptr, size_t numBytes );
+
+    // Grow the block to at least 'numBytes' (capped at ScratchArenaLimit());
+    // this is only possible while there are no live allocations
+    void Reserve( size_t numBytes );
+
+    size_t Capacity() const EL_NO_EXCEPT { return capacity_; }
+    size_t Used() const EL_NO_EXCEPT { return top_; }
+    size_t HighWaterMark() const EL_NO_EXCEPT { return highWater_; }
+    size_t NumFallbacks() const EL_NO_EXCEPT { return numFallbacks_; }
+
+    ScratchArena() = default;
+    ScratchArena( const ScratchArena& ) = delete;
+    ScratchArena& operator=( const ScratchArena& ) = delete;
+    ~ScratchArena();
+private:
+    void Grow( size_t numBytes );
+
+    byte* buffer_=nullptr;
+    size_t capacity_=0;
+    size_t top_=0;
+    size_t numLive_=0;
+    size_t highWater_=0;
+    size_t numFallbacks_=0;
+};
+
+// The arena belonging to the calling thread
+ScratchArena& ThreadScratchArena();
+
+// Pre-size the calling thread's arena (e.g., at startup)
+void ReserveScratchArena( size_t numBytes );
+
+// The maximum number of bytes that any thread's arena may grow to
+size_t ScratchArenaLimit();
+void SetScratchArenaLimit( size_t numBytes );
+
+} // namespace El
+
+#endif // EL_CORE_MEMORY_ARENA_HPP_
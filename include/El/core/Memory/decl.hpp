@@ -12,10 +12,20 @@
 namespace El
 {
 
+// CPU memory modes:
+//   0: allocation with new[]
+//   1: CUDA pinned host memory (only available with CUDA support)
+//   2: 64-byte-aligned blocks recycled through HostMemoryPool()
+//   3: huge pages with parallel first touch for buffers of at least
+//      FirstTouchThreshold() bytes, otherwise as in mode 2
+// GPU memory modes:
+//   0: allocation with cudaMalloc
+//   1: CUB caching device allocator (only available with CUB support)
 template<typename G, Device D=Device::CPU>
 class Memory
 {
 public:
+    // Uses DefaultMemoryMode<D>()
     Memory();
     Memory(size_t size, unsigned int mode = 0);
     ~Memory();
@@ -42,6 +52,13 @@ private:
     unsigned int mode_;
 };// class Memory
 
+// Geometric growth policy: when Require must enlarge an existing buffer, it
+// allocates at least MemoryGrowthFactor() times the previous size so that a
+// sequence of growing requests only reallocates logarithmically often
+// (the default of 1 reallocates to exactly the requested size)
+double MemoryGrowthFactor();
+void SetMemoryGrowthFactor(double factor);
+
 } // namespace El
 
 #endif // ifndef EL_MEMORY_DECL_HPP
@@ -50,11 +50,40 @@ struct MemHelper<G,Device::CPU>
             }
             break;
 #endif // HYDROGEN_HAVE_CUDA
+        case 2:
+            {
+                // Aligned, pooled memory
+                ptr = static_cast<G*>
+                  (HostMemoryPool().Allocate(size*sizeof(G)));
+                if (!std::is_trivially_default_constructible<G>::value)
+                    for (size_t i=0; i<size; ++i)
+                        new (ptr+i) G;
+            }
+            break;
+        case 3:
+            {
+                // Huge pages with parallel first touch for large buffers
+                const size_t numBytes = size*sizeof(G);
+                if (numBytes >= FirstTouchThreshold())
+                {
+                    ptr = static_cast<G*>(FirstTouchAllocate(numBytes));
+                    if (!std::is_trivially_default_constructible<G>::value)
+                    {
+                        const Int numEntries = size;
+                        EL_PARALLEL_FOR
+                        for (Int i=0; i<numEntries; ++i)
+                            new (ptr+i) G;
+                    }
+                }
+                else
+                    ptr = New(size, 2);
+            }
+            break;
         default: RuntimeError("Invalid CPU memory allocation mode");
         }
         return ptr;
     }
-    static void Delete( G*& ptr, unsigned int mode )
+    static void Delete( G*& ptr, size_t size, unsigned int mode )
     {
         switch (mode) {
         case 0: delete[] ptr; break;
@@ -71,6 +100,24 @@ struct MemHelper<G,Device::CPU>
             }
             break;
 #endif // HYDROGEN_HAVE_CUDA
+        case 2:
+            {
+                // Aligned, pooled memory
+                if (!std::is_trivially_destructible<G>::value)
+                    for (size_t i=0; i<size; ++i)
+                        ptr[i].~G();
+                HostMemoryPool().Free(ptr, size*sizeof(G));
+            }
+            break;
+        case 3:
+            {
+                if (!std::is_trivially_destructible<G>::value)
+                    for (size_t i=0; i<size; ++i)
+                        ptr[i].~G();
+                if (!FirstTouchFree(ptr))
+                    HostMemoryPool().Free(ptr, size*sizeof(G));
+            }
+            break;
         default: RuntimeError("Invalid CPU memory deallocation mode");
         }
         ptr = nullptr;
@@ -120,7 +167,7 @@ struct MemHelper<G,Device::GPU>
         return ptr;
     }
 
-    static void Delete( G*& ptr, unsigned int mode )
+    static void Delete( G*& ptr, size_t size, unsigned int mode )
     {
         switch (mode) {
         case 0: EL_CHECK_CUDA(cudaFree(ptr)); break;
@@ -149,7 +196,8 @@ struct MemHelper<G,Device::GPU>
 
 template<typename G, Device D>
 Memory<G,D>::Memory()
-: size_(0), rawBuffer_(nullptr), buffer_(nullptr), mode_(0)
+: size_(0), rawBuffer_(nullptr), buffer_(nullptr),
+  mode_(DefaultMemoryMode<D>())
 { }
 
 template<typename G, Device D>
@@ -190,12 +238,13 @@ G* Memory<G,D>::Require(size_t size)
 {
     if(size > size_)
     {
+        if (size_ > 0)
+            size = Max(size, size_t(size_*MemoryGrowthFactor()));
         Empty();
 #ifndef EL_RELEASE
         try
         {
 #endif
-            // TODO: Optionally overallocate to force alignment of buffer_
             rawBuffer_ = MemHelper<G,D>::New(size, mode_);
             buffer_ = rawBuffer_;
             size_ = size;
@@ -230,7 +279,7 @@ void Memory<G,D>::Empty()
 {
     if(rawBuffer_ != nullptr)
     {
-        MemHelper<G,D>::Delete(rawBuffer_, mode_);
+        MemHelper<G,D>::Delete(rawBuffer_, size_, mode_);
     }
     buffer_ = nullptr;
     size_ = 0;
@@ -241,7 +290,7 @@ void Memory<G,D>::SetMode(unsigned int mode)
 {
     if (size_ > 0 && mode_ != mode)
     {
-        MemHelper<G,D>::Delete(rawBuffer_, mode_);
+        MemHelper<G,D>::Delete(rawBuffer_, size_, mode_);
         rawBuffer_ = MemHelper<G,D>::New(size_, mode);
         buffer_ = rawBuffer_;
     }
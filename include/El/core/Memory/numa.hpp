@@ -0,0 +1,36 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_MEMORY_NUMA_HPP_
+#define EL_CORE_MEMORY_NUMA_HPP_
+
+namespace El
+{
+
+// Buffers for CPU memory mode 3 which are at least FirstTouchThreshold()
+// bytes are mapped directly from the OS, backed by (transparent or, if
+// requested, explicit) huge pages and first touched by the OpenMP threads
+// using the same static schedule as the threaded level-1 kernels, so that
+// each thread's columns land on its own NUMA node. Smaller buffers are
+// served by HostMemoryPool().
+size_t FirstTouchThreshold();
+void SetFirstTouchThreshold( size_t numBytes );
+
+// Whether to first attempt explicit (hugetlbfs) huge pages before falling
+// back to transparent huge pages
+bool UsingExplicitHugePages();
+void SetUseExplicitHugePages( bool useExplicit );
+
+// Allocate a (huge-page-aligned) buffer and touch it in parallel
+void* FirstTouchAllocate( size_t numBytes );
+// Returns false if 'ptr' was not returned by FirstTouchAllocate
+bool FirstTouchFree( void* ptr );
+
+} // namespace El
+
+#endif // EL_CORE_MEMORY_NUMA_HPP_
@@ -0,0 +1,78 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_MEMORY_POOL_HPP_
+#define EL_CORE_MEMORY_POOL_HPP_
+
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace El
+{
+
+// Counters maintained by the host memory pool
+struct MemoryPoolStatistics
+{
+    size_t hits=0;        // requests satisfied by a cached block
+    size_t misses=0;      // requests which required a fresh allocation
+    size_t bytesInUse=0;  // bytes currently handed out by the pool
+    size_t bytesCached=0; // bytes held in the free lists
+    size_t peakBytes=0;   // high-water mark of bytesInUse+bytesCached
+};
+
+// A thread-safe cache of aligned host buffers. Requests are rounded up to a
+// size class (four classes per power of two, so that at most 25% of a block
+// is wasted) and released blocks are kept on a per-class free list until
+// ReleaseCached is called or the cache would exceed MaxCachedBytes.
+class CPUMemoryPool
+{
+public:
+    static constexpr size_t Alignment = 64;
+
+    void* Allocate( size_t numBytes );
+    void Free( void* ptr, size_t numBytes );
+
+    // Return all cached (i.e., currently unused) blocks to the system
+    void ReleaseCached();
+
+    void SetMaxCachedBytes( size_t maxCachedBytes );
+    size_t MaxCachedBytes() const;
+
+    MemoryPoolStatistics Statistics() const;
+    void ResetStatistics();
+
+    // The number of bytes actually reserved for a request of 'numBytes'
+    static size_t SizeClass( size_t numBytes ) EL_NO_EXCEPT;
+
+    ~CPUMemoryPool();
+private:
+    mutable std::mutex mutex_;
+    std::unordered_map<size_t,std::vector<void*>> freeLists_;
+    size_t maxCachedBytes_=std::numeric_limits<size_t>::max();
+    MemoryPoolStatistics stats_;
+};
+
+// Singleton instance used by Memory<G,Device::CPU> in pooled mode
+CPUMemoryPool& HostMemoryPool();
+// Return every cached block of the singleton instance to the system and stop
+// caching, so that blocks which are still in use when Elemental is finalized
+// are freed directly (and still accounted for) once they are released
+void DestroyHostMemoryPool();
+
+// The memory mode used by default-constructed Memory objects (and hence by
+// every Matrix, including the temporaries within distributed algorithms)
+template<Device D>
+unsigned int DefaultMemoryMode();
+template<Device D>
+void SetDefaultMemoryMode( unsigned int mode );
+
+} // namespace El
+
+#endif // EL_CORE_MEMORY_POOL_HPP_
@@ -0,0 +1,148 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_REDISTRIBUTIONPLAN_HPP
+#define EL_CORE_REDISTRIBUTIONPLAN_HPP
+
+#include <map>
+#include <mutex>
+
+namespace El {
+
+// Everything which determines the communication pattern of B = A between two
+// (arbitrary) distributions: the distribution metadata of both matrices
+// (which includes the alignments and the grids) and the global shape
+struct RedistributionKey
+{
+    DistData source, target;
+    Int height, width;
+
+    RedistributionKey() { }
+
+    template<typename S,typename T>
+    RedistributionKey
+    ( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B )
+    : source(A), target(B), height(A.Height()), width(A.Width())
+    { }
+};
+bool operator<( const RedistributionKey& a, const RedistributionKey& b );
+
+// The type-independent portion of a general-purpose redistribution from the
+// point of view of the calling process. Since the owner of entry (i,j) in
+// any distribution is determined separately by i and by j, the index maps
+// are stored per local row and per local column rather than per entry.
+//
+// When both matrices live on the same grid, only values are exchanged: each
+// process sends the entries destined for a particular process in
+// column-major order of their global indices, and the receiver recovers the
+// same order by walking its own local entries and asking which process owns
+// each of them in the source distribution.
+struct RedistributionPlan
+{
+    // Whether the exchange takes place over the viewing communicator of the
+    // target grid (rather than its VC communicator), in which case the
+    // entries are sent along with their target indices
+    bool includeViewers=false;
+    // Whether entries which this process owns in the target can be copied
+    // directly rather than through the exchange
+    bool copyLocally=false;
+
+    // For each local row (column) of the source matrix: the row (column)
+    // rank owning it in the target, and its local index there
+    vector<int> ownerRows, ownerCols;
+    vector<Int> targetRows, targetCols;
+    // The number of local rows of the source owned by each target row rank
+    vector<Int> ownerRowCounts;
+    // Maps a rank in the target's distribution communicator to the rank in
+    // the exchange communicator
+    vector<int> distToComm;
+
+    // For each local row (column) of the target matrix (on its first
+    // redundant copy): the row (column) rank owning it in the source, the
+    // corresponding histogram, and the map from source distribution ranks to
+    // the exchange communicator (only used when the grids coincide)
+    vector<int> sourceOwnerRows, sourceOwnerCols;
+    vector<Int> sourceOwnerRowCounts;
+    vector<int> sourceDistToComm;
+
+    // The number of entries sent to each process and the corresponding
+    // offsets (only used when the grids differ)
+    vector<int> sendCounts, sendOffs;
+    Int totalSend=0;
+};
+
+struct RedistributionPlanStatistics
+{
+    size_t hits=0;      // redistributions which reused a cached plan
+    size_t misses=0;    // redistributions which had to build a plan
+    size_t evictions=0; // plans discarded to respect MaxPlans()
+    size_t numPlans=0;  // plans currently cached
+};
+
+// A process-wide, thread-safe cache of redistribution plans. Using a cached
+// plan never changes the sequence of MPI calls, so different processes may
+// safely disagree about whether a particular redistribution hit the cache.
+class RedistributionPlanCache
+{
+public:
+    typedef std::shared_ptr<const RedistributionPlan> PlanPtr;
+
+    // Returns a null pointer (and records a miss) if no plan is cached
+    PlanPtr Find( const RedistributionKey& key );
+    PlanPtr Insert( const RedistributionKey& key, RedistributionPlan&& plan );
+
+    // Discard every plan (or only those involving the given grid)
+    void Clear();
+    void Invalidate( const Grid& grid );
+
+    // The least-recently used plan is evicted beyond this many plans
+    void SetMaxPlans( size_t maxPlans );
+    size_t MaxPlans() const;
+
+    void SetEnabled( bool enabled );
+    bool Enabled() const;
+
+    RedistributionPlanStatistics Statistics() const;
+    void ResetStatistics();
+
+private:
+    struct CachedPlan
+    {
+        PlanPtr plan;
+        size_t lastUse;
+    };
+
+    // Requires mutex_ to be held
+    void EvictLeastRecent();
+
+    mutable std::mutex mutex_;
+    std::map<RedistributionKey,CachedPlan> plans_;
+    size_t maxPlans_=256;
+    size_t useCounter_=0;
+    bool enabled_=true;
+    RedistributionPlanStatistics stats_;
+};
+
+// Singleton instance used by the general-purpose redistribution (safe to
+// access from multiple threads)
+RedistributionPlanCache& RedistributionPlans();
+// Drop every cached plan
+void DestroyRedistributionPlans();
+// Called when a grid is destroyed
+void InvalidateRedistributionPlans( const Grid& grid );
+
+// The (approximate) maximum number of entries that each process sends in a
+// single round of a general-purpose redistribution; larger redistributions
+// are split into rounds over blocks of columns so that the pack buffers
+// remain bounded
+Int RedistributionChunkSize();
+void SetRedistributionChunkSize( Int chunkSize );
+
+} // namespace El
+
+#endif // ifndef EL_CORE_REDISTRIBUTIONPLAN_HPP
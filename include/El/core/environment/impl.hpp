@@ -253,6 +253,9 @@ T Scan( const vector<T>& counts, vector<T>& offsets )
     T total = 0;
     for( size_t i=0; i<counts.size(); ++i )
     {
+        // Rather than silently wrapping around, e.g., int displacements
+        if( counts[i] > 0 && total > std::numeric_limits<T>::max()-counts[i] )
+            LogicError("The offsets of the counts overflow");
         offsets[i] = total;
         total += counts[i];
     }
@@ -15,6 +15,7 @@
 namespace El {
 
 using std::function;
+using std::string;
 using std::vector;
 
 namespace mpi {
@@ -22,6 +23,7 @@ namespace mpi {
 #if defined(EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES) || \
     defined(EL_HAVE_MPIX_NONBLOCKING_COLLECTIVES)
 #define EL_HAVE_NONBLOCKING 1
+#define EL_HAVE_NONBLOCKING_COLLECTIVES
 #else
 #define EL_HAVE_NONBLOCKING 0
 #endif
@@ -76,6 +78,16 @@ inline bool operator==( const Op& a, const Op& b ) EL_NO_EXCEPT
 inline bool operator!=( const Op& a, const Op& b ) EL_NO_EXCEPT
 { return a.op != b.op; }
 
+struct Window
+{
+    MPI_Win win;
+    Window( MPI_Win mpiWin=MPI_WIN_NULL ) EL_NO_EXCEPT : win(mpiWin) { }
+};
+inline bool operator==( const Window& a, const Window& b ) EL_NO_EXCEPT
+{ return a.win == b.win; }
+inline bool operator!=( const Window& a, const Window& b ) EL_NO_EXCEPT
+{ return a.win != b.win; }
+
 // Datatype definitions
 // TODO(poulson): Convert these to structs/classes
 typedef MPI_Aint Aint;
@@ -92,8 +104,10 @@ struct Request
     MPI_Request backend;
 
     vector<byte> buffer;
+    // The serialized input of a nonblocking collective on unpacked data
+    vector<byte> sendBuffer;
     bool receivingPacked=false;
-    int recvCount;
+    Int recvCount;
     T* unpackedRecvBuf;
 };
 
@@ -116,6 +130,7 @@ const Group GROUP_NULL = MPI_GROUP_NULL;
 const Comm COMM_NULL = MPI_COMM_NULL;
 const Comm COMM_SELF = MPI_COMM_SELF;
 const Comm COMM_WORLD = MPI_COMM_WORLD;
+const Window WIN_NULL = MPI_WIN_NULL;
 const ErrorHandler ERRORS_RETURN = MPI_ERRORS_RETURN;
 const ErrorHandler ERRORS_ARE_FATAL = MPI_ERRORS_ARE_FATAL;
 const Group GROUP_EMPTY = MPI_GROUP_EMPTY;
@@ -209,8 +224,16 @@ Op& MinLocPairOp() { return Types<Entry<T>>::minOp; }
 
 // Added constant(s)
 const int MIN_COLL_MSG = 1; // minimum message size for collectives
-inline int Pad( int count ) EL_NO_EXCEPT
-{ return std::max(count,MIN_COLL_MSG); }
+inline Int Pad( Int count ) EL_NO_EXCEPT
+{ return std::max(count,Int(MIN_COLL_MSG)); }
+
+// Messages of more than this many entries (by default, the largest int) are
+// sent as a single entry of a derived datatype, and reductions over more
+// entries are performed in pieces, so that the Int counts taken by SendRecv,
+// Broadcast, Gather, AllGather, Scatter, AllToAll and AllReduce are never
+// truncated. Lowering the limit is only useful for testing.
+void SetMaxMessageCount( Int maxCount );
+Int GetMaxMessageCount() EL_NO_EXCEPT;
 
 bool CommSameSizeAsInteger() EL_NO_EXCEPT;
 bool GroupSameSizeAsInteger() EL_NO_EXCEPT;
@@ -233,13 +256,54 @@ int Rank( Comm comm=COMM_WORLD ) EL_NO_RELEASE_EXCEPT;
 int Size( Comm comm=COMM_WORLD ) EL_NO_RELEASE_EXCEPT;
 void Create
 ( Comm parentComm, Group subsetGroup, Comm& subsetComm ) EL_NO_RELEASE_EXCEPT;
+// Only collective over the members of subsetGroup (requires MPI-3)
+void Create
+( Comm parentComm, Group subsetGroup, int tag, Comm& subsetComm )
+EL_NO_RELEASE_EXCEPT;
 void Dup( Comm original, Comm& duplicate ) EL_NO_RELEASE_EXCEPT;
 void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT;
+// Split into the subsets of processes which can share memory (each process
+// forms its own subset if MPI-3 shared memory is not supported)
+void SplitShared( Comm comm, int key, Comm& nodeComm ) EL_NO_RELEASE_EXCEPT;
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT;
 bool Congruent( Comm comm1, Comm comm2 ) EL_NO_RELEASE_EXCEPT;
 void ErrorHandlerSet
 ( Comm comm, ErrorHandler errorHandler ) EL_NO_RELEASE_EXCEPT;
 
+// The decomposition of a communicator into the processes on each
+// shared-memory node and the first process of each node (the leaders), which
+// allows for collectives which only send one message per node across the
+// network
+struct NodeHierarchy
+{
+    Comm nodeComm=COMM_NULL;   // the processes on our node
+    Comm leaderComm=COMM_NULL; // the leaders (COMM_NULL for non-leaders)
+    int node=0;                // the rank of our leader in leaderComm
+
+    // The number of processes on each node, the offset of each node within
+    // the node-ordered processes, and the rank within the original
+    // communicator of each of the node-ordered processes
+    vector<int> nodeSizes, nodeOffs, nodeOrder;
+    // Whether the node-ordered processes are simply the original ranks
+    bool contiguous=true;
+};
+// Collective over comm
+void Create( Comm comm, NodeHierarchy& hierarchy ) EL_NO_RELEASE_EXCEPT;
+void Free( NodeHierarchy& hierarchy ) EL_NO_RELEASE_EXCEPT;
+
+// Shared-memory windows
+// ---------------------
+// Allocate numBytes bytes which every process of nodeComm can directly access
+// (collective over nodeComm, whose processes must share a node). The window
+// stays in a passive-target epoch until it is freed.
+void AllocateShared
+( size_t numBytes, Comm nodeComm, Window& window ) EL_NO_RELEASE_EXCEPT;
+// The base of the memory allocated by the given rank of the window
+void* SharedBase( Window window, int rank ) EL_NO_RELEASE_EXCEPT;
+// Synchronize the public and private copies of the window
+void Sync( Window window ) EL_NO_RELEASE_EXCEPT;
+void Free( Window& window ) EL_NO_RELEASE_EXCEPT;
+
 // Cartesian communicator routines
 void CartCreate
 ( Comm comm, int numDims, const int* dimensions, const int* periods,
@@ -314,6 +378,20 @@ bool Test( Request<T>& request ) EL_NO_RELEASE_EXCEPT;
 bool IProbe
 ( int source, int tag, Comm comm, Status& status ) EL_NO_RELEASE_EXCEPT;
 
+// Many MPI implementations only advance nonblocking collectives from within
+// calls into the library, so that, without help, the communication meant to
+// overlap some local computation does not proceed until the final Wait.
+// Progress pokes the progress engine and is cheap enough to call between the
+// blocks of the overlapped computation. Alternatively (if MPI provides
+// THREAD_MULTIPLE support), a progress thread can call it every given number
+// of seconds; StartProgressThread returns whether the thread is running. The
+// environment variable EL_PROGRESS_THREAD, if set, starts the thread with its
+// value as the interval during Initialize.
+void Progress() EL_NO_RELEASE_EXCEPT;
+bool StartProgressThread( double interval=1.e-4 );
+void StopProgressThread();
+bool ProgressThreadRunning() EL_NO_EXCEPT;
+
 template<typename T>
 int GetCount( Status& status ) EL_NO_RELEASE_EXCEPT;
 
@@ -536,28 +614,28 @@ T IRecv( int from, Comm comm, Request<T>& request ) EL_NO_RELEASE_EXCEPT;
 template<typename Real,
          typename=EnableIf<IsPacked<Real>>>
 void TaggedSendRecv
-( const Real* sbuf, int sc, int to,   int stag,
-        Real* rbuf, int rc, int from, int rtag, Comm comm )
+( const Real* sbuf, Int sc, int to,   int stag,
+        Real* rbuf, Int rc, int from, int rtag, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 template<typename Real,
          typename=EnableIf<IsPacked<Real>>>
 void TaggedSendRecv
-( const Complex<Real>* sbuf, int sc, int to,   int stag,
-        Complex<Real>* rbuf, int rc, int from, int rtag, Comm comm )
+( const Complex<Real>* sbuf, Int sc, int to,   int stag,
+        Complex<Real>* rbuf, Int rc, int from, int rtag, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 template<typename T,
          typename=DisableIf<IsPacked<T>>,
          typename=void>
 void TaggedSendRecv
-( const T* sbuf, int sc, int to,   int stag,
-        T* rbuf, int rc, int from, int rtag, Comm comm )
+( const T* sbuf, Int sc, int to,   int stag,
+        T* rbuf, Int rc, int from, int rtag, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
 // If the tags are irrelevant
 template<typename T>
 void SendRecv
-( const T* sbuf, int sc, int to,
-        T* rbuf, int rc, int from, Comm comm ) EL_NO_RELEASE_EXCEPT;
+( const T* sbuf, Int sc, int to,
+        T* rbuf, Int rc, int from, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
 // If the send and recv counts are one
 template<typename T>
@@ -574,23 +652,23 @@ T SendRecv( T sb, int to, int from, Comm comm ) EL_NO_RELEASE_EXCEPT;
 template<typename Real,
          typename=EnableIf<IsPacked<Real>>>
 void TaggedSendRecv
-( Real* buf, int count, int to, int stag, int from, int rtag, Comm comm )
+( Real* buf, Int count, int to, int stag, int from, int rtag, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 template<typename Real,
          typename=EnableIf<IsPacked<Real>>>
 void TaggedSendRecv
-( Complex<Real>* buf, int count, int to, int stag, int from, int rtag,
+( Complex<Real>* buf, Int count, int to, int stag, int from, int rtag,
   Comm comm ) EL_NO_RELEASE_EXCEPT;
 template<typename T,
          typename=DisableIf<IsPacked<T>>,
          typename=void>
 void TaggedSendRecv
-( T* buf, int count, int to, int stag, int from, int rtag, Comm comm )
+( T* buf, Int count, int to, int stag, int from, int rtag, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
 // If the tags don't matter
 template<typename T>
-void SendRecv( T* buf, int count, int to, int from, Comm comm )
+void SendRecv( T* buf, Int count, int to, int from, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
 // Collective communication
@@ -600,16 +678,16 @@ EL_NO_RELEASE_EXCEPT;
 // ---------
 template<typename Real,
          typename=EnableIf<IsPacked<Real>>>
-void Broadcast( Real* buf, int count, int root, Comm comm )
+void Broadcast( Real* buf, Int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 template<typename Real,
          typename=EnableIf<IsPacked<Real>>>
-void Broadcast( Complex<Real>* buf, int count, int root, Comm comm )
+void Broadcast( Complex<Real>* buf, Int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 template<typename T,
          typename=DisableIf<IsPacked<T>>,
          typename=void>
-void Broadcast( T* buf, int count, int root, Comm comm )
+void Broadcast( T* buf, Int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
 // If the message length is one
@@ -648,18 +726,18 @@ void IBroadcast( T& b, int root, Comm comm, Request<T>& request );
 template<typename Real,
          typename=EnableIf<IsPacked<Real>>>
 void Gather
-( const Real* sbuf, int sc,
-        Real* rbuf, int rc, int root, Comm comm ) EL_NO_RELEASE_EXCEPT;
+( const Real* sbuf, Int sc,
+        Real* rbuf, Int rc, int root, Comm comm ) EL_NO_RELEASE_EXCEPT;
 template<typename Real,
          typename=EnableIf<IsPacked<Real>>>
 void  Gather
-( const Complex<Real>* sbuf, int sc,
-        Complex<Real>* rbuf, int rc, int root, Comm comm ) EL_NO_RELEASE_EXCEPT;
+( const Complex<Real>* sbuf, Int sc,
+        Complex<Real>* rbuf, Int rc, int root, Comm comm ) EL_NO_RELEASE_EXCEPT;
 template<typename T,
          typename=DisableIf<IsPacked<T>>,typename=void>
 void Gather
-( const T* sbuf, int sc,
-        T* rbuf, int rc, int root, Comm comm ) EL_NO_RELEASE_EXCEPT;
+( const T* sbuf, Int sc,
+        T* rbuf, Int rc, int root, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
 // Non-blocking gather
 // -------------------
@@ -708,25 +786,59 @@ void Gather
   int root, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
+#ifdef EL_USE_64BIT_INTS
+// With Int counts and displacements: if any count exceeds the maximum
+// message count or any displacement does not fit in an int, the messages
+// are instead exchanged point-to-point with SendRecv
+template<typename T>
+void Gather
+( const T* sbuf, Int sc,
+        T* rbuf, const Int* rcs, const Int* rds,
+  int root, Comm comm )
+EL_NO_RELEASE_EXCEPT;
+#endif
+
 // AllGather
 // ---------
 // NOTE: See the corresponding note for Gather on std::bad_alloc exceptions
 template<typename Real,
          typename=EnableIf<IsPacked<Real>>>
 void AllGather
-( const Real* sbuf, int sc,
-        Real* rbuf, int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
+( const Real* sbuf, Int sc,
+        Real* rbuf, Int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
 template<typename Real,
          typename=EnableIf<IsPacked<Real>>>
 void AllGather
-( const Complex<Real>* sbuf, int sc,
-        Complex<Real>* rbuf, int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
+( const Complex<Real>* sbuf, Int sc,
+        Complex<Real>* rbuf, Int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
 template<typename T,
          typename=DisableIf<IsPacked<T>>,
          typename=void>
 void AllGather
-( const T* sbuf, int sc,
-        T* rbuf, int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
+( const T* sbuf, Int sc,
+        T* rbuf, Int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
+
+// Non-blocking AllGather
+// ----------------------
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Real* sbuf, Int sc,
+        Real* rbuf, Int rc, Comm comm,
+  Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Complex<Real>* sbuf, Int sc,
+        Complex<Real>* rbuf, Int rc, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllGather
+( const T* sbuf, Int sc,
+        T* rbuf, Int rc, Comm comm,
+  Request<T>& request );
 
 // AllGather with variable recv sizes
 // ----------------------------------
@@ -751,41 +863,50 @@ void AllGather
         T* rbuf, const int* rcs, const int* rds, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
+#ifdef EL_USE_64BIT_INTS
+// With Int counts and displacements (see the corresponding Gather)
+template<typename T>
+void AllGather
+( const T* sbuf, Int sc,
+        T* rbuf, const Int* rcs, const Int* rds, Comm comm )
+EL_NO_RELEASE_EXCEPT;
+#endif
+
 // Scatter
 // -------
 template<typename Real,
          typename=EnableIf<IsPacked<Real>>>
 void Scatter
-( const Real* sbuf, int sc,
-        Real* rbuf, int rc, int root, Comm comm )
+( const Real* sbuf, Int sc,
+        Real* rbuf, Int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 template<typename Real,
          typename=EnableIf<IsPacked<Real>>>
 void Scatter
-( const Complex<Real>* sbuf, int sc,
-        Complex<Real>* rbuf, int rc, int root, Comm comm )
+( const Complex<Real>* sbuf, Int sc,
+        Complex<Real>* rbuf, Int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 template<typename T,
          typename=DisableIf<IsPacked<T>>,
          typename=void>
 void Scatter
-( const T* sbuf, int sc,
-        T* rbuf, int rc, int root, Comm comm )
+( const T* sbuf, Int sc,
+        T* rbuf, Int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
 // In-place option
 template<typename Real,
          typename=EnableIf<IsPacked<Real>>>
-void Scatter( Real* buf, int sc, int rc, int root, Comm comm )
+void Scatter( Real* buf, Int sc, Int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 template<typename Real,
          typename=EnableIf<IsPacked<Real>>>
-void Scatter( Complex<Real>* buf, int sc, int rc, int root, Comm comm )
+void Scatter( Complex<Real>* buf, Int sc, Int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 template<typename T,
          typename=DisableIf<IsPacked<T>>,
          typename=void>
-void Scatter( T* buf, int sc, int rc, int root, Comm comm )
+void Scatter( T* buf, Int sc, Int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
 // TODO(poulson): MPI_Scatterv support
@@ -796,20 +917,42 @@ EL_NO_RELEASE_EXCEPT;
 template<typename Real,
          typename=EnableIf<IsPacked<Real>>>
 void AllToAll
-( const Real* sbuf, int sc,
-        Real* rbuf, int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
+( const Real* sbuf, Int sc,
+        Real* rbuf, Int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
 template<typename Real,
          typename=EnableIf<IsPacked<Real>>>
 void AllToAll
-( const Complex<Real>* sbuf, int sc,
-        Complex<Real>* rbuf, int rc, Comm comm )
+( const Complex<Real>* sbuf, Int sc,
+        Complex<Real>* rbuf, Int rc, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 template<typename T,
          typename=DisableIf<IsPacked<T>>,
          typename=void>
 void AllToAll
-( const T* sbuf, int sc,
-        T* rbuf, int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
+( const T* sbuf, Int sc,
+        T* rbuf, Int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
+
+// Non-blocking AllToAll
+// ---------------------
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllToAll
+( const Real* sbuf, Int sc,
+        Real* rbuf, Int rc, Comm comm,
+  Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllToAll
+( const Complex<Real>* sbuf, Int sc,
+        Complex<Real>* rbuf, Int rc, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllToAll
+( const T* sbuf, Int sc,
+        T* rbuf, Int rc, Comm comm,
+  Request<T>& request );
 
 // AllToAll with non-uniform send/recv sizes
 // -----------------------------------------
@@ -834,6 +977,15 @@ void AllToAll
         T* rbuf, const int* rcs, const int* rds, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
+#ifdef EL_USE_64BIT_INTS
+// With Int counts and displacements (see the corresponding Gather)
+template<typename T>
+void AllToAll
+( const T* sbuf, const Int* scs, const Int* sds,
+        T* rbuf, const Int* rcs, const Int* rds, Comm comm )
+EL_NO_RELEASE_EXCEPT;
+#endif
+
 template<typename T>
 vector<T> AllToAll
 ( const vector<T>& sendBuf,
@@ -937,23 +1089,23 @@ void Reduce( T* buf, int count, int root, Comm comm ) EL_NO_RELEASE_EXCEPT;
 // ---------
 template<typename Real,
          typename=EnableIf<IsPacked<Real>>>
-void AllReduce( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
+void AllReduce( const Real* sbuf, Real* rbuf, Int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 template<typename Real,
          typename=EnableIf<IsPacked<Real>>>
 void AllReduce
-( const Complex<Real>* sbuf, Complex<Real>* rbuf, int count, Op op, Comm comm )
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, Int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 template<typename T,
          typename=DisableIf<IsPacked<T>>,
          typename=void>
-void AllReduce( const T* sbuf, T* rbuf, int count, Op op, Comm comm )
+void AllReduce( const T* sbuf, T* rbuf, Int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
 template<typename T,class OpClass,
          typename=DisableIf<IsData<OpClass>>>
 void AllReduce
-( const T* sb, T* rb, int count, OpClass op, bool commutative,
+( const T* sb, T* rb, Int count, OpClass op, bool commutative,
   Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
@@ -966,7 +1118,7 @@ EL_NO_RELEASE_EXCEPT
 
 // Default to SUM
 template<typename T>
-void AllReduce( const T* sbuf, T* rbuf, int count, Comm comm )
+void AllReduce( const T* sbuf, T* rbuf, Int count, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
 // If the message-length is one
@@ -993,22 +1145,22 @@ T AllReduce( T sb, Comm comm ) EL_NO_RELEASE_EXCEPT;
 // -----------------------
 template<typename Real,
          typename=EnableIf<IsPacked<Real>>>
-void AllReduce( Real* buf, int count, Op op, Comm comm )
+void AllReduce( Real* buf, Int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 template<typename Real,
          typename=EnableIf<IsPacked<Real>>>
-void AllReduce( Complex<Real>* buf, int count, Op op, Comm comm )
+void AllReduce( Complex<Real>* buf, Int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 template<typename T,
          typename=DisableIf<IsPacked<T>>,
          typename=void>
-void AllReduce( T* buf, int count, Op op, Comm comm )
+void AllReduce( T* buf, Int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
 template<typename T,class OpClass,
          typename=DisableIf<IsData<OpClass>>>
 void AllReduce
-( T* buf, int count, OpClass op, bool commutative, Comm comm )
+( T* buf, Int count, OpClass op, bool commutative, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     SetUserReduceFunc( function<T(const T&,const T&)>(op), commutative );
@@ -1020,7 +1172,42 @@ EL_NO_RELEASE_EXCEPT
 
 // Default to SUM
 template<typename T>
-void AllReduce( T* buf, int count, Comm comm ) EL_NO_RELEASE_EXCEPT;
+void AllReduce( T* buf, Int count, Comm comm ) EL_NO_RELEASE_EXCEPT;
+
+// Non-blocking AllReduce
+// ----------------------
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( const Real* sbuf, Real* rbuf, Int count, Op op, Comm comm,
+  Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, Int count, Op op,
+  Comm comm, Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllReduce
+( const T* sbuf, T* rbuf, Int count, Op op, Comm comm,
+  Request<T>& request );
+
+// Single-buffer option
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( Real* buf, Int count, Op op, Comm comm, Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( Complex<Real>* buf, Int count, Op op, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllReduce
+( T* buf, Int count, Op op, Comm comm, Request<T>& request );
 
 // ReduceScatter
 // -------------
@@ -1090,6 +1277,25 @@ EL_NO_RELEASE_EXCEPT
 template<typename T>
 void ReduceScatter( T* buf, int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking ReduceScatter
+// --------------------------
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IReduceScatter
+( const Real* sbuf, Real* rbuf, Int rc, Op op, Comm comm,
+  Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IReduceScatter
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, Int rc, Op op,
+  Comm comm, Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IReduceScatter
+( const T* sbuf, T* rbuf, Int rc, Op op, Comm comm,
+  Request<T>& request );
+
 // Variable-length ReduceScatter
 // -----------------------------
 template<typename Real,
@@ -1217,6 +1423,87 @@ EL_NO_RELEASE_EXCEPT
 template<typename T>
 void Scan( T* buf, int count, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Hierarchical collectives
+// ------------------------
+// These combine the contributions of the processes on each node, communicate
+// between the node leaders, and then distribute the results within each node.
+// The buffers are laid out exactly as for the corresponding collectives over
+// the communicator the hierarchy was created from.
+template<typename T>
+void AllGather
+( const T* sbuf, int sc, T* rbuf, int rc, const NodeHierarchy& hierarchy )
+EL_NO_RELEASE_EXCEPT;
+// The same, but with the result only stored on the node leaders
+template<typename T>
+void LeaderAllGather
+( const T* sbuf, int sc, T* rbuf, int rc, const NodeHierarchy& hierarchy )
+EL_NO_RELEASE_EXCEPT;
+// The same, but with the given number of entries from (and offset of the
+// result for) each rank of the original communicator, so that processes
+// can contribute nothing
+template<typename T>
+void LeaderAllGather
+( const T* sbuf, Int sc, T* rbuf, const Int* rcs, const Int* rds,
+  const NodeHierarchy& hierarchy ) EL_NO_RELEASE_EXCEPT;
+
+template<typename T>
+void AllReduce
+( const T* sbuf, T* rbuf, int count, Op op, const NodeHierarchy& hierarchy )
+EL_NO_RELEASE_EXCEPT;
+template<typename T>
+void AllReduce( T* buf, int count, Op op, const NodeHierarchy& hierarchy )
+EL_NO_RELEASE_EXCEPT;
+
+template<typename T>
+void ReduceScatter
+( const T* sbuf, T* rbuf, int rc, Op op, const NodeHierarchy& hierarchy )
+EL_NO_RELEASE_EXCEPT;
+// Single-buffer ReduceScatter (the result is stored at the front of buf)
+template<typename T>
+void ReduceScatter( T* buf, int rc, Op op, const NodeHierarchy& hierarchy )
+EL_NO_RELEASE_EXCEPT;
+
+// Reduced-precision collectives
+// -----------------------------
+// These convert the data into the given transport precision before it is
+// sent and back into T once it arrives. Every process (including the root)
+// is left with the converted data, so that the results agree everywhere.
+//
+// The flat versions send messages of any size; the hierarchical version falls
+// back to full precision when the converted data would not fit in an int
+// message count.
+template<typename T>
+void AllGather
+( const T* sbuf, Int sc, T* rbuf, Int rc, Comm comm,
+  TransportPrecision precision ) EL_NO_RELEASE_EXCEPT;
+template<typename T>
+void AllGather
+( const T* sbuf, Int sc, T* rbuf, Int rc, const NodeHierarchy& hierarchy,
+  TransportPrecision precision ) EL_NO_RELEASE_EXCEPT;
+template<typename T>
+void Broadcast
+( T* buf, Int count, int root, Comm comm, TransportPrecision precision )
+EL_NO_RELEASE_EXCEPT;
+
+// Whether the given transport precision changes how T is shipped
+template<typename T>
+bool ReducesTransport( TransportPrecision precision ) EL_NO_EXCEPT
+{
+    typedef Base<T> Real;
+    const bool isDouble = std::is_same<Real,double>::value;
+    const bool isFloat = std::is_same<Real,float>::value;
+    return ( precision == TRANSPORT_SINGLE && isDouble ) ||
+           ( precision == TRANSPORT_BFLOAT16 && (isDouble || isFloat) );
+}
+
+// Variable all-to-all exchanges
+// -----------------------------
+// The algorithm used by SparseAllToAll and by the AllToAll which exchanges
+// the counts (the default avoids MPI_Alltoallv when Elemental was configured
+// with EL_USE_CUSTOM_ALLTOALLV). It must agree across the processes.
+void SetAllToAllAlgorithm( AllToAllAlgorithm alg ) EL_NO_EXCEPT;
+AllToAllAlgorithm GetAllToAllAlgorithm() EL_NO_EXCEPT;
+
 template<typename T>
 void SparseAllToAll
 ( const vector<T>& sendBuffer,
@@ -1226,11 +1513,78 @@ void SparseAllToAll
   const vector<int>& recvCounts,
   const vector<int>& recvOffs,
         Comm comm ) EL_NO_RELEASE_EXCEPT;
+template<typename T>
+void SparseAllToAll
+( const vector<T>& sendBuffer,
+  const vector<int>& sendCounts,
+  const vector<int>& sendOffs,
+        vector<T>& recvBuffer,
+  const vector<int>& recvCounts,
+  const vector<int>& recvOffs,
+        Comm comm, AllToAllAlgorithm alg ) EL_NO_RELEASE_EXCEPT;
 
 void VerifySendsAndRecvs
 ( const vector<int>& sendCounts,
   const vector<int>& recvCounts, Comm comm );
 
+// Communication profiling
+// -----------------------
+// When enabled, every call through these wrappers is tallied by the
+// enclosing profile region, the name of the communicator, the operation, and
+// the power-of-two bucket of the number of bytes the calling process
+// contributes and obtains. A timeline of the calls is also kept for viewing
+// in a Chrome trace viewer (e.g., chrome://tracing or Perfetto). Calls may
+// be recorded from several threads; each thread has its own stack of regions
+// and its own row of the timeline.
+//
+// If a nonempty basename is given, the profile is written by WriteProfile
+// during Finalize. The environment variable EL_COMM_PROFILE, if set, enables
+// profiling with its value as the basename during Initialize.
+extern bool profilingEnabled;
+void EnableProfiling( const string& basename="" );
+void DisableProfiling() EL_NO_EXCEPT;
+inline bool Profiling() EL_NO_EXCEPT { return profilingEnabled; }
+const string& ProfileBasename() EL_NO_EXCEPT;
+void ClearProfile();
+// Collective over COMM_WORLD: each process writes its summary to
+// <basename>.<rank>.json and its timeline to <basename>.<rank>.trace.json,
+// and the root writes the summary reduced over every process to
+// <basename>.json
+void WriteProfile( const string& basename );
+
+// The name which communicators are reported under (the MPI name)
+void SetName( Comm comm, const string& name ) EL_NO_RELEASE_EXCEPT;
+string Name( Comm comm ) EL_NO_RELEASE_EXCEPT;
+
+// Attribute the communication within the current scope to the given region
+// (which must be a string literal or otherwise outlive the profile)
+class ProfileRegion
+{
+public:
+    explicit ProfileRegion( const char* name ) EL_NO_EXCEPT
+    : active_(Profiling())
+    { if( active_ ) Push( name ); }
+    ~ProfileRegion() { if( active_ ) Pop(); }
+
+    ProfileRegion( const ProfileRegion& ) = delete;
+    ProfileRegion& operator=( const ProfileRegion& ) = delete;
+private:
+    static void Push( const char* name ) EL_NO_EXCEPT;
+    static void Pop() EL_NO_EXCEPT;
+    bool active_;
+};
+
+#define EL_PROFILE_REGION_CAT_(a,b) a ## b
+#define EL_PROFILE_REGION_CAT(a,b) EL_PROFILE_REGION_CAT_(a,b)
+#define EL_PROFILE_REGION(name) \
+  El::mpi::ProfileRegion EL_PROFILE_REGION_CAT(elProfileRegion,__LINE__)(name);
+
+// Record a call made outside of these wrappers (e.g., by a shim around the
+// underlying MPI routine)
+void RecordCall
+( const char* op, MPI_Comm comm, double bytes, double start, double stop )
+EL_NO_EXCEPT;
+
 void CreateCustom() EL_NO_RELEASE_EXCEPT;
 void DestroyCustom() EL_NO_RELEASE_EXCEPT;
 
@@ -411,6 +411,50 @@ enum GridOrder
 }
 using namespace GridOrderNS;
 
+namespace GemmAlgorithmNS {
+enum GemmAlgorithm {
+  GEMM_DEFAULT,
+  GEMM_SUMMA_A,
+  GEMM_SUMMA_B,
+  GEMM_SUMMA_C,
+  GEMM_SUMMA_DOT,
+  GEMM_CANNON,
+  GEMM_SUMMA_C_LOOKAHEAD,
+  GEMM_2_5D,
+  GEMM_3D
+};
+std::string GemmAlgorithmToString( GemmAlgorithm alg );
+GemmAlgorithm StringToGemmAlgorithm( std::string s );
+}
+using namespace GemmAlgorithmNS;
+
+// The precision in which the collectives which support it ship float and
+// double data (and their complex counterparts); other types are always
+// shipped as they are
+namespace TransportPrecisionNS {
+enum TransportPrecision
+{
+    TRANSPORT_FULL,    // as is
+    TRANSPORT_SINGLE,  // double as float
+    TRANSPORT_BFLOAT16 // float and double as bfloat16
+};
+}
+using namespace TransportPrecisionNS;
+
+// The algorithm for exchanging variable amounts of data between every pair
+// of processes
+namespace AllToAllAlgorithmNS {
+enum AllToAllAlgorithm
+{
+    ALLTOALL_DEFAULT,  // chosen by the volume and sparsity of the exchange
+    ALLTOALL_NATIVE,   // MPI_Alltoallv
+    ALLTOALL_PAIRWISE, // p-1 rounds of exchanges between pairs of processes
+    ALLTOALL_BRUCK,    // log2(p) rounds which aggregate small messages
+    ALLTOALL_SPARSE    // all messages at once, only between actual partners
+};
+}
+using namespace AllToAllAlgorithmNS;
+
 namespace LeftOrRightNS {
 enum LeftOrRight
 {
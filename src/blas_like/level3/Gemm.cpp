@@ -8,11 +8,14 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like/level3.hpp>
+#include <El/matrices.hpp>
 
 #include "./Gemm/NN.hpp"
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
 #include "./Gemm/TT.hpp"
+#include "./Gemm/Cannon.hpp"
+#include "./Gemm/Layered.hpp"
 
 namespace El
 {
@@ -175,22 +178,30 @@ void Gemm (
     Gemm(orientA, orientB, alpha, A, B, T(0), C);
 }
 
+namespace gemm
+{
+
+// C += alpha op(A) op(B) with the given algorithm
 template<typename T>
-void Gemm
+void Dispatch
 (Orientation orientA, Orientation orientB,
   T alpha, const AbstractDistMatrix<T>& A,
            const AbstractDistMatrix<T>& B,
-  T beta,        AbstractDistMatrix<T>& C,
-  GemmAlgorithm alg)
+                 AbstractDistMatrix<T>& C,
+  GemmAlgorithm alg, int numLayers=0)
 {
     EL_DEBUG_CSE
-    C *= beta;
-    if(orientA == NORMAL && orientB == NORMAL)
+    if(alg == GEMM_2_5D)
+        gemm::Layered(orientA, orientB, alpha, A, B, C, numLayers);
+    else if(alg == GEMM_3D)
+        gemm::Layered
+        (orientA, orientB, alpha, A, B, C,
+          gemm::DefaultNumLayers(C.Grid().Size()));
+    else if(alg == GEMM_CANNON)
+        gemm::Cannon(orientA, orientB, alpha, A, B, C);
+    else if(orientA == NORMAL && orientB == NORMAL)
     {
-        if(alg == GEMM_CANNON)
-            gemm::Cannon_NN(alpha, A, B, C);
-        else
-            gemm::SUMMA_NN(alpha, A, B, C, alg);
+        gemm::SUMMA_NN(alpha, A, B, C, alg);
     }
     else if(orientA == NORMAL)
     {
@@ -206,19 +217,150 @@ void Gemm
     }
 }
 
+// Time each candidate variant and blocksize on the given operands (into a
+// scratch matrix distributed like C) and return the fastest. The slowest
+// process's time is used, so that every process picks the same winner.
+template<typename T>
+GemmTuning Autotune
+(Orientation orientA, Orientation orientB,
+  T alpha, const AbstractDistMatrix<T>& A,
+           const AbstractDistMatrix<T>& B,
+           const AbstractDistMatrix<T>& C)
+{
+    EL_DEBUG_CSE
+    const Grid& g = C.Grid();
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = (orientA == NORMAL ? A.Width() : A.Height());
+    const Int maxDim = Max(Max(m, n), k);
+    const GemmAlgorithm algs[] =
+      { GEMM_SUMMA_A, GEMM_SUMMA_B, GEMM_SUMMA_C, GEMM_SUMMA_C_LOOKAHEAD,
+        GEMM_CANNON };
+    const Int blocksizes[] = { 64, 128, 256, 512 };
+
+    std::unique_ptr<AbstractDistMatrix<T>>
+      CTrial(C.Construct(g, C.Root()));
+    CTrial->AlignWith(C.DistData());
+
+    // Warm up the caches and the grid's communicators
+    Zeros(*CTrial, m, n);
+    Dispatch(orientA, orientB, alpha, A, B, *CTrial, GEMM_SUMMA_C);
+
+    GemmTuning best;
+    double bestTime = limits::Infinity<double>();
+    Timer timer;
+    for (const GemmAlgorithm alg : algs)
+    {
+        for (Int j=0; j<4; ++j)
+        {
+            // Larger blocksizes would not change the algorithm (and
+            // Cannon's algorithm does not use one)
+            if (j > 0 && (alg == GEMM_CANNON || blocksizes[j-1] >= maxDim))
+                break;
+            Zeros(*CTrial, m, n);
+            PushBlocksizeStack(blocksizes[j]);
+            mpi::Barrier(g.ViewingComm());
+            timer.Start();
+            Dispatch(orientA, orientB, alpha, A, B, *CTrial, alg);
+            const double time =
+              mpi::AllReduce(timer.Stop(), mpi::MAX, g.ViewingComm());
+            PopBlocksizeStack();
+            if (time < bestTime)
+            {
+                bestTime = time;
+                best.alg = alg;
+                best.blocksize = blocksizes[j];
+            }
+        }
+    }
+    return best;
+}
+
+// Look up the tuning of this call's class, autotuning it on first encounter
+// if enabled. GPU calls are not autotuned since the timings would not
+// include the device work.
+template<typename T>
+bool FindTuning
+(Orientation orientA, Orientation orientB,
+  T alpha, const AbstractDistMatrix<T>& A,
+           const AbstractDistMatrix<T>& B,
+           const AbstractDistMatrix<T>& C,
+  GemmTuning& tuning)
+{
+    EL_DEBUG_CSE
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = (orientA == NORMAL ? A.Width() : A.Height());
+    if (LookupGemmTuning<T>(orientA, orientB, m, n, k, C.Grid(), tuning))
+        return true;
+    if (!GemmAutotuningEnabled() || m == 0 || n == 0 || k == 0 ||
+        C.GetLocalDevice() != Device::CPU)
+        return false;
+    tuning = Autotune(orientA, orientB, alpha, A, B, C);
+    RecordGemmTuning<T>(orientA, orientB, m, n, k, C.Grid(), tuning);
+    return true;
+}
+
+} // namespace gemm
+
 template<typename T>
 void Gemm
 (Orientation orientA, Orientation orientB,
   T alpha, const AbstractDistMatrix<T>& A,
            const AbstractDistMatrix<T>& B,
-                 AbstractDistMatrix<T>& C, GemmAlgorithm alg)
+  T beta,        AbstractDistMatrix<T>& C,
+  GemmAlgorithm alg, int numLayers)
+{
+    EL_DEBUG_CSE
+    C *= beta;
+    GemmTuning tuning;
+    if (alg == GEMM_DEFAULT &&
+        gemm::FindTuning(orientA, orientB, alpha, A, B, C, tuning))
+    {
+        PushBlocksizeStack(tuning.blocksize);
+        gemm::Dispatch(orientA, orientB, alpha, A, B, C, tuning.alg);
+        PopBlocksizeStack();
+    }
+    else
+        gemm::Dispatch(orientA, orientB, alpha, A, B, C, alg, numLayers);
+}
+
+template<typename T>
+void Gemm
+(Orientation orientA, Orientation orientB,
+  T alpha, const AbstractDistMatrix<T>& A,
+           const AbstractDistMatrix<T>& B,
+                 AbstractDistMatrix<T>& C, GemmAlgorithm alg,
+  int numLayers)
 {
     EL_DEBUG_CSE
     const Int m = (orientA==NORMAL ? A.Height() : A.Width());
     const Int n = (orientB==NORMAL ? B.Width() : B.Height());
     C.Resize(m, n);
     Zero(C);
-    Gemm(orientA, orientB, alpha, A, B, T(0), C, alg);
+    Gemm(orientA, orientB, alpha, A, B, T(0), C, alg, numLayers);
+}
+
+template<typename T>
+GemmTuning TuneGemm
+(Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& grid)
+{
+    EL_DEBUG_CSE
+    DistMatrix<T> A(grid), B(grid), C(grid);
+    if (orientA == NORMAL)
+        Uniform(A, m, k);
+    else
+        Uniform(A, k, m);
+    if (orientB == NORMAL)
+        Uniform(B, k, n);
+    else
+        Uniform(B, n, k);
+    Zeros(C, m, n);
+    const GemmTuning tuning =
+      gemm::Autotune(orientA, orientB, T(1), A, B, C);
+    RecordGemmTuning<T>(orientA, orientB, m, n, k, grid, tuning);
+    return tuning;
 }
 
 template<typename T>
@@ -380,12 +522,17 @@ template void Gemm(Orientation orientA, Orientation orientB,
   (Orientation orientA, Orientation orientB, \
     T alpha, const AbstractDistMatrix<T>& A, \
              const AbstractDistMatrix<T>& B, \
-    T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg); \
+    T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg, \
+    int numLayers); \
   template void Gemm \
   (Orientation orientA, Orientation orientB, \
     T alpha, const AbstractDistMatrix<T>& A, \
              const AbstractDistMatrix<T>& B, \
-                   AbstractDistMatrix<T>& C, GemmAlgorithm alg); \
+                   AbstractDistMatrix<T>& C, GemmAlgorithm alg, \
+    int numLayers); \
+  template GemmTuning TuneGemm<T> \
+  (Orientation orientA, Orientation orientB, Int m, Int n, Int k, \
+    const Grid& grid); \
   template void LocalGemm \
   (Orientation orientA, Orientation orientB, \
     T alpha, const AbstractDistMatrix<T>& A, \
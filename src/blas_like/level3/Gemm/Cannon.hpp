@@ -0,0 +1,220 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// Gather the equally-sized, contiguous blocks of buf over the members of
+// comm whose ranks are congruent to ours modulo the stride (block b belongs
+// to rank b*stride + rank % stride). The blocks travel around a ring so
+// that each process only exchanges data with two neighbours.
+template<typename T>
+void CannonRingGather(T* buf, Int blockSize, Int stride, mpi::Comm comm)
+{
+    EL_DEBUG_CSE
+    const Int rank = mpi::Rank(comm);
+    const Int numBlocks = mpi::Size(comm) / stride;
+    const Int offset = rank % stride;
+    const Int block = rank / stride;
+    const int to = Mod(block+1, numBlocks)*stride + offset;
+    const int from = Mod(block-1, numBlocks)*stride + offset;
+    for (Int step=1; step<numBlocks; ++step)
+    {
+        const Int sendBlock = Mod(block-step+1, numBlocks);
+        const Int recvBlock = Mod(block-step, numBlocks);
+        mpi::SendRecv
+        (&buf[sendBlock*blockSize], blockSize, to,
+          &buf[recvBlock*blockSize], blockSize, from, comm);
+    }
+}
+
+// Cannon's algorithm for C += alpha op(A) op(B)
+//
+// An r x c grid is treated as a tiling by virtual square sub-grids of
+// order gcd(r,c). Each process first gathers the local columns of op(A)
+// from the processes of its grid row with the same column within their
+// sub-grid, and likewise the local rows of op(B), so that the inner
+// dimension is distributed cyclically over each sub-grid. The classical
+// algorithm then runs within every sub-grid, with each circular shift of
+// the packages overlapped with the local update on the current ones. On a
+// square grid there is a single sub-grid and no gathering.
+//
+// op(A) and op(B) are read from [MC,MR] (normal) or [MR,MC] (transposed)
+// copies of A and B so that their local portions only need to be
+// transposed in memory.
+template<typename T>
+void Cannon
+(Orientation orientA, Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm::Cannon")
+
+    if (CPre.GetLocalDevice() != Device::CPU)
+        LogicError("Cannon not implemented for device!");
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx(CPre);
+    auto& C = CProx.Get();
+
+    const Grid& g = C.Grid();
+    const Int k = (orientA == NORMAL ? APre.Width() : APre.Height());
+    const Int r = g.Height();
+    const Int c = g.Width();
+    const Int gcd = g.GCD();
+    const Int row = g.Row();
+    const Int col = g.Col();
+    const Int localHeight = C.LocalHeight();
+    const Int localWidth = C.LocalWidth();
+
+    // The local portions of op(A) from the processes of our row which
+    // share our sub-grid column, each padded to the width kLocA, and
+    // likewise for op(B) within our column
+    const Int kLocA = MaxLength(k, c);
+    const Int kLocB = MaxLength(k, r);
+    Matrix<T> panelA, panelB;
+    Zeros(panelA, localHeight, (c/gcd)*kLocA);
+    Zeros(panelB, kLocB, (r/gcd)*localWidth);
+    Range<Int> ownColsA, ownRowsB, ownColsB;
+    if (g.InGrid())
+    {
+        ownColsA = IR(0,Length(k,col,c)) + (col/gcd)*kLocA;
+        ownRowsB = IR(0,Length(k,row,r));
+        ownColsB = IR(0,localWidth) + (row/gcd)*localWidth;
+    }
+
+    // Force op(A) into the rows of C and op(B) into the columns of C, with
+    // the inner dimension aligned with the first process row and column
+    ElementalProxyCtrl ctrlA, ctrlB;
+    ctrlA.colConstrain = true; ctrlA.rowConstrain = true;
+    ctrlB.colConstrain = true; ctrlB.rowConstrain = true;
+    if (orientA == NORMAL)
+    {
+        ctrlA.colAlign = C.ColAlign(); ctrlA.rowAlign = 0;
+        DistMatrixReadProxy<T,T,MC,MR> AProx(APre, ctrlA);
+        if (g.InGrid())
+        {
+            auto ownA = panelA(ALL, ownColsA);
+            Copy(AProx.GetLocked().LockedMatrix(), ownA);
+        }
+    }
+    else
+    {
+        ctrlA.colAlign = 0; ctrlA.rowAlign = C.ColAlign();
+        DistMatrixReadProxy<T,T,MR,MC> AProx(APre, ctrlA);
+        if (g.InGrid())
+        {
+            auto ownA = panelA(ALL, ownColsA);
+            Transpose
+            (AProx.GetLocked().LockedMatrix(), ownA, orientA == ADJOINT);
+        }
+    }
+    if (orientB == NORMAL)
+    {
+        ctrlB.colAlign = 0; ctrlB.rowAlign = C.RowAlign();
+        DistMatrixReadProxy<T,T,MC,MR> BProx(BPre, ctrlB);
+        if (g.InGrid())
+        {
+            auto ownB = panelB(ownRowsB, ownColsB);
+            Copy(BProx.GetLocked().LockedMatrix(), ownB);
+        }
+    }
+    else
+    {
+        ctrlB.colAlign = C.RowAlign(); ctrlB.rowAlign = 0;
+        DistMatrixReadProxy<T,T,MR,MC> BProx(BPre, ctrlB);
+        if (g.InGrid())
+        {
+            auto ownB = panelB(ownRowsB, ownColsB);
+            Transpose
+            (BProx.GetLocked().LockedMatrix(), ownB, orientB == ADJOINT);
+        }
+    }
+    if (!g.InGrid() || k == 0)
+        return;
+
+    mpi::Comm rowComm = g.RowComm();
+    mpi::Comm colComm = g.ColComm();
+    CannonRingGather
+    (panelA.Buffer(), localHeight*kLocA, gcd, rowComm);
+    CannonRingGather
+    (panelB.Buffer(), kLocB*localWidth, gcd, colComm);
+
+    // Interleave the gathered blocks so that local index l of each package
+    // corresponds to the inner index (our residue modulo gcd) + l*gcd
+    const Int numBlocksA = c/gcd;
+    const Int numBlocksB = r/gcd;
+    const Int kLoc = MaxLength(k, gcd);
+    Matrix<T> pkgA[2], pkgB[2];
+    Zeros(pkgA[0], localHeight, kLoc);
+    Zeros(pkgA[1], localHeight, kLoc);
+    Zeros(pkgB[0], kLoc, localWidth);
+    Zeros(pkgB[1], kLoc, localWidth);
+    for (Int l=0; l<kLoc; ++l)
+        MemCopy
+        (pkgA[0].Buffer(0,l),
+          panelA.LockedBuffer(0,(l%numBlocksA)*kLocA+l/numBlocksA),
+          localHeight);
+    for (Int jLoc=0; jLoc<localWidth; ++jLoc)
+        for (Int l=0; l<kLoc; ++l)
+            pkgB[0](l,jLoc) =
+              panelB(l/numBlocksB, (l%numBlocksB)*localWidth+jLoc);
+
+    // Perform the initial circular shifts within our sub-grid so that our
+    // A and B packages align
+    const Int rowSub = row % gcd;
+    const Int colSub = col % gcd;
+    const Int rowBase = row - rowSub;
+    const Int colBase = col - colSub;
+    const Int pkgSizeA = localHeight*kLoc;
+    const Int pkgSizeB = kLoc*localWidth;
+    mpi::SendRecv
+    (pkgA[0].Buffer(), pkgSizeA,
+      colBase+Mod(colSub-rowSub,gcd), colBase+Mod(colSub+rowSub,gcd),
+      rowComm);
+    mpi::SendRecv
+    (pkgB[0].Buffer(), pkgSizeB,
+      rowBase+Mod(rowSub-colSub,gcd), rowBase+Mod(rowSub+colSub,gcd),
+      colComm);
+
+    // Now begin the data flow, shifting the next packages while we update
+    // with the current ones
+    const int aboveRow = rowBase + Mod(rowSub-1,gcd);
+    const int belowRow = rowBase + Mod(rowSub+1,gcd);
+    const int leftCol  = colBase + Mod(colSub-1,gcd);
+    const int rightCol = colBase + Mod(colSub+1,gcd);
+    mpi::Request<T> requests[4];
+    for (Int q=0; q<gcd; ++q)
+    {
+        const Int curr = q % 2;
+        const Int next = (q+1) % 2;
+        const bool shift = (q != gcd-1);
+        if (shift)
+        {
+            mpi::IRecv
+            (pkgA[next].Buffer(), pkgSizeA, rightCol, rowComm, requests[0]);
+            mpi::IRecv
+            (pkgB[next].Buffer(), pkgSizeB, belowRow, colComm, requests[1]);
+            mpi::ISend
+            (pkgA[curr].LockedBuffer(), pkgSizeA, leftCol, rowComm,
+              requests[2]);
+            mpi::ISend
+            (pkgB[curr].LockedBuffer(), pkgSizeB, aboveRow, colComm,
+              requests[3]);
+        }
+        Gemm(NORMAL, NORMAL, alpha, pkgA[curr], pkgB[curr], T(1), C.Matrix());
+        if (shift)
+            mpi::WaitAll(4, requests);
+    }
+}
+
+} // namespace gemm
+} // namespace El
@@ -0,0 +1,175 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// The number of layers used by GEMM_3D (and by GEMM_2_5D when none is
+// given): the largest divisor c of the grid size p with c^3 <= p
+inline int DefaultNumLayers( int gridSize )
+{
+    int numLayers = 1;
+    for( int c=2; c*c*c<=gridSize; ++c )
+        if( gridSize % c == 0 )
+            numLayers = c;
+    return numLayers;
+}
+
+// 2.5D (and, with c = p^(1/3) layers, 3D) matrix multiplication
+//
+// The processes of C's grid are split into c layers (see Grid::LayerGrid),
+// and the l'th layer computes alpha op(A) op(B) restricted to the l'th of c
+// contiguous blocks of the inner dimension with a 2D SUMMA over the layer's
+// own grid. Each layer therefore only receives the k/c columns of op(A) and
+// rows of op(B) which it needs. The contributions are reduce-scattered over
+// the depth communicators so that the l'th layer only receives, and adds
+// into C, the l'th block of rows of the sum. This trades c times the memory
+// for C for a factor of roughly sqrt(c) less bandwidth than a 2D algorithm
+// over all p processes.
+template<typename T>
+void Layered
+(Orientation orientA, Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre,
+  int numLayers)
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm::Layered")
+
+    if (CPre.GetLocalDevice() != Device::CPU)
+        LogicError("Layered Gemm not implemented for device!");
+
+    const Grid& g = CPre.Grid();
+    if (numLayers <= 0)
+        numLayers = DefaultNumLayers(g.Size());
+    if (numLayers == 1)
+    {
+        Gemm(orientA, orientB, alpha, APre, BPre, T(1), CPre);
+        return;
+    }
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx(CPre);
+    DistMatrixReadProxy<T,T,MC,MR> AProx(APre);
+    DistMatrixReadProxy<T,T,MC,MR> BProx(BPre);
+    auto& C = CProx.Get();
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = (orientA == NORMAL ? A.Width() : A.Height());
+    const int layer = g.Layer(numLayers);
+    auto block = [&](Int size, int l)
+    { return IR(size*l/numLayers, size*(l+1)/numLayers); };
+
+    // Translate the portions of A and B needed by each layer onto its grid
+    // (every viewing process takes part in each translation)
+    DistMatrix<T> ALayer(g.LayerGrid(numLayers,0)),
+                  BLayer(g.LayerGrid(numLayers,0));
+    for (int l=0; l<numLayers; ++l)
+    {
+        const Grid& layerGrid = g.LayerGrid(numLayers, l);
+        const Range<Int> ind = block(k, l);
+        DistMatrix<T> ATrans(layerGrid), BTrans(layerGrid);
+        auto& ADest = (l == layer ? ALayer : ATrans);
+        auto& BDest = (l == layer ? BLayer : BTrans);
+        ADest.SetGrid(layerGrid);
+        BDest.SetGrid(layerGrid);
+        if (orientA == NORMAL)
+            ADest = A(ALL, ind);
+        else
+            ADest = A(ind, ALL);
+        if (orientB == NORMAL)
+            BDest = B(ind, ALL);
+        else
+            BDest = B(ALL, ind);
+    }
+
+    // Multiply within our layer's own grid (the partial products of the
+    // layers are identically distributed), then reduce-scatter the sum over
+    // the depth so that the l'th layer only receives the l'th block of rows
+    Matrix<T> buffer;
+    DistMatrix<T> CLayer(g.LayerGrid(numLayers,0));
+    if (g.InGrid())
+    {
+        const Grid& ownGrid = g.OwnLayerGrid(numLayers);
+        DistMatrix<T> AOwn(ownGrid), BOwn(ownGrid), COwn(ownGrid);
+        AOwn.LockedAttach
+        (ALayer.Height(), ALayer.Width(), ownGrid,
+          ALayer.ColAlign(), ALayer.RowAlign(), ALayer.LockedMatrix());
+        BOwn.LockedAttach
+        (BLayer.Height(), BLayer.Width(), ownGrid,
+          BLayer.ColAlign(), BLayer.RowAlign(), BLayer.LockedMatrix());
+        Gemm(orientA, orientB, alpha, AOwn, BOwn, COwn);
+
+        // Pack the local rows of each block contiguously, padding each to
+        // the largest (the local rows of a block of rows are contiguous)
+        const Int colShift = COwn.ColShift();
+        const Int colStride = COwn.ColStride();
+        const Int localWidth = COwn.LocalWidth();
+        auto localBlock = [&](int l)
+        {
+            const Range<Int> ind = block(m, l);
+            return IR(Length(ind.beg, colShift, colStride),
+                      Length(ind.end, colShift, colStride));
+        };
+        Int maxLocalHeight = 0;
+        for (int l=0; l<numLayers; ++l)
+        {
+            const Range<Int> indLoc = localBlock(l);
+            maxLocalHeight = Max(maxLocalHeight, indLoc.end-indLoc.beg);
+        }
+        const Int recvSize = mpi::Pad(maxLocalHeight*localWidth);
+        // Zero-initialize so that the padding entries are harmless to reduce
+        Zeros(buffer, recvSize, numLayers);
+        for (int l=0; l<numLayers; ++l)
+        {
+            const Range<Int> indLoc = localBlock(l);
+            const Int localHeight = indLoc.end - indLoc.beg;
+            for (Int jLoc=0; jLoc<localWidth; ++jLoc)
+                MemCopy
+                (buffer.Buffer(0,l)+jLoc*localHeight,
+                  COwn.LockedBuffer(indLoc.beg,jLoc), localHeight);
+        }
+        mpi::ReduceScatter
+        (buffer.Buffer(), recvSize, g.DepthComm(numLayers));
+
+        const Range<Int> ind = block(m, layer);
+        const Range<Int> indLoc = localBlock(layer);
+        CLayer.LockedAttach
+        (ind.end-ind.beg, n, g.LayerGrid(numLayers, layer),
+          Mod(ind.beg,colStride), 0, buffer.LockedBuffer(),
+          Max(indLoc.end-indLoc.beg,Int(1)));
+    }
+
+    // Add the l'th block of rows of the sum, from the l'th layer, into C
+    for (int l=0; l<numLayers; ++l)
+    {
+        const Grid& layerGrid = g.LayerGrid(numLayers, l);
+        const Range<Int> ind = block(m, l);
+        DistMatrix<T> CTrans(layerGrid);
+        auto& CSource = (l == layer ? CLayer : CTrans);
+        if (l != layer)
+        {
+            CTrans.Align(Mod(ind.beg, layerGrid.Height()), 0);
+            CTrans.Resize(ind.end-ind.beg, n);
+        }
+        const DistMatrix<T>& CSourceConst = CSource;
+        auto C1 = C(ind, ALL);
+        DistMatrix<T> CUpdate(g);
+        CUpdate.AlignWith(C1);
+        CUpdate = CSourceConst;
+        Axpy(T(1), CUpdate.LockedMatrix(), C1.Matrix());
+    }
+}
+
+} // namespace gemm
+} // namespace El
@@ -10,88 +10,6 @@
 namespace El {
 namespace gemm {
 
-// Cannon's algorithm
-template<typename T>
-void Cannon_NN
-(T alpha,
-  const AbstractDistMatrix<T>& APre,
-  const AbstractDistMatrix<T>& BPre,
-        AbstractDistMatrix<T>& CPre)
-{
-    EL_DEBUG_CSE
-
-    if (APre.GetLocalDevice() != Device::CPU)
-        LogicError("Cannon_NN not implemented for device!");
-
-    const Grid& g = APre.Grid();
-    if (g.Height() != g.Width())
-        LogicError("Process grid must be square for Cannon's");
-
-    // Force A, B, and C to be in [MC,MR] distributions aligned with C
-    DistMatrixReadWriteProxy<T,T,MC,MR> CProx(CPre);
-    auto& C = CProx.Get();
-
-    ElementalProxyCtrl ctrlA, ctrlB;
-    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
-    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
-
-    DistMatrixReadProxy<T,T,MC,MR> AProx(APre, ctrlA);
-    DistMatrixReadProxy<T,T,MC,MR> BProx(BPre, ctrlB);
-    auto& A = AProx.GetLocked();
-    auto& B = BProx.GetLocked();
-
-    const Int row = g.Row();
-    const Int col = g.Col();
-    const Int pSqrt = g.Height();
-    mpi::Comm rowComm = g.RowComm();
-    mpi::Comm colComm = g.ColComm();
-    if (A.Width() % pSqrt != 0)
-        LogicError("For now, width(A) must be integer multiple of sqrt(p)");
-
-    // Load the initial A and B packages (may want to transpose B...)
-    const Int localHeightA = A.LocalHeight();
-    const Int localHeightB = B.LocalHeight();
-    const Int localWidthA = A.LocalWidth();
-    const Int localWidthB = B.LocalWidth();
-    Matrix<T> pkgA(localHeightA,localWidthA,localHeightA),
-              pkgB(localHeightB,localWidthB,localHeightB);
-    for(Int jLoc=0; jLoc<localWidthA; ++jLoc)
-        MemCopy
-        (pkgA.Buffer(0,jLoc), A.LockedBuffer(0,jLoc), localHeightA);
-    for(Int jLoc=0; jLoc<localWidthB; ++jLoc)
-        MemCopy
-        (pkgB.Buffer(0,jLoc), B.LockedBuffer(0,jLoc), localHeightB);
-
-    // Perform the initial circular shifts so that our A and B packages align
-    const Int rowShiftA = A.RowShift();
-    const Int colShiftB = B.ColShift();
-    const Int leftInitA  = Mod(col-colShiftB,pSqrt);
-    const Int rightInitA = Mod(col+colShiftB,pSqrt);
-    const Int aboveInitB = Mod(row-rowShiftA,pSqrt);
-    const Int belowInitB = Mod(row+rowShiftA,pSqrt);
-    const Int pkgSizeA = localHeightA*localWidthA;
-    const Int pkgSizeB = localHeightB*localWidthB;
-    mpi::SendRecv(pkgA.Buffer(), pkgSizeA, leftInitA, rightInitA, rowComm);
-    mpi::SendRecv(pkgB.Buffer(), pkgSizeB, aboveInitB, belowInitB, colComm);
-
-    // Now begin the data flow
-    const Int aboveRow = Mod(row-1,pSqrt);
-    const Int belowRow = Mod(row+1,pSqrt);
-    const Int leftCol  = Mod(col-1,pSqrt);
-    const Int rightCol = Mod(col+1,pSqrt);
-    for(Int q=0; q<pSqrt; ++q)
-    {
-        Gemm(NORMAL, NORMAL, alpha, pkgA, pkgB, T(1), C.Matrix());
-        if (q != pSqrt-1)
-        {
-            mpi::SendRecv
-            (pkgA.Buffer(), pkgSizeA, leftCol, rightCol, rowComm);
-            mpi::SendRecv
-            (pkgB.Buffer(), pkgSizeB, aboveRow, belowRow, colComm);
-        }
-    }
-}
-
 // Normal Normal Gemm that avoids communicating the matrix A
 template <Device D, typename T, typename=EnableIf<IsDeviceValidType<T,D>>>
 void SUMMA_NNA_impl
@@ -105,17 +23,24 @@ void SUMMA_NNA_impl
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
 
-    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> AProx(APre);
-    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> BProx(BPre);
     DistMatrixReadWriteProxy<T,T,MC,MR,ELEMENT,D> CProx(CPre);
+    auto& C = CProx.Get();
+
+    // Align A with C so that the summations of D1[MC,*] can be
+    // nonblocking reduce-scatters which need no realignment
+    ElementalProxyCtrl ctrlA;
+    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
+
+    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> AProx(APre, ctrlA);
+    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> BProx(BPre);
     auto& A = AProx.GetLocked();
     auto& B = BProx.GetLocked();
-    auto& C = CProx.Get();
 
     // Temporary distributions
     DistMatrix<T,VR,STAR,ELEMENT,D> B1_VR_STAR(g);
     DistMatrix<T,STAR,MR,ELEMENT,D> B1Trans_STAR_MR(g);
     DistMatrix<T,MC,STAR,ELEMENT,D> D1_MC_STAR(g);
+    ContractHandle<T> contractHandle;
 
     B1_VR_STAR.AlignWith(A);
     B1Trans_STAR_MR.AlignWith(A);
@@ -130,11 +55,16 @@ void SUMMA_NNA_impl
         // D1[MC,*] := alpha A[MC,MR] B1[MR,*]
         B1_VR_STAR = B1;
         Transpose(B1_VR_STAR, B1Trans_STAR_MR);
+        contractHandle.Test();
         LocalGemm(NORMAL, TRANSPOSE, alpha, A, B1Trans_STAR_MR, D1_MC_STAR);
 
-        // C1[MC,MR] += scattered result of D1[MC,*] summed over grid rows
-        AxpyContract(T(1), D1_MC_STAR, C1);
+        // C1[MC,MR] += scattered result of D1[MC,*] summed over grid rows.
+        // The summation for the previous panel overlapped the above and is
+        // completed (and added into C) before this one is started.
+        contractHandle.Wait();
+        contractHandle = AxpyContractAsync(T(1), D1_MC_STAR, C1);
     }
+    contractHandle.Wait();
 }
 
 template <Device D, typename T,
@@ -155,6 +85,7 @@ void SUMMA_NNA
  AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm::SUMMA_NNA")
 
     switch (CPre.GetLocalDevice())
     {
@@ -184,19 +115,26 @@ void SUMMA_NNB_impl
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
 
-    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> AProx(APre);
-    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> BProx(BPre);
     DistMatrixReadWriteProxy<T,T,MC,MR,ELEMENT,D> CProx(CPre);
+    auto& C = CProx.Get();
+
+    // Align B with C so that the summations of D1[* ,MR] can be
+    // nonblocking reduce-scatters which need no realignment
+    ElementalProxyCtrl ctrlB;
+    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
+
+    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> AProx(APre);
+    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> BProx(BPre, ctrlB);
     auto& A = AProx.GetLocked();
     auto& B = BProx.GetLocked();
-    auto& C = CProx.Get();
 
     // Temporary distributions
     DistMatrix<T,STAR,MC,ELEMENT,D> A1_STAR_MC(g);
-    DistMatrix<T,MR,STAR,ELEMENT,D> D1Trans_MR_STAR(g);
+    DistMatrix<T,STAR,MR,ELEMENT,D> D1_STAR_MR(g);
+    ContractHandle<T> contractHandle;
 
     A1_STAR_MC.AlignWith(B);
-    D1Trans_MR_STAR.AlignWith(B);
+    D1_STAR_MR.AlignWith(B);
 
     for(Int k=0; k<m; k+=bsize)
     {
@@ -204,13 +142,17 @@ void SUMMA_NNB_impl
         auto A1 = A(IR(k,k+nb), ALL);
         auto C1 = C(IR(k,k+nb), ALL);
 
-        // D1^T[MR,* ] := alpha B^T[MR,MC] A1^T[MC,* ]
+        // D1[* ,MR] := alpha A1[* ,MC] B[MC,MR]
         A1_STAR_MC = A1;
-        LocalGemm
-        (TRANSPOSE, TRANSPOSE, alpha, B, A1_STAR_MC, D1Trans_MR_STAR);
+        contractHandle.Test();
+        LocalGemm(NORMAL, NORMAL, alpha, A1_STAR_MC, B, D1_STAR_MR);
 
-        TransposeAxpyContract(T(1), D1Trans_MR_STAR, C1);
+        // C1[MC,MR] += scattered result of D1[* ,MR] summed over grid
+        // columns, completed one panel later as in SUMMA_NNA
+        contractHandle.Wait();
+        contractHandle = AxpyContractAsync(T(1), D1_STAR_MR, C1);
     }
+    contractHandle.Wait();
 }
 
 template <Device D, typename T,
@@ -231,6 +173,7 @@ void SUMMA_NNB
  AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm::SUMMA_NNB")
 
     switch (CPre.GetLocalDevice())
     {
@@ -306,6 +249,7 @@ void SUMMA_NNC
         AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm::SUMMA_NNC")
 
     switch (CPre.GetLocalDevice())
     {
@@ -323,6 +267,115 @@ void SUMMA_NNC
 
 }
 
+// Normal Normal Gemm that avoids communicating the matrix C, with a
+// look-ahead of one panel: the gathers of the (k+1)'th panels of A and B
+// into one pair of buffers are started before the local update with the
+// k'th panels, which are held in the other pair
+template <Device D, typename T, typename=EnableIf<IsDeviceValidType<T,D>>>
+void SUMMA_NNCLookahead_impl(T alpha,
+                             AbstractDistMatrix<T> const& APre,
+                             AbstractDistMatrix<T> const& BPre,
+                             AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    const Int n = CPre.Width();
+    const Int sumDim = APre.Width();
+    const Int bsize = Blocksize();
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadWriteProxy<T,T,MC,MR,ELEMENT,D> CProx(CPre);
+    auto& C = CProx.Get();
+
+    // Align A and B with C so that the panels can be gathered
+    // asynchronously without any realignment
+    ElementalProxyCtrl ctrlA, ctrlB;
+    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
+    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
+
+    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> AProx(APre, ctrlA);
+    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> BProx(BPre, ctrlB);
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    // Temporary distributions
+    DistMatrix<T,MC,STAR,ELEMENT,D> A1_MC_STAR[2] =
+      { DistMatrix<T,MC,STAR,ELEMENT,D>(g),
+        DistMatrix<T,MC,STAR,ELEMENT,D>(g) };
+    DistMatrix<T,STAR,MR,ELEMENT,D> B1_STAR_MR[2] =
+      { DistMatrix<T,STAR,MR,ELEMENT,D>(g),
+        DistMatrix<T,STAR,MR,ELEMENT,D>(g) };
+    CopyHandle<T> AHandle[2], BHandle[2];
+    for(Int buf=0; buf<2; ++buf)
+    {
+        A1_MC_STAR[buf].AlignWith(C);
+        B1_STAR_MR[buf].AlignWith(C);
+    }
+
+    auto startPanels = [&](Int k, Int buf)
+    {
+        const Int nb = Min(bsize,sumDim-k);
+        AHandle[buf] = CopyAsync(A(ALL,IR(k,k+nb)), A1_MC_STAR[buf]);
+        BHandle[buf] = CopyAsync(B(IR(k,k+nb),ALL), B1_STAR_MR[buf]);
+    };
+
+    if (sumDim > 0)
+        startPanels(0, 0);
+    for(Int k=0, buf=0; k<sumDim; k+=bsize, buf=1-buf)
+    {
+        AHandle[buf].Wait();
+        BHandle[buf].Wait();
+        if (k+bsize < sumDim)
+            startPanels(k+bsize, 1-buf);
+
+        // C[MC,MR] += alpha A1[MC,*] B1[*,MR], a block of columns at a time
+        // so that the gathers of the next panels are progressed in between
+        for(Int j=0; j<n; j+=bsize)
+        {
+            const Int nbj = Min(bsize,n-j);
+            auto B1J = B1_STAR_MR[buf](ALL, IR(j,j+nbj));
+            auto CJ = C(ALL, IR(j,j+nbj));
+            LocalGemm(NORMAL, NORMAL, alpha, A1_MC_STAR[buf], B1J, T(1), CJ);
+            AHandle[1-buf].Test();
+            BHandle[1-buf].Test();
+        }
+    }
+}
+
+template <Device D, typename T,
+          typename=DisableIf<IsDeviceValidType<T,D>>, typename=void>
+void SUMMA_NNCLookahead_impl(T alpha,
+                             AbstractDistMatrix<T> const& APre,
+                             AbstractDistMatrix<T> const& BPre,
+                             AbstractDistMatrix<T>& CPre)
+{
+    LogicError("SUMMA_NNCLookahead_impl type-device combo not supported.");
+}
+
+template<typename T>
+void SUMMA_NNCLookahead
+(T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm::SUMMA_NNCLookahead")
+
+    switch (CPre.GetLocalDevice())
+    {
+    case Device::CPU:
+        SUMMA_NNCLookahead_impl<Device::CPU>(alpha, APre, BPre, CPre);
+        break;
+#ifdef HYDROGEN_HAVE_CUDA
+    case Device::GPU:
+        SUMMA_NNCLookahead_impl<Device::GPU>(alpha, APre, BPre, CPre);
+        break;
+#endif // HYDROGEN_HAVE_CUDA
+    default:
+        LogicError("SUMMA_NNCLookahead: Bad device.");
+    }
+}
+
 // Normal Normal Gemm for panel-panel dot products
 //
 // Use summations of local multiplications from a 1D distribution of A and B
@@ -396,6 +449,7 @@ void SUMMA_NNDot
   Int blockSize=2000)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm::SUMMA_NNDot")
 
     switch (CPre.GetLocalDevice())
     {
@@ -461,6 +515,7 @@ void SUMMA_NN
     case GEMM_SUMMA_A:   SUMMA_NNA(alpha, A, B, C); break;
     case GEMM_SUMMA_B:   SUMMA_NNB(alpha, A, B, C); break;
     case GEMM_SUMMA_C:   SUMMA_NNC(alpha, A, B, C); break;
+    case GEMM_SUMMA_C_LOOKAHEAD: SUMMA_NNCLookahead(alpha, A, B, C); break;
     case GEMM_SUMMA_DOT: SUMMA_NNDot(alpha, A, B, C, blockSizeDot); break;
     default: LogicError("Unsupported Gemm option");
     }
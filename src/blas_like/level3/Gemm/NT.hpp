@@ -74,6 +74,7 @@ void SUMMA_NTA
  AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm::SUMMA_NTA")
 
     switch (CPre.GetLocalDevice())
     {
@@ -157,6 +158,7 @@ void SUMMA_NTB
         AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm::SUMMA_NTB")
 
     switch (CPre.GetLocalDevice())
     {
@@ -240,6 +242,7 @@ void SUMMA_NTC
         AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm::SUMMA_NTC")
 
     switch (CPre.GetLocalDevice())
     {
@@ -256,6 +259,131 @@ void SUMMA_NTC
     }
 }
 
+// Normal Transpose Gemm that avoids communicating the matrix C, with a
+// look-ahead of one panel. The (k+1)'th panel of A is gathered, and the
+// first redistribution of that of B is performed, while the local update
+// with the k'th panels runs; the rest of B's panel is redistributed when
+// it is needed.
+template <Device D, typename T, typename=EnableIf<IsDeviceValidType<T,D>>>
+void SUMMA_NTCLookahead_impl
+(Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    const Int n = CPre.Width();
+    const Int sumDim = APre.Width();
+    const Int bsize = Blocksize();
+    const Grid& g = APre.Grid();
+    const bool conjugate = (orientB == ADJOINT);
+
+    DistMatrixReadWriteProxy<T,T,MC,MR,ELEMENT,D> CProx(CPre);
+    auto& C = CProx.Get();
+
+    ElementalProxyCtrl ctrlA;
+    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
+
+    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> AProx(APre, ctrlA);
+    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> BProx(BPre);
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    // Temporary distributions
+    DistMatrix<T,MC,STAR,ELEMENT,D> A1_MC_STAR[2] =
+      { DistMatrix<T,MC,STAR,ELEMENT,D>(g),
+        DistMatrix<T,MC,STAR,ELEMENT,D>(g) };
+    DistMatrix<T,VC,STAR,ELEMENT,D> B1_VC_STAR[2] =
+      { DistMatrix<T,VC,STAR,ELEMENT,D>(g),
+        DistMatrix<T,VC,STAR,ELEMENT,D>(g) };
+    DistMatrix<T,VR,STAR,ELEMENT,D> B1_VR_STAR(g);
+    DistMatrix<T,STAR,MR,ELEMENT,D> B1Trans_STAR_MR(g);
+    CopyHandle<T> AHandle[2], BHandle[2];
+
+    A1_MC_STAR[0].AlignWith(C);
+    A1_MC_STAR[1].AlignWith(C);
+    B1_VR_STAR.AlignWith(C);
+    B1Trans_STAR_MR.AlignWith(C);
+
+    // Both panels travel over the row communicator (the all-gather into
+    // [MC,*] and the all-to-all into [VC,*]), and up to four handles are
+    // outstanding at once. Every process starts them in the same order, which
+    // is all that CopyHandle needs to keep their messages apart.
+    auto startPanels = [&](Int k, Int buf)
+    {
+        const Int nb = Min(bsize,sumDim-k);
+        AHandle[buf] = CopyAsync(A(ALL,IR(k,k+nb)), A1_MC_STAR[buf]);
+        BHandle[buf] = CopyAsync(B(ALL,IR(k,k+nb)), B1_VC_STAR[buf]);
+    };
+
+    if (sumDim > 0)
+        startPanels(0, 0);
+    for(Int k=0, buf=0; k<sumDim; k+=bsize, buf=1-buf)
+    {
+        AHandle[buf].Wait();
+        BHandle[buf].Wait();
+        if (k+bsize < sumDim)
+            startPanels(k+bsize, 1-buf);
+
+        B1_VR_STAR = B1_VC_STAR[buf];
+        Transpose(B1_VR_STAR, B1Trans_STAR_MR, conjugate);
+
+        // C[MC,MR] += alpha A1[MC,*] (B1^T)[*,MR], one block of columns at
+        // a time so that the communication of the next panels is progressed
+        // in between
+        for(Int j=0; j<n; j+=bsize)
+        {
+            const Int nbj = Min(bsize,n-j);
+            auto B1J = B1Trans_STAR_MR(ALL, IR(j,j+nbj));
+            auto CJ = C(ALL, IR(j,j+nbj));
+            LocalGemm(NORMAL, NORMAL, alpha, A1_MC_STAR[buf], B1J, T(1), CJ);
+            AHandle[1-buf].Test();
+            BHandle[1-buf].Test();
+        }
+    }
+}
+
+template <Device D, typename T,
+          typename=DisableIf<IsDeviceValidType<T,D>>, typename=void>
+void SUMMA_NTCLookahead_impl
+(Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre)
+{
+    LogicError("SUMMA_NTCLookahead_impl type-device combo not supported.");
+}
+
+template<typename T>
+void SUMMA_NTCLookahead
+(Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm::SUMMA_NTCLookahead")
+
+    switch (CPre.GetLocalDevice())
+    {
+    case Device::CPU:
+        SUMMA_NTCLookahead_impl<Device::CPU>(
+            orientB, alpha, APre, BPre, CPre);
+        break;
+#ifdef HYDROGEN_HAVE_CUDA
+    case Device::GPU:
+        SUMMA_NTCLookahead_impl<Device::GPU>(
+            orientB, alpha, APre, BPre, CPre);
+        break;
+#endif // HYDROGEN_HAVE_CUDA
+    default:
+        LogicError("SUMMA_NTCLookahead: Bad device.");
+    }
+}
+
 // Normal Transpose Gemm for panel-panel dot products
 //
 // Use summations of local multiplications from a 1D distribution of A and B
@@ -331,6 +459,7 @@ void SUMMA_NTDot
  Int blockSize=2000)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm::SUMMA_NTDot")
 
     switch (CPre.GetLocalDevice())
     {
@@ -397,6 +526,9 @@ void SUMMA_NT
     case GEMM_SUMMA_A: SUMMA_NTA(orientB, alpha, A, B, C); break;
     case GEMM_SUMMA_B: SUMMA_NTB(orientB, alpha, A, B, C); break;
     case GEMM_SUMMA_C: SUMMA_NTC(orientB, alpha, A, B, C); break;
+    case GEMM_SUMMA_C_LOOKAHEAD:
+        SUMMA_NTCLookahead(orientB, alpha, A, B, C);
+        break;
     case GEMM_SUMMA_DOT: SUMMA_NTDot(orientB, alpha, A, B, C); break;
     default: LogicError("Unsupported Gemm option");
     }
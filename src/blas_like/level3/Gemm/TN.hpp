@@ -77,6 +77,7 @@ void SUMMA_TNA
         AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm::SUMMA_TNA")
 
     switch (CPre.GetLocalDevice())
     {
@@ -157,6 +158,7 @@ void SUMMA_TNB
         AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm::SUMMA_TNB")
 
     switch (CPre.GetLocalDevice())
     {
@@ -237,6 +239,7 @@ void SUMMA_TNC
         AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm::SUMMA_TNC")
 
     switch (CPre.GetLocalDevice())
     {
@@ -253,6 +256,133 @@ void SUMMA_TNC
     }
 }
 
+// Transpose Normal Gemm that avoids communicating the matrix C, with a
+// look-ahead of one panel. The (k+1)'th panel of B is gathered, and the
+// first redistribution of the (locally transposed) panel of A is
+// performed, while the local update with the k'th panels runs; the rest of
+// A's panel is redistributed when it is needed.
+template <Device D, typename T, typename=EnableIf<IsDeviceValidType<T,D>>>
+void SUMMA_TNCLookahead_impl
+(Orientation orientA,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    const Int n = CPre.Width();
+    const Int sumDim = BPre.Height();
+    const Int bsize = Blocksize();
+    const Grid& g = APre.Grid();
+    const bool conjugate = (orientA == ADJOINT);
+
+    DistMatrixReadWriteProxy<T,T,MC,MR,ELEMENT,D> CProx(CPre);
+    auto& C = CProx.Get();
+
+    ElementalProxyCtrl ctrlB;
+    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
+
+    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> AProx(APre);
+    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> BProx(BPre, ctrlB);
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    // Temporary distributions
+    DistMatrix<T,MR,MC,ELEMENT,D> A1Trans_MR_MC(g);
+    DistMatrix<T,VR,STAR,ELEMENT,D> A1Trans_VR_STAR[2] =
+      { DistMatrix<T,VR,STAR,ELEMENT,D>(g),
+        DistMatrix<T,VR,STAR,ELEMENT,D>(g) };
+    DistMatrix<T,VC,STAR,ELEMENT,D> A1Trans_VC_STAR(g);
+    DistMatrix<T,MC,STAR,ELEMENT,D> A1Trans_MC_STAR(g);
+    DistMatrix<T,STAR,MR,ELEMENT,D> B1_STAR_MR[2] =
+      { DistMatrix<T,STAR,MR,ELEMENT,D>(g),
+        DistMatrix<T,STAR,MR,ELEMENT,D>(g) };
+    CopyHandle<T> AHandle[2], BHandle[2];
+
+    A1Trans_VC_STAR.AlignWith(C);
+    A1Trans_MC_STAR.AlignWith(C);
+    B1_STAR_MR[0].AlignWith(C);
+    B1_STAR_MR[1].AlignWith(C);
+
+    // The all-to-all into [VR,*] and the all-gather into [*,MR] both use the
+    // column communicator; since every process starts the A handle before
+    // the B handle, CopyHandle matches each with its counterpart even while
+    // the previous pair is still in flight
+    auto startPanels = [&](Int k, Int buf)
+    {
+        const Int nb = Min(bsize,sumDim-k);
+        Transpose(A(IR(k,k+nb),ALL), A1Trans_MR_MC, conjugate);
+        AHandle[buf] = CopyAsync(A1Trans_MR_MC, A1Trans_VR_STAR[buf]);
+        BHandle[buf] = CopyAsync(B(IR(k,k+nb),ALL), B1_STAR_MR[buf]);
+    };
+
+    if (sumDim > 0)
+        startPanels(0, 0);
+    for(Int k=0, buf=0; k<sumDim; k+=bsize, buf=1-buf)
+    {
+        AHandle[buf].Wait();
+        BHandle[buf].Wait();
+        if (k+bsize < sumDim)
+            startPanels(k+bsize, 1-buf);
+
+        A1Trans_VC_STAR = A1Trans_VR_STAR[buf];
+        A1Trans_MC_STAR = A1Trans_VC_STAR;
+
+        // C[MC,MR] += alpha (A1^T)[MC,*] B1[*,MR], one block of columns at
+        // a time so that the communication of the next panels is progressed
+        // in between
+        for(Int j=0; j<n; j+=bsize)
+        {
+            const Int nbj = Min(bsize,n-j);
+            auto B1J = B1_STAR_MR[buf](ALL, IR(j,j+nbj));
+            auto CJ = C(ALL, IR(j,j+nbj));
+            LocalGemm(NORMAL, NORMAL, alpha, A1Trans_MC_STAR, B1J, T(1), CJ);
+            AHandle[1-buf].Test();
+            BHandle[1-buf].Test();
+        }
+    }
+}
+
+template <Device D, typename T,
+          typename=DisableIf<IsDeviceValidType<T,D>>, typename=void>
+void SUMMA_TNCLookahead_impl
+(Orientation orientA,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre)
+{
+    LogicError("SUMMA_TNCLookahead_impl type-device combo not supported.");
+}
+
+template<typename T>
+void SUMMA_TNCLookahead
+(Orientation orientA,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm::SUMMA_TNCLookahead")
+
+    switch (CPre.GetLocalDevice())
+    {
+    case Device::CPU:
+        SUMMA_TNCLookahead_impl<Device::CPU>(
+            orientA, alpha, APre, BPre, CPre);
+        break;
+#ifdef HYDROGEN_HAVE_CUDA
+    case Device::GPU:
+        SUMMA_TNCLookahead_impl<Device::GPU>(
+            orientA, alpha, APre, BPre, CPre);
+        break;
+#endif // HYDROGEN_HAVE_CUDA
+    default:
+        LogicError("SUMMA_TNCLookahead: Bad device.");
+    }
+}
+
 // Transpose Normal Gemm for panel-panel dot products
 //
 // Use summations of local multiplications from a 1D distribution of A and B
@@ -328,6 +458,7 @@ void SUMMA_TNDot
     Int blockSize=2000)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm::SUMMA_TNDot")
 
     switch (CPre.GetLocalDevice())
     {
@@ -394,6 +525,9 @@ void SUMMA_TN
     case GEMM_SUMMA_A: SUMMA_TNA(orientA, alpha, A, B, C); break;
     case GEMM_SUMMA_B: SUMMA_TNB(orientA, alpha, A, B, C); break;
     case GEMM_SUMMA_C: SUMMA_TNC(orientA, alpha, A, B, C); break;
+    case GEMM_SUMMA_C_LOOKAHEAD:
+        SUMMA_TNCLookahead(orientA, alpha, A, B, C);
+        break;
     case GEMM_SUMMA_DOT: SUMMA_TNDot(orientA, alpha, A, B, C); break;
     default: LogicError("Unsupported Gemm option");
     }
@@ -82,6 +82,7 @@ void SUMMA_TTA
  AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm::SUMMA_TTA")
 
     switch (CPre.GetLocalDevice())
     {
@@ -172,6 +173,7 @@ void SUMMA_TTB
  AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm::SUMMA_TTB")
 
     switch (CPre.GetLocalDevice())
     {
@@ -260,6 +262,7 @@ void SUMMA_TTC
  AbstractDistMatrix<T>& CPre)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm::SUMMA_TTC")
 
     switch (CPre.GetLocalDevice())
     {
@@ -278,6 +281,135 @@ void SUMMA_TTC
     }
 }
 
+// Transpose Transpose Gemm that avoids communicating the matrix C, with a
+// look-ahead of one panel. The first redistributions of the (k+1)'th panels
+// of A (locally transposed) and B are performed while the local update with
+// the k'th panels runs; the rest of each is redistributed when needed.
+template <Device D, typename T, typename=EnableIf<IsDeviceValidType<T,D>>>
+void SUMMA_TTCLookahead_impl
+(Orientation orientA,
+  Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    const Int n = CPre.Width();
+    const Int sumDim = APre.Height();
+    const Int bsize = Blocksize();
+    const Grid& g = APre.Grid();
+    const bool conjugateA = (orientA == ADJOINT);
+    const bool conjugateB = (orientB == ADJOINT);
+
+    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> AProx(APre);
+    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> BProx(BPre);
+    DistMatrixReadWriteProxy<T,T,MC,MR,ELEMENT,D> CProx(CPre);
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+
+    // Temporary distributions
+    DistMatrix<T,MR,MC,ELEMENT,D> A1Trans_MR_MC(g);
+    DistMatrix<T,VR,STAR,ELEMENT,D> A1Trans_VR_STAR[2] =
+      { DistMatrix<T,VR,STAR,ELEMENT,D>(g),
+        DistMatrix<T,VR,STAR,ELEMENT,D>(g) };
+    DistMatrix<T,VC,STAR,ELEMENT,D> A1Trans_VC_STAR(g);
+    DistMatrix<T,MC,STAR,ELEMENT,D> A1Trans_MC_STAR(g);
+    DistMatrix<T,VC,STAR,ELEMENT,D> B1_VC_STAR[2] =
+      { DistMatrix<T,VC,STAR,ELEMENT,D>(g),
+        DistMatrix<T,VC,STAR,ELEMENT,D>(g) };
+    DistMatrix<T,VR,STAR,ELEMENT,D> B1_VR_STAR(g);
+    DistMatrix<T,STAR,MR,ELEMENT,D> B1Trans_STAR_MR(g);
+    CopyHandle<T> AHandle[2], BHandle[2];
+
+    A1Trans_VC_STAR.AlignWith(C);
+    A1Trans_MC_STAR.AlignWith(C);
+    B1_VR_STAR.AlignWith(C);
+    B1Trans_STAR_MR.AlignWith(C);
+
+    // A travels over the column communicator and B over the row
+    // communicator, but consecutive panels of each share one, so the handles
+    // must be started in the same order on every process (as they are here)
+    auto startPanels = [&](Int k, Int buf)
+    {
+        const Int nb = Min(bsize,sumDim-k);
+        Transpose(A(IR(k,k+nb),ALL), A1Trans_MR_MC, conjugateA);
+        AHandle[buf] = CopyAsync(A1Trans_MR_MC, A1Trans_VR_STAR[buf]);
+        BHandle[buf] = CopyAsync(B(ALL,IR(k,k+nb)), B1_VC_STAR[buf]);
+    };
+
+    if (sumDim > 0)
+        startPanels(0, 0);
+    for(Int k=0, buf=0; k<sumDim; k+=bsize, buf=1-buf)
+    {
+        AHandle[buf].Wait();
+        BHandle[buf].Wait();
+        if (k+bsize < sumDim)
+            startPanels(k+bsize, 1-buf);
+
+        A1Trans_VC_STAR = A1Trans_VR_STAR[buf];
+        A1Trans_MC_STAR = A1Trans_VC_STAR;
+        B1_VR_STAR = B1_VC_STAR[buf];
+        Transpose(B1_VR_STAR, B1Trans_STAR_MR, conjugateB);
+
+        // C[MC,MR] += alpha (A1^T)[MC,*] (B1^T)[*,MR], one block of columns at
+        // a time so that the communication of the next panels is progressed
+        // in between
+        for(Int j=0; j<n; j+=bsize)
+        {
+            const Int nbj = Min(bsize,n-j);
+            auto B1J = B1Trans_STAR_MR(ALL, IR(j,j+nbj));
+            auto CJ = C(ALL, IR(j,j+nbj));
+            LocalGemm(NORMAL, NORMAL, alpha, A1Trans_MC_STAR, B1J, T(1), CJ);
+            AHandle[1-buf].Test();
+            BHandle[1-buf].Test();
+        }
+    }
+}
+
+template <Device D, typename T,
+          typename=DisableIf<IsDeviceValidType<T,D>>, typename=void>
+void SUMMA_TTCLookahead_impl
+(Orientation orientA,
+  Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre)
+{
+    LogicError("SUMMA_TTCLookahead_impl type-device combo not supported.");
+}
+
+template<typename T>
+void SUMMA_TTCLookahead
+(Orientation orientA,
+  Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm::SUMMA_TTCLookahead")
+
+    switch (CPre.GetLocalDevice())
+    {
+    case Device::CPU:
+        SUMMA_TTCLookahead_impl<Device::CPU>(
+            orientA, orientB, alpha, APre, BPre, CPre);
+        break;
+#ifdef HYDROGEN_HAVE_CUDA
+    case Device::GPU:
+        SUMMA_TTCLookahead_impl<Device::GPU>(
+            orientA, orientB, alpha, APre, BPre, CPre);
+        break;
+#endif // HYDROGEN_HAVE_CUDA
+    default:
+        LogicError("SUMMA_TTCLookahead: Bad device.");
+    }
+}
+
 // Transpose Transpose Gemm for panel-panel dot products
 //
 // Use summations of local multiplications from a 1D distribution of A and B
@@ -357,6 +489,7 @@ void SUMMA_TTDot
  Int blockSize=2000)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("Gemm::SUMMA_TTDot")
 
     switch (CPre.GetLocalDevice())
     {
@@ -429,6 +562,9 @@ void SUMMA_TT
     case GEMM_SUMMA_C:
         SUMMA_TTC(orientA, orientB, alpha, A, B, C);
         break;
+    case GEMM_SUMMA_C_LOOKAHEAD:
+        SUMMA_TTCLookahead(orientA, orientB, alpha, A, B, C);
+        break;
     case GEMM_SUMMA_DOT:
         SUMMA_TTDot(orientA, orientB, alpha, A, B, C);
         break;
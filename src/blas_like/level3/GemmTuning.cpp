@@ -0,0 +1,200 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+
+namespace El {
+
+namespace {
+
+// The sizes of a class are the largest powers of two which are at most m, n,
+// and k (or zero). Spaces in the datatype name are replaced with underscores
+// so that each entry of the tuning file is a single whitespace-separated
+// line. The grid order is part of the class since it changes which
+// processes share the row and column communicators.
+struct TuningKey
+{
+    string orient, type;
+    int gridHeight, gridWidth;
+    char gridOrder;
+    Int m, n, k;
+};
+bool operator<( const TuningKey& a, const TuningKey& b )
+{
+    return std::tie
+           (a.orient,a.type,a.gridHeight,a.gridWidth,a.gridOrder,a.m,a.n,a.k) <
+           std::tie
+           (b.orient,b.type,b.gridHeight,b.gridWidth,b.gridOrder,b.m,b.n,b.k);
+}
+
+bool autotuning_ = false;
+std::map<TuningKey,GemmTuning> tunings_;
+
+Int SizeClass( Int size )
+{
+    if( size <= 0 )
+        return 0;
+    Int sizeClass = 1;
+    while( 2*sizeClass <= size )
+        sizeClass *= 2;
+    return sizeClass;
+}
+
+template<typename T>
+TuningKey MakeKey
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& grid )
+{
+    TuningKey key;
+    key.orient += OrientationToChar( orientA );
+    key.orient += OrientationToChar( orientB );
+    key.type = TypeName<T>();
+    std::replace( key.type.begin(), key.type.end(), ' ', '_' );
+    key.gridHeight = grid.Height();
+    key.gridWidth = grid.Width();
+    key.gridOrder = ( grid.Order() == COLUMN_MAJOR ? 'C' : 'R' );
+    key.m = SizeClass( m );
+    key.n = SizeClass( n );
+    key.k = SizeClass( k );
+    return key;
+}
+
+void ParseTunings( const string& contents, const string& filename )
+{
+    std::istringstream is( contents );
+    string line;
+    Int lineNumber = 0;
+    while( std::getline( is, line ) )
+    {
+        ++lineNumber;
+        const auto first = line.find_first_not_of( " \t" );
+        if( first == string::npos || line[first] == '#' )
+            continue;
+
+        std::istringstream lineStream( line );
+        TuningKey key;
+        string gridShape, algString;
+        GemmTuning tuning;
+        char separator;
+        lineStream >> key.orient >> key.type >> gridShape >> key.gridOrder
+                   >> key.m >> key.n >> key.k >> algString >> tuning.blocksize;
+        std::istringstream gridStream( gridShape );
+        gridStream >> key.gridHeight >> separator >> key.gridWidth;
+        if( !lineStream || !gridStream || separator != 'x' ||
+            (key.gridOrder != 'C' && key.gridOrder != 'R') ||
+            key.orient.size() != 2 || tuning.blocksize <= 0 )
+            RuntimeError
+            ("Malformed Gemm tuning on line ",lineNumber," of ",filename);
+        tuning.alg = StringToGemmAlgorithm( algString );
+        tunings_[key] = tuning;
+    }
+}
+
+} // anonymous namespace
+
+void EnableGemmAutotuning( bool enable ) EL_NO_EXCEPT
+{ autotuning_ = enable; }
+
+bool GemmAutotuningEnabled() EL_NO_EXCEPT
+{ return autotuning_; }
+
+void LoadGemmTuning( const string& filename, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    // A missing file is treated as empty so that the first autotuning run
+    // can create it
+    string contents;
+    if( mpi::Rank(comm) == 0 )
+    {
+        std::ifstream file( filename );
+        if( file.is_open() )
+        {
+            std::stringstream stream;
+            stream << file.rdbuf();
+            contents = stream.str();
+        }
+    }
+    int size = contents.size();
+    mpi::Broadcast( size, 0, comm );
+    contents.resize( size );
+    if( size > 0 )
+        mpi::Broadcast
+        ( reinterpret_cast<byte*>(&contents[0]), size, 0, comm );
+    ParseTunings( contents, filename );
+}
+
+void SaveGemmTuning( const string& filename, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    if( mpi::Rank(comm) != 0 )
+        return;
+    std::ofstream file( filename );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file << "# orientations datatype grid order m n k algorithm blocksize\n";
+    for( const auto& entry : tunings_ )
+    {
+        const TuningKey& key = entry.first;
+        file << key.orient << " " << key.type << " "
+             << key.gridHeight << "x" << key.gridWidth << " "
+             << key.gridOrder << " "
+             << key.m << " " << key.n << " " << key.k << " "
+             << GemmAlgorithmToString(entry.second.alg) << " "
+             << entry.second.blocksize << "\n";
+    }
+}
+
+void ClearGemmTuning()
+{ tunings_.clear(); }
+
+Int NumGemmTunings() EL_NO_EXCEPT
+{ return tunings_.size(); }
+
+template<typename T>
+bool LookupGemmTuning
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& grid, GemmTuning& tuning )
+{
+    EL_DEBUG_CSE
+    auto it = tunings_.find( MakeKey<T>( orientA, orientB, m, n, k, grid ) );
+    if( it == tunings_.end() )
+        return false;
+    tuning = it->second;
+    return true;
+}
+
+template<typename T>
+void RecordGemmTuning
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& grid, const GemmTuning& tuning )
+{
+    EL_DEBUG_CSE
+    tunings_[MakeKey<T>( orientA, orientB, m, n, k, grid )] = tuning;
+}
+
+#define PROTO(T) \
+  template bool LookupGemmTuning<T> \
+  ( Orientation orientA, Orientation orientB, Int m, Int n, Int k, \
+    const Grid& grid, GemmTuning& tuning ); \
+  template void RecordGemmTuning<T> \
+  ( Orientation orientA, Orientation orientB, Int m, Int n, Int k, \
+    const Grid& grid, const GemmTuning& tuning );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
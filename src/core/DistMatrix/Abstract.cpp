@@ -234,6 +234,16 @@ size_t
 AbstractDistMatrix<T>::AllocatedMemory() const EL_NO_EXCEPT
 { return LockedMatrix().MemorySize(); }
 
+template<typename T>
+Int
+AbstractDistMatrix<T>::Capacity() const EL_NO_EXCEPT
+{ return LockedMatrix().Capacity(); }
+
+template<typename T>
+void
+AbstractDistMatrix<T>::ShrinkToFit()
+{ Matrix().ShrinkToFit(); }
+
 template<typename T>
 T*
 AbstractDistMatrix<T>::Buffer() EL_NO_RELEASE_EXCEPT
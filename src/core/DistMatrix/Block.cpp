@@ -214,6 +214,19 @@ void BlockMatrix<T>::Resize( Int height, Int width )
         ( this->NewLocalHeight(height), this->NewLocalWidth(width) );
 }
 
+template<typename T>
+void BlockMatrix<T>::ReserveMemory( Int height, Int width )
+{
+    EL_DEBUG_CSE
+    if( this->Participating() )
+    {
+        const Int localHeight = this->NewLocalHeight(height);
+        const Int localWidth = this->NewLocalWidth(width);
+        const Int ldim = Max( localHeight, this->Matrix().LDim() );
+        this->Matrix().Reserve( ldim*localWidth );
+    }
+}
+
 template<typename T>
 void BlockMatrix<T>::Resize( Int height, Int width, Int ldim )
 {
@@ -551,6 +551,7 @@ template <typename T, Device D>
 void BDM::ProcessQueues(bool includeViewers)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("DistMatrix::ProcessQueues")
     const auto& grid = Grid();
     const Dist colDist = ColDist();
     const Dist rowDist = RowDist();
@@ -27,11 +27,18 @@ ElementalMatrix<T>::ElementalMatrix( const El::Grid& grid, int root )
 template <typename T>
 ElementalMatrix<T>::ElementalMatrix( ElementalMatrix<T>&& A )
 EL_NO_EXCEPT
-: AbstractDistMatrix<T>(std::move(A))
+: AbstractDistMatrix<T>(std::move(A)), stream_(std::move(A.stream_)),
+  nodeShared_(std::move(A.nodeShared_))
 { }
 
 template <typename T>
-ElementalMatrix<T>::~ElementalMatrix() { }
+ElementalMatrix<T>::~ElementalMatrix()
+{
+    if( stream_ && !mpi::Finalized() )
+        mpi::Free( stream_->comm );
+    if( nodeShared_ && !mpi::Finalized() )
+        FreeNodeShared();
+}
 
 // Assignment and reconfiguration
 // ==============================
@@ -47,10 +54,14 @@ ElementalMatrix<T>::Resize( Int height, Int width )
     )
     this->height_ = height;
     this->width_ = width;
-    if( this->Participating() )
-        this->Matrix().Resize_
-        ( Length(height,this->ColShift(),this->ColStride()),
-          Length(width,this->RowShift(),this->RowStride()) );
+    if( !this->Participating() )
+        return;
+    const Int localHeight = Length(height,this->ColShift(),this->ColStride());
+    const Int localWidth = Length(width,this->RowShift(),this->RowStride());
+    if( nodeShared_ )
+        ResizeNodeShared( localHeight, localWidth, Max(localHeight,Int(1)) );
+    else
+        this->Matrix().Resize_( localHeight, localWidth );
 }
 
 template <typename T>
@@ -67,10 +78,30 @@ ElementalMatrix<T>::Resize( Int height, Int width, Int ldim )
     )
     this->height_ = height;
     this->width_ = width;
+    if( !this->Participating() )
+        return;
+    const Int localHeight = Length(height,this->ColShift(),this->ColStride());
+    const Int localWidth = Length(width,this->RowShift(),this->RowStride());
+    if( nodeShared_ )
+        ResizeNodeShared( localHeight, localWidth, ldim );
+    else
+        this->Matrix().Resize_( localHeight, localWidth, ldim );
+}
+
+template <typename T>
+void
+ElementalMatrix<T>::ReserveMemory( Int height, Int width )
+{
+    EL_DEBUG_CSE
     if( this->Participating() )
-        this->Matrix().Resize_
-        ( Length(height,this->ColShift(),this->ColStride()),
-          Length(width,this->RowShift(),this->RowStride()), ldim );
+    {
+        const Int localHeight =
+          Length(height,this->ColShift(),this->ColStride());
+        const Int localWidth =
+          Length(width,this->RowShift(),this->RowStride());
+        const Int ldim = Max( localHeight, this->Matrix().LDim() );
+        this->Matrix().Reserve( ldim*localWidth );
+    }
 }
 
 template <typename T>
@@ -521,6 +552,8 @@ ElementalMatrix<T>::operator=( ElementalMatrix<T>&& A )
         this->rowShift_ = A.rowShift_;
         this->root_ = A.root_;
         this->grid_ = A.grid_;
+        std::swap( this->nodeShared_, A.nodeShared_ );
+        std::swap( this->stream_, A.stream_ );
     }
     return *this;
 }
@@ -589,6 +622,351 @@ Int ElementalMatrix<T>::GlobalCol( Int jLoc ) const EL_NO_EXCEPT
     return this->RowShift() + jLoc*this->RowStride();
 }
 
+// Streaming remote updates
+// ========================
+
+template <typename T>
+void ElementalMatrix<T>::SetRemoteUpdateFlushThreshold
+( Int numUpdates, Int maxPendingBytes )
+{
+    EL_DEBUG_CSE
+    if( numUpdates < 0 )
+        LogicError("Flush threshold must be non-negative");
+    if( maxPendingBytes < 0 )
+        LogicError("Limit on pending bytes must be non-negative");
+    if( numUpdates == 0 )
+    {
+        if( stream_ )
+        {
+            // Deliver anything which is still queued or in flight before
+            // tearing down the communicator
+            this->ProcessQueues();
+            mpi::Free( stream_->comm );
+            stream_.reset();
+        }
+        return;
+    }
+    if( !stream_ )
+    {
+        stream_.reset( new RemoteUpdateStream );
+        mpi::Dup( this->Grid().ViewingComm(), stream_->comm );
+        stream_->numSent.resize( mpi::Size(stream_->comm), 0 );
+    }
+    stream_->threshold = numUpdates;
+    stream_->flushAt = numUpdates;
+    stream_->maxPendingBytes = maxPendingBytes;
+}
+
+template <typename T>
+Int ElementalMatrix<T>::RemoteUpdateFlushThreshold() const EL_NO_EXCEPT
+{ return stream_ ? stream_->threshold : 0; }
+
+// Node-shared storage
+// ===================
+
+template <typename T>
+void ElementalMatrix<T>::SetNodeShared( bool nodeShared )
+{
+    EL_DEBUG_CSE
+    if( nodeShared == NodeShared() )
+        return;
+    if( this->ColDist() != STAR || this->RowDist() != STAR ||
+        this->GetLocalDevice() != Device::CPU )
+        LogicError("Only [* ,* ] matrices on the CPU can be node-shared");
+    if( this->Viewing() )
+        LogicError("Cannot change the storage of a view");
+    if( !this->Participating() )
+    {
+        nodeShared_.reset( nodeShared ? new NodeSharedStorage : nullptr );
+        return;
+    }
+
+    // Hold on to the current contents while the storage is swapped out
+    auto& localMat = this->Matrix();
+    const Int localHeight = localMat.Height();
+    const Int localWidth = localMat.Width();
+    const bool leader = NodeLeader();
+    vector<T> contents;
+    if( !nodeShared || leader )
+    {
+        contents.resize( localHeight*localWidth );
+        copy::util::InterleaveMatrix<T,Device::CPU>
+        ( localHeight, localWidth,
+          localMat.LockedBuffer(), 1, localMat.LDim(),
+          contents.data(),         1, localHeight );
+    }
+
+    if( nodeShared )
+    {
+        localMat.Empty_();
+        nodeShared_.reset( new NodeSharedStorage );
+        ResizeNodeShared
+        ( localHeight, localWidth, Max(localHeight,Int(1)) );
+    }
+    else
+    {
+        // No process may release the segment while another is reading it
+        mpi::Barrier( this->Grid().NodeComm() );
+        FreeNodeShared();
+        nodeShared_.reset();
+        localMat.SetViewType
+        ( static_cast<El::ViewType>(localMat.ViewType() & ~VIEW) );
+        localMat.Empty_();
+        localMat.Resize_( localHeight, localWidth );
+    }
+    if( !contents.empty() && (!nodeShared || leader) )
+        copy::util::InterleaveMatrix<T,Device::CPU>
+        ( localHeight, localWidth,
+          contents.data(),  1, localHeight,
+          localMat.Buffer(), 1, localMat.LDim() );
+    if( nodeShared )
+        NodeBarrier();
+}
+
+template <typename T>
+bool ElementalMatrix<T>::NodeLeader() const EL_NO_RELEASE_EXCEPT
+{ return !nodeShared_ || this->Grid().NodeRank() == 0; }
+
+template <typename T>
+void ElementalMatrix<T>::NodeBarrier() const
+{
+    EL_DEBUG_CSE
+    if( !nodeShared_ || !this->Participating() )
+        return;
+    mpi::Sync( nodeShared_->window );
+    mpi::Barrier( this->Grid().NodeComm() );
+    mpi::Sync( nodeShared_->window );
+}
+
+template <typename T>
+void ElementalMatrix<T>::ResizeNodeShared
+( Int localHeight, Int localWidth, Int ldim )
+{
+    EL_DEBUG_CSE
+    auto& storage = *nodeShared_;
+    const Int size = ldim*localWidth;
+    if( size > storage.capacity )
+    {
+        // Only the leader contributes memory to the segment, which is then
+        // addressed by every process of the node through the leader's base
+        FreeNodeShared();
+        const Int capacity = Max(size,Int(1));
+        mpi::AllocateShared
+        ( NodeLeader() ? capacity*sizeof(T) : 0,
+          this->Grid().NodeComm(), storage.window );
+        storage.buffer = static_cast<T*>( mpi::SharedBase(storage.window,0) );
+        storage.capacity = capacity;
+    }
+    this->Matrix().Attach_( localHeight, localWidth, storage.buffer, ldim );
+}
+
+template <typename T>
+void ElementalMatrix<T>::FreeNodeShared()
+{
+    EL_DEBUG_CSE
+    auto& storage = *nodeShared_;
+    if( storage.window != mpi::WIN_NULL )
+        mpi::Free( storage.window );
+    storage.window = mpi::WIN_NULL;
+    storage.buffer = nullptr;
+    storage.capacity = 0;
+}
+
+template <typename T>
+void ElementalMatrix<T>::CombineUpdates( vector<Entry<T>>& updates )
+{
+    std::sort
+    ( updates.begin(), updates.end(),
+      []( const Entry<T>& a, const Entry<T>& b )
+      { return a.j < b.j || (a.j == b.j && a.i < b.i); } );
+    const Int numUpdates = updates.size();
+    Int numCombined = 0;
+    for( Int k=0; k<numUpdates; ++k )
+    {
+        if( numCombined > 0 &&
+            updates[numCombined-1].i == updates[k].i &&
+            updates[numCombined-1].j == updates[k].j )
+            updates[numCombined-1].value += updates[k].value;
+        else
+            updates[numCombined++] = updates[k];
+    }
+    updates.resize( numCombined );
+}
+
+template <typename T>
+void ElementalMatrix<T>::FlushRemoteUpdates( vector<Entry<T>>& updates )
+{
+    EL_DEBUG_CSE
+    auto& stream = *stream_;
+    const auto& grid = this->Grid();
+    const int commRank = mpi::Rank( stream.comm );
+    const int commSize = mpi::Size( stream.comm );
+
+    CombineUpdates( updates );
+    const Int numUpdates = updates.size();
+
+    // Rather than blocking on the sends in flight (their receivers may be
+    // waiting on us in ProcessQueues), keep queueing until enough of them
+    // have completed
+    CompleteStreamedSends();
+    const Int batchBytes = numUpdates*sizeof(Entry<T>);
+    if( stream.pendingBytes > 0 &&
+        stream.pendingBytes+batchBytes > stream.maxPendingBytes )
+    {
+        ReceiveStreamedUpdates();
+        stream.flushAt = numUpdates + stream.threshold;
+        return;
+    }
+    stream.flushAt = stream.threshold;
+
+    // Every update is sent to the owner on the first redundant copy
+    const int distSize = this->DistSize();
+    vector<int> distToComm(distSize);
+    for( int distRank=0; distRank<distSize; ++distRank )
+        distToComm[distRank] =
+          grid.VCToViewing
+          (grid.CoordsToVC
+           (this->ColDist(),this->RowDist(),distRank,this->Root()));
+    vector<int> counts(commSize,0), owners(numUpdates);
+    for( Int k=0; k<numUpdates; ++k )
+    {
+        owners[k] = distToComm[this->Owner(updates[k].i,updates[k].j)];
+        ++counts[owners[k]];
+    }
+    vector<vector<Entry<T>>> buckets(commSize);
+    for( int q=0; q<commSize; ++q )
+        buckets[q].reserve( counts[q] );
+    for( Int k=0; k<numUpdates; ++k )
+        buckets[owners[k]].push_back( updates[k] );
+    SwapClear( updates );
+    SwapClear( owners );
+
+    for( int q=0; q<commSize; ++q )
+    {
+        if( counts[q] == 0 )
+            continue;
+        if( q == commRank )
+        {
+            ApplyStreamedUpdates( buckets[q] );
+            continue;
+        }
+        stream.sends.emplace_back();
+        auto& send = stream.sends.back();
+        send.buffer.swap( buckets[q] );
+        stream.pendingBytes += counts[q]*sizeof(Entry<T>);
+        mpi::TaggedISend
+        ( send.buffer.data(), counts[q], q, stream.tag, stream.comm,
+          send.request );
+        ++stream.numSent[q];
+    }
+
+    // Make progress on the traffic of the other processes without blocking
+    ReceiveStreamedUpdates();
+    CompleteStreamedSends();
+}
+
+template <typename T>
+void ElementalMatrix<T>::ReceiveStreamedUpdates()
+{
+    EL_DEBUG_CSE
+    auto& stream = *stream_;
+    mpi::Status status;
+    vector<Entry<T>> recvBuf;
+    while( mpi::IProbe( mpi::ANY_SOURCE, stream.tag, stream.comm, status ) )
+    {
+        const int count = mpi::GetCount<Entry<T>>( status );
+        recvBuf.resize( count );
+        mpi::TaggedRecv
+        ( recvBuf.data(), count, status.MPI_SOURCE, stream.tag, stream.comm );
+        ++stream.numReceived;
+        ApplyStreamedUpdates( recvBuf );
+    }
+}
+
+template <typename T>
+void ElementalMatrix<T>::ApplyStreamedUpdates
+( const vector<Entry<T>>& updates )
+{
+    EL_DEBUG_CSE
+    auto& stream = *stream_;
+    if( this->RedundantSize() == 1 )
+    {
+        for( const auto& entry : updates )
+            this->UpdateLocal
+            ( this->LocalRow(entry.i), this->LocalCol(entry.j), entry.value );
+        return;
+    }
+    for( const auto& entry : updates )
+        stream.received.push_back
+        ( Entry<T>{this->LocalRow(entry.i),this->LocalCol(entry.j),
+                   entry.value} );
+    // Keep the held-back updates proportional to the number of distinct
+    // entries they touch
+    const Int numReceived = stream.received.size();
+    if( numReceived >= 2*Max(stream.threshold,stream.numCombined) )
+    {
+        CombineUpdates( stream.received );
+        stream.numCombined = stream.received.size();
+    }
+}
+
+template <typename T>
+void ElementalMatrix<T>::CompleteStreamedSends()
+{
+    EL_DEBUG_CSE
+    auto& stream = *stream_;
+    auto& sends = stream.sends;
+    // Test every send (not only the oldest) so that the completed ones are
+    // released promptly, but keep the remainder in order
+    size_t numPending = 0;
+    for( size_t k=0; k<sends.size(); ++k )
+    {
+        if( mpi::Test( sends[k].request ) )
+        {
+            stream.pendingBytes -= sends[k].buffer.size()*sizeof(Entry<T>);
+            SwapClear( sends[k].buffer );
+        }
+        else
+        {
+            if( k != numPending )
+                std::swap( sends[numPending], sends[k] );
+            ++numPending;
+        }
+    }
+    sends.resize( numPending );
+}
+
+template <typename T>
+vector<Entry<T>> ElementalMatrix<T>::DrainRemoteUpdates()
+{
+    EL_DEBUG_CSE
+    vector<Entry<T>> updates;
+    if( !stream_ )
+        return updates;
+    auto& stream = *stream_;
+    const int commSize = mpi::Size( stream.comm );
+
+    vector<int> numRecv(commSize);
+    mpi::AllToAll( stream.numSent.data(), 1, numRecv.data(), 1, stream.comm );
+    Int numExpected = 0;
+    for( int q=0; q<commSize; ++q )
+        numExpected += numRecv[q];
+    while( stream.numReceived < numExpected )
+        ReceiveStreamedUpdates();
+    for( auto& send : stream.sends )
+        mpi::Wait( send.request );
+
+    stream.sends.clear();
+    stream.pendingBytes = 0;
+    stream.flushAt = stream.threshold;
+    std::fill( stream.numSent.begin(), stream.numSent.end(), 0 );
+    stream.numReceived = 0;
+    stream.numCombined = 0;
+    stream.tag = 1 - stream.tag;
+    updates.swap( stream.received );
+    return updates;
+}
+
 // Diagonal manipulation
 // =====================
 template <typename T>
@@ -794,6 +1172,8 @@ ElementalMatrix<T>::ShallowSwap( ElementalMatrix<T>& A )
     std::swap( this->rowShift_, A.rowShift_ );
     std::swap( this->root_, A.root_ );
     std::swap( this->grid_, A.grid_ );
+    std::swap( this->stream_, A.stream_ );
+    std::swap( this->nodeShared_, A.nodeShared_ );
 }
 
 // Instantiations for {Int,Real,Complex<Real>} for each Real in {float,double}
@@ -37,7 +37,10 @@ template <typename T, Device D>
 DM& DM::operator=(const DistMatrix<T,MC,STAR,ELEMENT,D>& A)
 {
     EL_DEBUG_CSE
-    copy::ColAllGather(A, *this);
+    if (this->NodeShared())
+        copy::NodeSharedAllGather(A, *this);
+    else
+        copy::ColAllGather(A, *this);
     return *this;
 }
 
@@ -45,7 +48,10 @@ template <typename T, Device D>
 DM& DM::operator=(const DistMatrix<T,STAR,MR,ELEMENT,D>& A)
 {
     EL_DEBUG_CSE
-    copy::RowAllGather(A, *this);
+    if (this->NodeShared())
+        copy::NodeSharedAllGather(A, *this);
+    else
+        copy::RowAllGather(A, *this);
     return *this;
 }
 
@@ -53,7 +59,10 @@ template <typename T, Device D>
 DM& DM::operator=(const DistMatrix<T,MD,STAR,ELEMENT,D>& A)
 {
     EL_DEBUG_CSE
-    copy::ColAllGather(A, *this);
+    if (this->NodeShared())
+        copy::NodeSharedAllGather(A, *this);
+    else
+        copy::ColAllGather(A, *this);
     return *this;
 }
 
@@ -61,7 +70,10 @@ template <typename T, Device D>
 DM& DM::operator=(const DistMatrix<T,STAR,MD,ELEMENT,D>& A)
 {
     EL_DEBUG_CSE
-    copy::RowAllGather(A, *this);
+    if (this->NodeShared())
+        copy::NodeSharedAllGather(A, *this);
+    else
+        copy::RowAllGather(A, *this);
     return *this;
 }
 
@@ -77,7 +89,10 @@ template <typename T, Device D>
 DM& DM::operator=(const DistMatrix<T,MR,STAR,ELEMENT,D>& A)
 {
     EL_DEBUG_CSE
-    copy::ColAllGather(A, *this);
+    if (this->NodeShared())
+        copy::NodeSharedAllGather(A, *this);
+    else
+        copy::ColAllGather(A, *this);
     return *this;
 }
 
@@ -85,7 +100,10 @@ template <typename T, Device D>
 DM& DM::operator=(const DistMatrix<T,STAR,MC,ELEMENT,D>& A)
 {
     EL_DEBUG_CSE
-    copy::RowAllGather(A, *this);
+    if (this->NodeShared())
+        copy::NodeSharedAllGather(A, *this);
+    else
+        copy::RowAllGather(A, *this);
     return *this;
 }
 
@@ -93,7 +111,10 @@ template <typename T, Device D>
 DM& DM::operator=(const DistMatrix<T,VC,STAR,ELEMENT,D>& A)
 {
     EL_DEBUG_CSE
-    copy::ColAllGather(A, *this);
+    if (this->NodeShared())
+        copy::NodeSharedAllGather(A, *this);
+    else
+        copy::ColAllGather(A, *this);
     return *this;
 }
 
@@ -101,7 +122,10 @@ template <typename T, Device D>
 DM& DM::operator=(const DistMatrix<T,STAR,VC,ELEMENT,D>& A)
 {
     EL_DEBUG_CSE
-    copy::RowAllGather(A, *this);
+    if (this->NodeShared())
+        copy::NodeSharedAllGather(A, *this);
+    else
+        copy::RowAllGather(A, *this);
     return *this;
 }
 
@@ -109,7 +133,10 @@ template <typename T, Device D>
 DM& DM::operator=(const DistMatrix<T,VR,STAR,ELEMENT,D>& A)
 {
     EL_DEBUG_CSE
-    copy::ColAllGather(A, *this);
+    if (this->NodeShared())
+        copy::NodeSharedAllGather(A, *this);
+    else
+        copy::ColAllGather(A, *this);
     return *this;
 }
 
@@ -117,7 +144,10 @@ template <typename T, Device D>
 DM& DM::operator=(const DistMatrix<T,STAR,VR,ELEMENT,D>& A)
 {
     EL_DEBUG_CSE
-    copy::RowAllGather(A, *this);
+    if (this->NodeShared())
+        copy::NodeSharedAllGather(A, *this);
+    else
+        copy::RowAllGather(A, *this);
     return *this;
 }
 
@@ -125,7 +155,10 @@ template <typename T, Device D>
 DM& DM::operator=(const DistMatrix<T,CIRC,CIRC,ELEMENT,D>& A)
 {
     EL_DEBUG_CSE
-    copy::Scatter(A, *this);
+    if (this->NodeShared())
+        copy::NodeSharedAllGather(A, *this);
+    else
+        copy::Scatter(A, *this);
     return *this;
 }
 
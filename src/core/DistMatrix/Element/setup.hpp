@@ -647,7 +647,11 @@ EL_NO_RELEASE_EXCEPT
     if (RedundantSize() == 1 && this->IsLocal(entry.i,entry.j))
         UpdateLocal(this->LocalRow(entry.i), this->LocalCol(entry.j), entry.value);
     else
+    {
         remoteUpdates_.push_back(entry);
+        if (this->RemoteUpdateFlushDue(remoteUpdates_.size()))
+            this->FlushRemoteUpdates(remoteUpdates_);
+    }
 }
 
 template <typename T, Device D>
@@ -659,48 +663,52 @@ template <typename T, Device D>
 void DM::ProcessQueues(bool includeViewers)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_REGION("DistMatrix::ProcessQueues")
     const auto& grid = Grid();
     const Dist colDist = ColDist();
     const Dist rowDist = RowDist();
-    const Int totalSend = remoteUpdates_.size();
 
     // We will first push to redundant rank 0
     const int redundantRoot = 0;
 
-    // Compute the metadata
-    // ====================
+    // Collect whatever was already streamed out by automatic flushes
+    auto streamedUpdates = this->DrainRemoteUpdates();
+
     mpi::Comm comm;
-    vector<int> sendCounts, owners(totalSend);
     if (includeViewers)
     {
         comm = grid.ViewingComm();
-        const int viewingSize = mpi::Size(grid.ViewingComm());
-        sendCounts.resize(viewingSize,0);
-        for(Int k=0; k<totalSend; ++k)
-        {
-            const Entry<T>& entry = remoteUpdates_[k];
-            const int distOwner = this->Owner(entry.i,entry.j);
-            const int vcOwner =
-              grid.CoordsToVC(colDist,rowDist,distOwner,redundantRoot);
-            owners[k] = grid.VCToViewing(vcOwner);
-            ++sendCounts[owners[k]];
-        }
     }
     else
     {
         if (!this->Participating())
             return;
         comm = grid.VCComm();
-        const int vcSize = mpi::Size(grid.VCComm());
-        sendCounts.resize(vcSize,0);
-        for(Int k=0; k<totalSend; ++k)
-        {
-            const Entry<T>& entry = remoteUpdates_[k];
-            const int distOwner = this->Owner(entry.i,entry.j);
-            owners[k] =
-              grid.CoordsToVC(colDist,rowDist,distOwner,redundantRoot);
-            ++sendCounts[owners[k]];
-        }
+    }
+    const int commSize = mpi::Size(comm);
+
+    // Combine the updates to the same entry before sending them; the sort
+    // also leaves the updates bound for each process in column-major order
+    this->CombineUpdates(remoteUpdates_);
+    const Int totalSend = remoteUpdates_.size();
+
+    // Compute the metadata
+    // ====================
+    const int distSize = DistSize();
+    vector<int> distToComm(distSize);
+    for(int distRank=0; distRank<distSize; ++distRank)
+    {
+        const int vcOwner =
+          grid.CoordsToVC(colDist,rowDist,distRank,redundantRoot);
+        distToComm[distRank] =
+          (includeViewers ? grid.VCToViewing(vcOwner) : vcOwner);
+    }
+    vector<int> sendCounts(commSize,0), owners(totalSend);
+    for(Int k=0; k<totalSend; ++k)
+    {
+        const Entry<T>& entry = remoteUpdates_[k];
+        owners[k] = distToComm[this->Owner(entry.i,entry.j)];
+        ++sendCounts[owners[k]];
     }
 
     // Pack the data
@@ -712,18 +720,69 @@ void DM::ProcessQueues(bool includeViewers)
     for(Int k=0; k<totalSend; ++k)
         sendBuf[offs[owners[k]]++] = remoteUpdates_[k];
     SwapClear(remoteUpdates_);
+    SwapClear(owners);
+
+    // Exchange the data and combine it in local coordinates
+    // =====================================================
+    auto updates = mpi::AllToAll(sendBuf, sendCounts, sendOffs, comm);
+    SwapClear(sendBuf);
+    if (!this->Participating())
+        return;
+    for(auto& entry : updates)
+    {
+        entry.i = this->LocalRow(entry.i);
+        entry.j = this->LocalCol(entry.j);
+    }
+    updates.insert
+    (updates.end(), streamedUpdates.begin(), streamedUpdates.end());
+    SwapClear(streamedUpdates);
+    this->CombineUpdates(updates);
+
+    // Only the combined updates need to be shared with the other copies. A
+    // node-shared matrix has one copy per node, which only its leader
+    // updates (the redundant root, VC rank 0, leads the first node).
+    const bool leader = this->NodeLeader();
+    if (RedundantSize() > 1 && leader)
+    {
+        mpi::Comm copyComm =
+          (this->NodeShared() ? grid.NodeLeaderComm() : RedundantComm());
+        Int numUpdates = updates.size();
+        mpi::Broadcast(numUpdates, redundantRoot, copyComm);
+        updates.resize(numUpdates);
+        mpi::Broadcast(updates.data(), numUpdates, redundantRoot, copyComm);
+    }
 
-    // Exchange and unpack the data
-    // ============================
-    auto recvBuf = mpi::AllToAll(sendBuf, sendCounts, sendOffs, comm);
-    Int recvBufSize = recvBuf.size();
-    mpi::Broadcast(recvBufSize, redundantRoot, RedundantComm());
-    recvBuf.resize(recvBufSize);
-    mpi::Broadcast
-    (recvBuf.data(), recvBufSize, redundantRoot, RedundantComm());
-    // TODO: Make this loop faster
-    for(const auto& entry : recvBuf)
-        UpdateLocal(this->LocalRow(entry.i), this->LocalCol(entry.j), entry.value);
+    // Apply the updates
+    // =================
+    if (!leader)
+    {
+        // Wait for our node leader to update the node-shared copy
+        this->NodeBarrier();
+        return;
+    }
+    const Int numUpdates = updates.size();
+    if (D == Device::CPU)
+    {
+        // Each thread applies the updates to a disjoint set of columns
+        vector<Int> colStarts;
+        for(Int k=0; k<numUpdates; ++k)
+            if (k == 0 || updates[k].j != updates[k-1].j)
+                colStarts.push_back(k);
+        colStarts.push_back(numUpdates);
+        const Int numCols = colStarts.size()-1;
+        T* buffer = this->Buffer();
+        const Int ldim = this->LDim();
+        EL_PARALLEL_FOR
+        for(Int c=0; c<numCols; ++c)
+            for(Int k=colStarts[c]; k<colStarts[c+1]; ++k)
+                buffer[updates[k].i+updates[k].j*ldim] += updates[k].value;
+    }
+    else
+    {
+        for(const auto& entry : updates)
+            UpdateLocal(entry.i, entry.j, entry.value);
+    }
+    this->NodeBarrier();
 }
 
 template <typename T, Device D>
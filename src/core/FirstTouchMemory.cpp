@@ -0,0 +1,152 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+
+#if defined(__unix__) || defined(__APPLE__)
+# include <sys/mman.h>
+# include <unistd.h>
+# define EL_HAVE_MMAP
+#endif
+
+namespace
+{
+const size_t hugePageSize_ = size_t(1) << 21;
+
+std::atomic<size_t> firstTouchThreshold_{size_t(1) << 25};
+std::atomic<bool> useExplicitHugePages_{false};
+
+// The mapped length of each live first-touch buffer
+std::mutex mappingsMutex_;
+std::unordered_map<void*,size_t>& Mappings()
+{
+    static std::unordered_map<void*,size_t> mappings;
+    return mappings;
+}
+
+void* MapPages( size_t numBytes )
+{
+#ifdef EL_HAVE_MMAP
+    const int prot = PROT_READ | PROT_WRITE;
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+# ifdef MAP_HUGETLB
+    if( useExplicitHugePages_.load() )
+    {
+        void* ptr = mmap( nullptr, numBytes, prot, flags|MAP_HUGETLB, -1, 0 );
+        if( ptr != MAP_FAILED )
+            return ptr;
+    }
+# endif
+    // Over-allocate by a huge page so that the start can be aligned to one
+    // (otherwise MADV_HUGEPAGE could not back the range with huge pages),
+    // then return the unused head and tail to the system
+    const size_t paddedBytes = numBytes + hugePageSize_;
+    void* padded = mmap( nullptr, paddedBytes, prot, flags, -1, 0 );
+    if( padded == MAP_FAILED )
+        return nullptr;
+    const auto paddedAddress = reinterpret_cast<std::uintptr_t>(padded);
+    const auto address =
+      (paddedAddress+hugePageSize_-1) & ~std::uintptr_t(hugePageSize_-1);
+    const size_t headBytes = address - paddedAddress;
+    const size_t tailBytes = paddedBytes - headBytes - numBytes;
+    if( headBytes > 0 )
+        munmap( padded, headBytes );
+    if( tailBytes > 0 )
+        munmap( reinterpret_cast<void*>(address+numBytes), tailBytes );
+    void* ptr = reinterpret_cast<void*>(address);
+# ifdef MADV_HUGEPAGE
+    madvise( ptr, numBytes, MADV_HUGEPAGE );
+# endif
+    return ptr;
+#else
+    void* ptr = nullptr;
+    if( posix_memalign( &ptr, hugePageSize_, numBytes ) != 0 )
+        return nullptr;
+    return ptr;
+#endif
+}
+
+void UnmapPages( void* ptr, size_t numBytes )
+{
+#ifdef EL_HAVE_MMAP
+    munmap( ptr, numBytes );
+#else
+    std::free( ptr );
+#endif
+}
+
+} // namespace <anon>
+
+namespace El
+{
+
+size_t FirstTouchThreshold()
+{ return firstTouchThreshold_.load(); }
+
+void SetFirstTouchThreshold( size_t numBytes )
+{ firstTouchThreshold_.store( numBytes ); }
+
+bool UsingExplicitHugePages()
+{ return useExplicitHugePages_.load(); }
+
+void SetUseExplicitHugePages( bool useExplicit )
+{ useExplicitHugePages_.store( useExplicit ); }
+
+void* FirstTouchAllocate( size_t numBytes )
+{
+    if( numBytes == 0 )
+        return nullptr;
+    const size_t mappedBytes =
+      ((numBytes+hugePageSize_-1)/hugePageSize_)*hugePageSize_;
+    byte* ptr = static_cast<byte*>(MapPages( mappedBytes ));
+    if( ptr == nullptr )
+        throw std::bad_alloc();
+
+    // Touch each page from the thread which will later operate on it. The
+    // level-1 kernels statically partition the columns of a matrix, and
+    // hence (contiguous) blocks of its buffer, across the threads.
+#ifdef EL_HAVE_MMAP
+    const size_t pageSize = sysconf(_SC_PAGESIZE);
+#else
+    const size_t pageSize = 4096;
+#endif
+    const Int numPages = (mappedBytes+pageSize-1) / pageSize;
+#ifdef EL_HYBRID
+    #pragma omp parallel for schedule(static)
+#endif
+    for( Int page=0; page<numPages; ++page )
+        ptr[page*pageSize] = 0;
+
+    std::lock_guard<std::mutex> lock(mappingsMutex_);
+    Mappings()[ptr] = mappedBytes;
+    return ptr;
+}
+
+bool FirstTouchFree( void* ptr )
+{
+    size_t mappedBytes;
+    {
+        std::lock_guard<std::mutex> lock(mappingsMutex_);
+        auto& mappings = Mappings();
+        auto it = mappings.find( ptr );
+        if( it == mappings.end() )
+            return false;
+        mappedBytes = it->second;
+        mappings.erase( it );
+    }
+    UnmapPages( ptr, mappedBytes );
+    return true;
+}
+
+} // namespace El
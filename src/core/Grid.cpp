@@ -11,8 +11,165 @@
 
 namespace El {
 
+namespace {
+
+// The inverse of a modulo m, where a and m are coprime
+int ModularInverse( int a, int m )
+{
+    int t=0, tNew=1, r=m, rNew=Mod(a,m);
+    while( rNew != 0 )
+    {
+        const int q = r / rNew;
+        const int tNext = t - q*tNew;
+        t = tNew;
+        tNew = tNext;
+        const int rNext = r - q*rNew;
+        r = rNew;
+        rNew = rNext;
+    }
+    return Mod(t,m);
+}
+
+// The position of the process in row mcRank and column mrRank along the
+// diagonal which starts at (0,diag) and wraps around the grid. This is the
+// k in [0,lcm) with k = mcRank (mod height) and k = mrRank-diag (mod width).
+int DiagonalRank( int mcRank, int mrRank, int diag, int height, int width,
+                  int gcd )
+{
+    const int heightRed = height / gcd;
+    const int widthRed = width / gcd;
+    const long long shift = Mod( (mrRank-diag-mcRank)/gcd, widthRed );
+    const long long t = shift*ModularInverse(heightRed,widthRed) % widthRed;
+    return mcRank + height*int(t);
+}
+
+// The time for a process to take part in numStages rounds of messages which
+// deliver the given number of bytes in total over a communicator with
+// commSize members, numLocal of which (including itself) share its node
+double ExchangeCost
+( double numStages, double bytes, int commSize, int numLocal,
+  const GridCostModel& model )
+{
+    if( commSize == 1 )
+        return 0;
+    const double offNode = double(commSize-numLocal) / commSize;
+    const double alpha =
+      ( numLocal < commSize ? model.alphaInter : model.alphaIntra );
+    const double beta =
+      offNode*model.betaInter + (1-offNode)*model.betaIntra;
+    return alpha*numStages + beta*bytes;
+}
+
+double LogSteps( int commSize )
+{ return std::ceil( std::log2( double(commSize) ) ); }
+
+// The predicted time of the given SUMMA variant for a process whose MC, MR,
+// and VC communicators have the given numbers of members on its node
+double SUMMACost
+( GemmAlgorithm alg, Int m, Int n, Int k, int height, int width,
+  int localMC, int localMR, int localVC, const GridCostModel& model )
+{
+    const int size = height*width;
+    const Int blocksize = ( model.blocksize > 0 ? model.blocksize : 128 );
+    const double entrySize = model.entrySize;
+    const double mLoc = MaxLength(m,height);
+    const double nLoc = MaxLength(n,width);
+    const double kLocMC = MaxLength(k,height);
+    const double kLocMR = MaxLength(k,width);
+    const double fracMC = double(height-1) / height;
+    const double fracMR = double(width-1) / width;
+    switch( alg )
+    {
+    case GEMM_SUMMA_A:
+    {
+        // B1[VR,* ] <- B1[MC,MR], B1^T[* ,MR] <- B1[VR,* ], and the
+        // reduce-scatter of D1[MC,* ] within each grid row
+        const double numSteps = double(MaxLength(n,blocksize));
+        return
+          ExchangeCost
+          ( numSteps*LogSteps(size), n*double(k)/size*entrySize,
+            size, localVC, model ) +
+          ExchangeCost
+          ( numSteps*LogSteps(height), n*kLocMR*fracMC*entrySize,
+            height, localMC, model ) +
+          ExchangeCost
+          ( numSteps*LogSteps(width), n*mLoc*fracMR*entrySize,
+            width, localMR, model ) +
+          model.gamma*2*mLoc*kLocMR*n;
+    }
+    case GEMM_SUMMA_B:
+    {
+        // A1[* ,MC] <- A1[MC,MR] and the reduce-scatter of D1^T[MR,* ]
+        // within each grid column
+        const double numSteps = double(MaxLength(m,blocksize));
+        return
+          ExchangeCost
+          ( numSteps*LogSteps(size), m*double(k)/size*entrySize,
+            size, localVC, model ) +
+          ExchangeCost
+          ( numSteps*LogSteps(width), m*kLocMC*fracMR*entrySize,
+            width, localMR, model ) +
+          ExchangeCost
+          ( numSteps*LogSteps(height), m*nLoc*fracMC*entrySize,
+            height, localMC, model ) +
+          model.gamma*2*nLoc*kLocMC*m;
+    }
+    case GEMM_SUMMA_C:
+    case GEMM_SUMMA_C_LOOKAHEAD:
+    {
+        // A1[MC,* ] <- A1[MC,MR] and B1^T[MR,* ] <- B1[MC,MR]
+        const double numSteps = double(MaxLength(k,blocksize));
+        const double commCost =
+          ExchangeCost
+          ( numSteps*LogSteps(width), k*mLoc*fracMR*entrySize,
+            width, localMR, model ) +
+          ExchangeCost
+          ( numSteps*LogSteps(height), k*nLoc*fracMC*entrySize,
+            height, localMC, model );
+        const double computeCost = model.gamma*2*mLoc*nLoc*k;
+        if( alg == GEMM_SUMMA_C )
+            return commCost + computeCost;
+        // Only the communication of the first panels is not hidden behind
+        // the local updates
+        return Max(commCost,computeCost) + commCost/Max(numSteps,1.);
+    }
+    case GEMM_CANNON:
+    {
+        // Ring gathers of the local blocks of A (B) within each grid row
+        // (column) onto the gcd x gcd sub-grids, then one circular shift
+        // of the packages per step within each sub-grid. All but the
+        // initial shift are hidden behind the local updates.
+        const int gcd = El::GCD( height, width );
+        const int numBlocksA = width / gcd;
+        const int numBlocksB = height / gcd;
+        const double kLoc = MaxLength(k,gcd);
+        const double gatherCost =
+          ExchangeCost
+          ( numBlocksA-1, (numBlocksA-1)*mLoc*kLocMR*entrySize,
+            width, localMR, model ) +
+          ExchangeCost
+          ( numBlocksB-1, (numBlocksB-1)*kLocMC*nLoc*entrySize,
+            height, localMC, model );
+        const double shiftCost =
+          ExchangeCost( 1, mLoc*kLoc*entrySize, width, localMR, model ) +
+          ExchangeCost( 1, kLoc*nLoc*entrySize, height, localMC, model );
+        const double computeCost = model.gamma*2*mLoc*nLoc*k;
+        return gatherCost + shiftCost +
+          Max( (gcd-1)*shiftCost, computeCost );
+    }
+    default:
+        LogicError("No grid cost model for this Gemm algorithm");
+        return 0;
+    }
+}
+
+} // namespace <anon>
+
 Grid* Grid::defaultGrid = 0;
 Grid* Grid::trivialGrid = 0;
+vector<std::unique_ptr<Grid>> Grid::cachedGrids;
+double Grid::constructionTime = 0;
+Int Grid::numCacheHits = 0;
 
 void Grid::InitializeDefault()
 {
@@ -40,6 +197,52 @@ void Grid::FinalizeTrivial()
     trivialGrid = 0;
 }
 
+const Grid& Grid::Cached( mpi::Comm comm, int height, GridOrder order )
+{
+    EL_DEBUG_CSE
+    for( const auto& grid : cachedGrids )
+        if( !grid->HaveViewers() && grid->Height() == height &&
+            grid->Order() == order && Congruent(comm,grid->ViewingComm()) )
+        {
+            ++numCacheHits;
+            return *grid;
+        }
+    cachedGrids.emplace_back( new Grid(comm,height,order) );
+    return *cachedGrids.back();
+}
+
+const Grid& Grid::Cached( mpi::Comm comm, GridOrder order )
+{
+    EL_DEBUG_CSE
+    return Cached( comm, DefaultHeight(mpi::Size(comm)), order );
+}
+
+const Grid& Grid::Cached
+( mpi::Comm viewers, mpi::Group owners, int height, GridOrder order )
+{
+    EL_DEBUG_CSE
+    for( const auto& grid : cachedGrids )
+        if( grid->HaveViewers() && grid->Height() == height &&
+            grid->Order() == order &&
+            Congruent(viewers,grid->ViewingComm()) &&
+            Congruent(owners,grid->OwningGroup()) )
+        {
+            ++numCacheHits;
+            return *grid;
+        }
+    cachedGrids.emplace_back( new Grid(viewers,owners,height,order) );
+    return *cachedGrids.back();
+}
+
+void Grid::ClearCache()
+{
+    EL_DEBUG_CSE
+    cachedGrids.clear();
+}
+
+double Grid::ConstructionTime() EL_NO_EXCEPT { return constructionTime; }
+Int Grid::NumCacheHits() EL_NO_EXCEPT { return numCacheHits; }
+
 const Grid& Grid::Default() EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
@@ -72,10 +275,99 @@ int Grid::DefaultHeight( int gridSize ) EL_NO_EXCEPT
     return gridHeight;
 }
 
+GridSuggestion Grid::Suggest
+( mpi::Comm comm, Int m, Int n, Int k, GemmAlgorithm alg,
+  const GridCostModel& model )
+{
+    EL_DEBUG_CSE
+    if( alg == GEMM_SUMMA_DOT )
+        LogicError("The cost of GEMM_SUMMA_DOT does not depend on the grid");
+    GridCostModel modelCopy( model );
+    if( modelCopy.blocksize <= 0 )
+        modelCopy.blocksize = Blocksize();
+
+    // Label each process by the first rank on its node
+    const int size = mpi::Size( comm );
+    mpi::Comm nodeComm;
+    mpi::SplitShared( comm, mpi::Rank(comm), nodeComm );
+    int nodeLabel = mpi::Rank( comm );
+    mpi::Broadcast( nodeLabel, 0, nodeComm );
+    mpi::Free( nodeComm );
+    vector<int> nodeLabels( size );
+    mpi::AllGather( &nodeLabel, 1, nodeLabels.data(), 1, comm );
+
+    vector<GemmAlgorithm> algs;
+    if( alg == GEMM_DEFAULT )
+        algs = { GEMM_SUMMA_A, GEMM_SUMMA_B, GEMM_SUMMA_C };
+    else
+        algs = { alg };
+
+    // Every process evaluates every candidate (the slowest process of each
+    // determines its cost), so all of them arrive at the same suggestion
+    GridSuggestion best;
+    best.height = DefaultHeight( size );
+    best.order = COLUMN_MAJOR;
+    best.alg = algs[0];
+    best.cost = std::numeric_limits<double>::infinity();
+    std::map<std::pair<int,int>,int> numPerColNode, numPerRowNode;
+    std::map<int,int> numPerNode;
+    for( int label : nodeLabels )
+        ++numPerNode[label];
+    for( const GridOrder order : {COLUMN_MAJOR,ROW_MAJOR} )
+    {
+        for( int height=1; height<=size; ++height )
+        {
+            if( size % height != 0 )
+                continue;
+            const int width = size / height;
+            auto coords = [&]( int rank )
+            {
+                if( order == COLUMN_MAJOR )
+                    return std::make_pair( rank % height, rank / height );
+                else
+                    return std::make_pair( rank / width, rank % width );
+            };
+            numPerColNode.clear();
+            numPerRowNode.clear();
+            for( int rank=0; rank<size; ++rank )
+            {
+                const auto rowCol = coords( rank );
+                ++numPerColNode[{rowCol.second,nodeLabels[rank]}];
+                ++numPerRowNode[{rowCol.first,nodeLabels[rank]}];
+            }
+            for( const GemmAlgorithm candidate : algs )
+            {
+                double cost = 0;
+                for( int rank=0; rank<size; ++rank )
+                {
+                    const auto rowCol = coords( rank );
+                    const int label = nodeLabels[rank];
+                    cost = Max
+                    ( cost,
+                      SUMMACost
+                      ( candidate, m, n, k, height, width,
+                        numPerColNode[{rowCol.second,label}],
+                        numPerRowNode[{rowCol.first,label}],
+                        numPerNode[label], modelCopy ) );
+                }
+                if( cost < best.cost )
+                {
+                    best.height = height;
+                    best.order = order;
+                    best.alg = candidate;
+                    best.cost = cost;
+                }
+            }
+        }
+    }
+    return best;
+}
+
 Grid::Grid( mpi::Comm comm, GridOrder order )
 : haveViewers_(false), order_(order)
 {
     EL_DEBUG_CSE
+    const double startTime = mpi::Time();
 
     // Extract our rank, the underlying group, and the number of processes
     mpi::Dup( comm, viewingComm_ );
@@ -88,12 +380,14 @@ Grid::Grid( mpi::Comm comm, GridOrder order )
     // Factor p
     height_ = DefaultHeight( size_ );
     SetUpGrid();
+    constructionTime += mpi::Time() - startTime;
 }
 
 Grid::Grid( mpi::Comm comm, int height, GridOrder order )
 : haveViewers_(false), order_(order)
 {
     EL_DEBUG_CSE
+    const double startTime = mpi::Time();
 
     // Extract our rank, the underlying group, and the number of processes
     mpi::Dup( comm, viewingComm_ );
@@ -108,6 +402,7 @@ Grid::Grid( mpi::Comm comm, int height, GridOrder order )
         LogicError("Process grid dimensions must be non-negative");
 
     SetUpGrid();
+    constructionTime += mpi::Time() - startTime;
 }
 
 void Grid::SetUpGrid()
@@ -122,14 +417,32 @@ void Grid::SetUpGrid()
 
     const int width = size_ / height_;
     gcd_ = El::GCD( height_, width );
-    int lcm = size_ / gcd_;
 
     // Create the communicator for the owning group (mpi::COMM_NULL otherwise)
     mpi::Create( viewingComm_, owningGroup_, owningComm_ );
+    NameComm( viewingComm_, "Viewing" );
+    NameComm( owningComm_, "Owning" );
 
+    // The diagonal of each process, and its position along it, as well as
+    // the map from the VC ranks to the viewingGroup_ ranks, only depend upon
+    // the shape of the grid and can be computed by every viewing process
     vcToViewing_.resize(size_);
     diagsAndRanks_.resize(2*size_);
-    MemZero( diagsAndRanks_.data(), 2*size_ );
+    vector<int> owningRanks(size_);
+    for( int vcRank=0; vcRank<size_; ++vcRank )
+    {
+        const int mcRank = vcRank % height_;
+        const int mrRank = vcRank / height_;
+        const int diag = Mod( mrRank-mcRank, gcd_ );
+        diagsAndRanks_[2*vcRank] = diag;
+        diagsAndRanks_[2*vcRank+1] =
+          DiagonalRank( mcRank, mrRank, diag, height_, width, gcd_ );
+        owningRanks[vcRank] = VCToOwning( vcRank );
+    }
+    mpi::Translate
+    ( owningGroup_, size_, owningRanks.data(),
+      viewingGroup_, vcToViewing_.data() );
+
     const bool colMajor = (order_==COLUMN_MAJOR);
     if( InGrid() )
     {
@@ -161,64 +474,39 @@ void Grid::SetUpGrid()
         mcRank_ = mpi::Rank( mcComm_ );
         mrRank_ = mpi::Rank( mrComm_ );
 
-        // Set up the VectorCol and VectorRow communicators
+        // Set up the VectorCol communicator
         vcRank_ = mcRank_ + height_*mrRank_;
         vrRank_ = mrRank_ + width*mcRank_;
         mpi::Split( cartComm_, 0, vcRank_, vcComm_ );
-        mpi::Split( cartComm_, 0, vrRank_, vrComm_ );
-
-        // Set up the map from the VC group to the viewingGroup_ ranks.
-        vector<int> ranks(size_);
-        for( int i=0; i<size_; ++i )
-            ranks[i] = i;
-        mpi::Translate
-        ( vcComm_, size_, ranks.data(), viewingGroup_,  vcToViewing_.data() );
-
-        // Compute which diagonal we're in, and what our rank is, then
-        // perform AllGather world to store everyone's info
-        vector<int> myDiagAndRank(2);
-        myDiagAndRank[0] = mdPerpRank_ = Mod(mrRank_-mcRank_,gcd_);
-        int diagRank = 0;
-        int row = 0;
-        int col = myDiagAndRank[0];
-        for( int j=0; j<lcm; ++j )
-        {
-            if( row == mcRank_ && col == mrRank_ )
-            {
-                myDiagAndRank[1] = mdRank_ = diagRank;
-                break;
-            }
-            else
-            {
-                row = (row + 1) % height_;
-                col = (col + 1) % width;
-                ++diagRank;
-            }
-        }
-        mpi::AllGather
-        ( myDiagAndRank.data(),  2,
-          diagsAndRanks_.data(), 2, vcComm_ );
 
-        mpi::Split( cartComm_, mdPerpRank_, mdRank_,     mdComm_     );
-        mpi::Split( cartComm_, mdRank_,     mdPerpRank_, mdPerpComm_ );
+        NameComm( cartComm_, "Cart" );
+        NameComm( mcComm_, "MC" );
+        NameComm( mrComm_, "MR" );
+        NameComm( vcComm_, "VC" );
+
+        mdPerpRank_ = diagsAndRanks_[2*vcRank_];
+        mdRank_ = diagsAndRanks_[2*vcRank_+1];
 
         EL_DEBUG_ONLY(
           mpi::ErrorHandlerSet( mcComm_,     mpi::ERRORS_RETURN );
           mpi::ErrorHandlerSet( mrComm_,     mpi::ERRORS_RETURN );
           mpi::ErrorHandlerSet( vcComm_,     mpi::ERRORS_RETURN );
-          mpi::ErrorHandlerSet( vrComm_,     mpi::ERRORS_RETURN );
-          mpi::ErrorHandlerSet( mdComm_,     mpi::ERRORS_RETURN );
-          mpi::ErrorHandlerSet( mdPerpComm_, mpi::ERRORS_RETURN );
         )
+
+        // Forming the remaining communicators is collective (over the
+        // members of each when MPI_Comm_create_group is available and
+        // otherwise over all of the owning processes), so they are formed
+        // here rather than when first requested, which is often by only some
+        // of the processes
+        SetUpVRComm();
+        SetUpMDComm();
+        SetUpMDPerpComm();
     }
     else
     {
         mcComm_     = mpi::COMM_NULL;
         mrComm_     = mpi::COMM_NULL;
-        mdComm_     = mpi::COMM_NULL;
-        mdPerpComm_ = mpi::COMM_NULL;
         vcComm_     = mpi::COMM_NULL;
-        vrComm_     = mpi::COMM_NULL;
 
         mcRank_     = mpi::UNDEFINED;
         mrRank_     = mpi::UNDEFINED;
@@ -226,41 +514,201 @@ void Grid::SetUpGrid()
         mdPerpRank_ = mpi::UNDEFINED;
         vcRank_     = mpi::UNDEFINED;
         vrRank_     = mpi::UNDEFINED;
+    }
+}
+
+// The node hierarchy and the BLACS contexts are only formed when first
+// requested, which every internal path does collectively
+// -----------------------------------------------------------------------
+
+int Grid::VCToOwning( int vcRank ) const EL_NO_EXCEPT
+{
+    // The cartesian communicator orders the processes by their VC (VR) ranks
+    // in a column-major (row-major) grid
+    return ( order_==COLUMN_MAJOR ? vcRank : VCToVR(vcRank) );
+}
 
-        // diags and ranks are implicitly set to undefined
+void Grid::CreateFromVCRanks
+( const vector<int>& vcRanks, int tag, mpi::Comm& comm ) const
+{
+    EL_DEBUG_CSE
+    vector<int> ranks( vcRanks.size() );
+    for( size_t k=0; k<vcRanks.size(); ++k )
+        ranks[k] = VCToOwning( vcRanks[k] );
+    mpi::Group cartGroup, group;
+    mpi::CommGroup( cartComm_, cartGroup );
+    mpi::Incl( cartGroup, ranks.size(), ranks.data(), group );
+    mpi::Create( cartComm_, group, tag, comm );
+    mpi::Free( group );
+    mpi::Free( cartGroup );
+    EL_DEBUG_ONLY(mpi::ErrorHandlerSet( comm, mpi::ERRORS_RETURN ))
+}
+
+void Grid::NameComm( mpi::Comm comm, const string& suffix ) const
+{
+    EL_DEBUG_CSE
+    mpi::SetName
+    ( comm,
+      std::to_string(height_)+"x"+std::to_string(size_/height_)+"."+suffix );
+}
+
+void Grid::NameComms
+( const mpi::NodeHierarchy& hierarchy, const string& suffix ) const
+{
+    EL_DEBUG_CSE
+    NameComm( hierarchy.nodeComm, suffix+".Node" );
+    NameComm( hierarchy.leaderComm, suffix+".Leaders" );
+}
+
+void Grid::SetUpLazily( void (Grid::*setUp)() const ) const
+{
+    EL_DEBUG_CSE
+    const double startTime = mpi::Time();
+    (this->*setUp)();
+    constructionTime += mpi::Time() - startTime;
+}
+
+void Grid::SetUpVRComm()
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI_COMM_CREATE_GROUP
+    vector<int> vcRanks(size_);
+    for( int vrRank=0; vrRank<size_; ++vrRank )
+        vcRanks[vrRank] = VRToVC( vrRank );
+    CreateFromVCRanks( vcRanks, 0, vrComm_ );
+#else
+    mpi::Split( cartComm_, 0, vrRank_, vrComm_ );
+    EL_DEBUG_ONLY(mpi::ErrorHandlerSet( vrComm_, mpi::ERRORS_RETURN ))
+#endif
+    NameComm( vrComm_, "VR" );
+}
+
+void Grid::SetUpMDComm()
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI_COMM_CREATE_GROUP
+    // Only the processes on our diagonal take part
+    vector<int> vcRanks( MDSize() );
+    for( int vcRank=0; vcRank<size_; ++vcRank )
+        if( Diag(vcRank) == mdPerpRank_ )
+            vcRanks[DiagRank(vcRank)] = vcRank;
+    CreateFromVCRanks( vcRanks, 1, mdComm_ );
+#else
+    mpi::Split( cartComm_, mdPerpRank_, mdRank_, mdComm_ );
+    EL_DEBUG_ONLY(mpi::ErrorHandlerSet( mdComm_, mpi::ERRORS_RETURN ))
+#endif
+    NameComm( mdComm_, "MD" );
+}
+
+void Grid::SetUpMDPerpComm()
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI_COMM_CREATE_GROUP
+    // Only the processes at our position along their diagonals take part
+    vector<int> vcRanks( MDPerpSize() );
+    for( int vcRank=0; vcRank<size_; ++vcRank )
+        if( DiagRank(vcRank) == mdRank_ )
+            vcRanks[Diag(vcRank)] = vcRank;
+    CreateFromVCRanks( vcRanks, 2, mdPerpComm_ );
+#else
+    mpi::Split( cartComm_, mdRank_, mdPerpRank_, mdPerpComm_ );
+    EL_DEBUG_ONLY(mpi::ErrorHandlerSet( mdPerpComm_, mpi::ERRORS_RETURN ))
+#endif
+    NameComm( mdPerpComm_, "MDPerp" );
+}
+
+void Grid::SetUpNodes() const
+{
+    EL_DEBUG_CSE
+    mpi::Create( vcComm_, vcNodes_ );
+    NameComms( vcNodes_, "VC" );
+}
+
+const Grid::Layers& Grid::SetUpLayers( int numLayers ) const
+{
+    EL_DEBUG_CSE
+    for( const auto& layers : layers_ )
+        if( layers->numLayers == numLayers )
+            return *layers;
+    if( numLayers < 1 || size_ % numLayers != 0 )
+        LogicError
+        ("The number of layers, ",numLayers,", does not evenly divide the "
+         "grid size, ",size_);
+
+    std::unique_ptr<Layers> layers( new Layers );
+    layers->numLayers = numLayers;
+    const int layerSize = size_ / numLayers;
+    const int layerHeight = DefaultHeight( layerSize );
+    vector<int> ranks( layerSize );
+    for( int layer=0; layer<numLayers; ++layer )
+    {
+        for( int q=0; q<layerSize; ++q )
+            ranks[q] = VCToOwning( layer*layerSize+q );
+        mpi::Group layerGroup;
+        mpi::Incl( owningGroup_, layerSize, ranks.data(), layerGroup );
+        layers->grids.emplace_back
+        ( new Grid( viewingComm_, layerGroup, layerHeight ) );
+        mpi::Free( layerGroup );
+    }
+    if( InGrid() )
+    {
+        // The owning ranks of a layer's grid follow our VC ranks, so the
+        // two grids of our layer agree on the MC and MR ranks
+        const int layer = vcRank_ / layerSize;
+        layers->ownGrid.reset
+        ( new Grid( layers->grids[layer]->OwningComm(), layerHeight ) );
+        const double startTime = mpi::Time();
+        mpi::Split( vcComm_, vcRank_ % layerSize, layer, layers->depthComm );
+        NameComm( layers->depthComm, "Depth"+std::to_string(numLayers) );
+        constructionTime += mpi::Time() - startTime;
     }
-    // Translate the rank of the root process of the owningGroup so that we can
-    // broadcast data
-    int owningRoot = mpi::Translate( owningGroup_, 0, viewingGroup_ );
-    mpi::Broadcast( vcToViewing_.data(), size_, owningRoot, viewingComm_ );
-    mpi::Broadcast( diagsAndRanks_.data(), 2*size_, owningRoot, viewingComm_ );
+    layers_.emplace_back( std::move(layers) );
+    return *layers_.back();
+}
 
 #ifdef EL_HAVE_SCALAPACK
+void Grid::SetUpBlacs() const
+{
+    EL_DEBUG_CSE
     blacsVCHandle_ = blacs::Handle( vcComm_.comm );
-    blacsVRHandle_ = blacs::Handle( vrComm_.comm );
+    blacsVRHandle_ = blacs::Handle( VRComm().comm );
     blacsMCMRContext_ =
       blacs::GridInit
-      ( blacsVCHandle_, true /* column major */, height_, width );
-#endif
+      ( blacsVCHandle_, true /* column major */, height_, size_/height_ );
+    haveBlacs_ = true;
 }
+#endif
 
 Grid::~Grid()
 {
+    InvalidateRedistributionPlans( *this );
     if( !mpi::Finalized() )
     {
 #ifdef EL_HAVE_SCALAPACK
-        blacs::FreeGrid( blacsMCMRContext_ );
-        blacs::FreeHandle( blacsVRHandle_ );
-        blacs::FreeHandle( blacsVCHandle_ );
+        if( haveBlacs_ )
+        {
+            blacs::FreeGrid( blacsMCMRContext_ );
+            blacs::FreeHandle( blacsVRHandle_ );
+            blacs::FreeHandle( blacsVCHandle_ );
+        }
 #endif
         if( InGrid() )
         {
-            mpi::Free( mdComm_ );
-            mpi::Free( mdPerpComm_ );
+            for( auto& layers : layers_ )
+                mpi::Free( layers->depthComm );
+            mpi::Free( mcNodes_ );
+            mpi::Free( mrNodes_ );
+            mpi::Free( vcNodes_ );
+            mpi::Free( vrNodes_ );
+            if( mdComm_ != mpi::COMM_NULL )
+                mpi::Free( mdComm_ );
+            if( mdPerpComm_ != mpi::COMM_NULL )
+                mpi::Free( mdPerpComm_ );
             mpi::Free( mcComm_ );
             mpi::Free( mrComm_ );
             mpi::Free( vcComm_ );
-            mpi::Free( vrComm_ );
+            if( vrComm_ != mpi::COMM_NULL )
+                mpi::Free( vrComm_ );
             mpi::Free( cartComm_ );
             mpi::Free( owningComm_ );
         }
@@ -287,10 +735,10 @@ int Grid::VRSize()     const EL_NO_EXCEPT { return size_;         }
 
 mpi::Comm Grid::MCComm()     const EL_NO_EXCEPT { return mcComm_;     }
 mpi::Comm Grid::MRComm()     const EL_NO_EXCEPT { return mrComm_;     }
-mpi::Comm Grid::MDComm()     const EL_NO_EXCEPT { return mdComm_;     }
-mpi::Comm Grid::MDPerpComm() const EL_NO_EXCEPT { return mdPerpComm_; }
 mpi::Comm Grid::VCComm()     const EL_NO_EXCEPT { return vcComm_;     }
 mpi::Comm Grid::VRComm()     const EL_NO_EXCEPT { return vrComm_;     }
+mpi::Comm Grid::MDComm()     const EL_NO_EXCEPT { return mdComm_;     }
+mpi::Comm Grid::MDPerpComm() const EL_NO_EXCEPT { return mdPerpComm_; }
 
 // Provided for simplicity, but redundant
 // ======================================
@@ -316,6 +764,7 @@ Grid::Grid( mpi::Comm viewers, mpi::Group owners, int height, GridOrder order )
 : haveViewers_(true), order_(order)
 {
     EL_DEBUG_CSE
+    const double startTime = mpi::Time();
 
     // Extract our rank and the underlying group from the viewing comm
     mpi::Dup( viewers, viewingComm_ );
@@ -330,11 +779,36 @@ Grid::Grid( mpi::Comm viewers, mpi::Group owners, int height, GridOrder order )
         LogicError("Process grid dimensions must be non-negative");
 
     SetUpGrid();
+    constructionTime += mpi::Time() - startTime;
 }
 
 int Grid::GCD() const EL_NO_EXCEPT { return gcd_; }
 int Grid::LCM() const EL_NO_EXCEPT { return size_/gcd_; }
 
+int Grid::Layer( int numLayers ) const EL_NO_RELEASE_EXCEPT
+{ return ( InGrid() ? vcRank_ / (size_/numLayers) : mpi::UNDEFINED ); }
+
+const Grid& Grid::LayerGrid( int numLayers, int layer ) const
+{
+    EL_DEBUG_CSE
+    const Layers& layers = SetUpLayers( numLayers );
+    if( layer < 0 || layer >= numLayers )
+        LogicError("Invalid layer ",layer," of ",numLayers);
+    return *layers.grids[layer];
+}
+
+const Grid& Grid::OwnLayerGrid( int numLayers ) const
+{
+    EL_DEBUG_CSE
+    const Layers& layers = SetUpLayers( numLayers );
+    if( !InGrid() )
+        LogicError("Only the owning processes have a layer");
+    return *layers.ownGrid;
+}
+
+mpi::Comm Grid::DepthComm( int numLayers ) const
+{ return SetUpLayers( numLayers ).depthComm; }
+
 bool Grid::HaveViewers() const EL_NO_EXCEPT { return haveViewers_; }
 bool Grid::InGrid() const EL_NO_RELEASE_EXCEPT { return inGrid_; }
 
@@ -413,6 +887,79 @@ int Grid::CoordsToVC
 int Grid::VCToViewing( int vcRank ) const EL_NO_EXCEPT
 { return vcToViewing_[vcRank]; }
 
+// Node-aware routines
+// ===================
+
+mpi::Comm Grid::NodeComm() const EL_NO_EXCEPT
+{ return Nodes().nodeComm; }
+mpi::Comm Grid::NodeLeaderComm() const EL_NO_EXCEPT
+{ return Nodes().leaderComm; }
+
+int Grid::NodeRank() const EL_NO_RELEASE_EXCEPT
+{ return ( InGrid() ? mpi::Rank(Nodes().nodeComm) : mpi::UNDEFINED ); }
+int Grid::NodeSize() const EL_NO_RELEASE_EXCEPT
+{ return ( InGrid() ? mpi::Size(Nodes().nodeComm) : mpi::UNDEFINED ); }
+int Grid::NumNodes() const EL_NO_RELEASE_EXCEPT
+{ return ( InGrid() ? int(Nodes().nodeSizes.size()) : mpi::UNDEFINED ); }
+
+const mpi::NodeHierarchy& Grid::Nodes() const EL_NO_EXCEPT
+{
+    if( inGrid_ && vcNodes_.nodeComm == mpi::COMM_NULL )
+        SetUpLazily( &Grid::SetUpNodes );
+    return vcNodes_;
+}
+
+void Grid::SetHierarchicalCollectives( bool hierarchical )
+{
+    EL_DEBUG_CSE
+    if( hierarchical == hierarchical_ )
+        return;
+    hierarchical_ = hierarchical;
+    if( !InGrid() )
+        return;
+    if( hierarchical )
+    {
+        // The VC hierarchy is shared with the description of the nodes
+        Nodes();
+        mpi::Create( mcComm_, mcNodes_ );
+        mpi::Create( mrComm_, mrNodes_ );
+        mpi::Create( VRComm(), vrNodes_ );
+        NameComms( mcNodes_, "MC" );
+        NameComms( mrNodes_, "MR" );
+        NameComms( vrNodes_, "VR" );
+    }
+    else
+    {
+        mpi::Free( mcNodes_ );
+        mpi::Free( mrNodes_ );
+        mpi::Free( vrNodes_ );
+    }
+}
+
+bool Grid::HierarchicalCollectives() const EL_NO_EXCEPT
+{ return hierarchical_; }
+
+void Grid::SetTransport( TransportPrecision precision ) EL_NO_EXCEPT
+{ transport_ = precision; }
+
+TransportPrecision Grid::Transport() const EL_NO_EXCEPT
+{ return transport_; }
+
+const mpi::NodeHierarchy* Grid::Hierarchy( mpi::Comm comm ) const EL_NO_EXCEPT
+{
+    if( !hierarchical_ || !inGrid_ )
+        return nullptr;
+    if( comm == mcComm_ )
+        return &mcNodes_;
+    if( comm == mrComm_ )
+        return &mrNodes_;
+    if( comm == vcComm_ )
+        return &vcNodes_;
+    if( comm == vrComm_ )
+        return &vrNodes_;
+    return nullptr;
+}
+
 mpi::Group Grid::OwningGroup() const EL_NO_EXCEPT { return owningGroup_; }
 mpi::Comm Grid::OwningComm()  const EL_NO_EXCEPT { return owningComm_; }
 mpi::Comm Grid::ViewingComm() const EL_NO_EXCEPT { return viewingComm_; }
@@ -452,9 +999,26 @@ int Grid::DiagRank( int vcRank ) const EL_NO_EXCEPT
 }
 
 #ifdef EL_HAVE_SCALAPACK
-int Grid::BlacsVCHandle() const { return blacsVCHandle_; }
-int Grid::BlacsVRHandle() const { return blacsVRHandle_; }
-int Grid::BlacsMCMRContext() const { return blacsMCMRContext_; }
+int Grid::BlacsVCHandle() const
+{
+    if( !haveBlacs_ )
+        SetUpLazily( &Grid::SetUpBlacs );
+    return blacsVCHandle_;
+}
+
+int Grid::BlacsVRHandle() const
+{
+    if( !haveBlacs_ )
+        SetUpLazily( &Grid::SetUpBlacs );
+    return blacsVRHandle_;
+}
+
+int Grid::BlacsMCMRContext() const
+{
+    if( !haveBlacs_ )
+        SetUpLazily( &Grid::SetUpBlacs );
+    return blacsMCMRContext_;
+}
 #endif
 
 // Comparison functions
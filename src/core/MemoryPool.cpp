@@ -0,0 +1,172 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <cstdlib>
+
+namespace
+{
+unsigned int defaultMemoryModes_[2] = { 0, 0 };
+
+double memoryGrowthFactor_ = 1.;
+} // namespace <anon>
+
+namespace El
+{
+
+size_t CPUMemoryPool::SizeClass( size_t numBytes ) EL_NO_EXCEPT
+{
+    if( numBytes <= Alignment )
+        return Alignment;
+
+    // Find the largest power of two strictly less than numBytes and split
+    // the interval above it into four equal classes
+    size_t power = Alignment;
+    while( 2*power < numBytes )
+        power *= 2;
+    const size_t step = power / 4;
+    return ((numBytes+step-1)/step)*step;
+}
+
+void* CPUMemoryPool::Allocate( size_t numBytes )
+{
+    if( numBytes == 0 )
+        return nullptr;
+    const size_t classBytes = SizeClass( numBytes );
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = freeLists_.find( classBytes );
+        if( it != freeLists_.end() && !it->second.empty() )
+        {
+            void* ptr = it->second.back();
+            it->second.pop_back();
+            ++stats_.hits;
+            stats_.bytesCached -= classBytes;
+            stats_.bytesInUse += classBytes;
+            return ptr;
+        }
+        ++stats_.misses;
+    }
+
+    void* ptr = nullptr;
+    if( posix_memalign( &ptr, Alignment, classBytes ) != 0 )
+    {
+        // Give the cached blocks back to the system and try once more
+        ReleaseCached();
+        if( posix_memalign( &ptr, Alignment, classBytes ) != 0 )
+            throw std::bad_alloc();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.bytesInUse += classBytes;
+    stats_.peakBytes =
+      Max( stats_.peakBytes, stats_.bytesInUse+stats_.bytesCached );
+    return ptr;
+}
+
+void CPUMemoryPool::Free( void* ptr, size_t numBytes )
+{
+    if( ptr == nullptr )
+        return;
+    const size_t classBytes = SizeClass( numBytes );
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.bytesInUse -= classBytes;
+        if( stats_.bytesCached + classBytes <= maxCachedBytes_ )
+        {
+            freeLists_[classBytes].push_back( ptr );
+            stats_.bytesCached += classBytes;
+            return;
+        }
+    }
+    std::free( ptr );
+}
+
+void CPUMemoryPool::ReleaseCached()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for( auto& entry : freeLists_ )
+        for( void* ptr : entry.second )
+            std::free( ptr );
+    freeLists_.clear();
+    stats_.bytesCached = 0;
+}
+
+void CPUMemoryPool::SetMaxCachedBytes( size_t maxCachedBytes )
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        maxCachedBytes_ = maxCachedBytes;
+        if( stats_.bytesCached <= maxCachedBytes_ )
+            return;
+    }
+    ReleaseCached();
+}
+
+size_t CPUMemoryPool::MaxCachedBytes() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return maxCachedBytes_;
+}
+
+MemoryPoolStatistics CPUMemoryPool::Statistics() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void CPUMemoryPool::ResetStatistics()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.hits = 0;
+    stats_.misses = 0;
+    stats_.peakBytes = stats_.bytesInUse + stats_.bytesCached;
+}
+
+CPUMemoryPool::~CPUMemoryPool()
+{ ReleaseCached(); }
+
+CPUMemoryPool& HostMemoryPool()
+{
+    // Constructed (thread-safely) on first use and intentionally never
+    // deleted, so that blocks released after finalization, or during static
+    // destruction, are still returned to the pool which handed them out
+    static CPUMemoryPool* hostMemoryPool = new CPUMemoryPool;
+    return *hostMemoryPool;
+}
+
+void DestroyHostMemoryPool()
+{ HostMemoryPool().SetMaxCachedBytes( 0 ); }
+
+template<Device D>
+unsigned int DefaultMemoryMode()
+{ return defaultMemoryModes_[static_cast<int>(D)]; }
+
+template<Device D>
+void SetDefaultMemoryMode( unsigned int mode )
+{ defaultMemoryModes_[static_cast<int>(D)] = mode; }
+
+double MemoryGrowthFactor()
+{ return memoryGrowthFactor_; }
+
+void SetMemoryGrowthFactor( double factor )
+{
+    if( factor < 1. )
+        LogicError("Memory growth factor must be at least one");
+    memoryGrowthFactor_ = factor;
+}
+
+template unsigned int DefaultMemoryMode<Device::CPU>();
+template void SetDefaultMemoryMode<Device::CPU>( unsigned int mode );
+#ifdef HYDROGEN_HAVE_CUDA
+template unsigned int DefaultMemoryMode<Device::GPU>();
+template void SetDefaultMemoryMode<Device::GPU>( unsigned int mode );
+#endif // HYDROGEN_HAVE_CUDA
+
+} // namespace El
@@ -0,0 +1,183 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <tuple>
+
+namespace
+{
+El::Int redistributionChunkSize_ = 1 << 20;
+
+bool DistDataLess( const El::DistData& a, const El::DistData& b )
+{
+    if( a.grid != b.grid )
+        return std::less<const El::Grid*>()( a.grid, b.grid );
+    return std::tie
+           (a.colDist,a.rowDist,a.blockHeight,a.blockWidth,
+            a.colAlign,a.rowAlign,a.colCut,a.rowCut,a.root,a.device) <
+           std::tie
+           (b.colDist,b.rowDist,b.blockHeight,b.blockWidth,
+            b.colAlign,b.rowAlign,b.colCut,b.rowCut,b.root,b.device);
+}
+} // namespace <anon>
+
+namespace El {
+
+bool operator<( const RedistributionKey& a, const RedistributionKey& b )
+{
+    if( a.height != b.height )
+        return a.height < b.height;
+    if( a.width != b.width )
+        return a.width < b.width;
+    if( DistDataLess(a.source,b.source) )
+        return true;
+    if( DistDataLess(b.source,a.source) )
+        return false;
+    return DistDataLess(a.target,b.target);
+}
+
+RedistributionPlanCache::PlanPtr
+RedistributionPlanCache::Find( const RedistributionKey& key )
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if( !enabled_ )
+        return PlanPtr();
+    auto it = plans_.find( key );
+    if( it == plans_.end() )
+    {
+        ++stats_.misses;
+        return PlanPtr();
+    }
+    ++stats_.hits;
+    it->second.lastUse = ++useCounter_;
+    return it->second.plan;
+}
+
+RedistributionPlanCache::PlanPtr
+RedistributionPlanCache::Insert
+( const RedistributionKey& key, RedistributionPlan&& plan )
+{
+    PlanPtr planPtr =
+      std::make_shared<const RedistributionPlan>( std::move(plan) );
+    std::lock_guard<std::mutex> lock(mutex_);
+    if( !enabled_ || maxPlans_ == 0 )
+        return planPtr;
+    while( plans_.size() >= maxPlans_ && plans_.count(key) == 0 )
+        EvictLeastRecent();
+    auto& cached = plans_[key];
+    cached.plan = planPtr;
+    cached.lastUse = ++useCounter_;
+    stats_.numPlans = plans_.size();
+    return planPtr;
+}
+
+void RedistributionPlanCache::EvictLeastRecent()
+{
+    auto victim = plans_.begin();
+    for( auto it=plans_.begin(); it!=plans_.end(); ++it )
+        if( it->second.lastUse < victim->second.lastUse )
+            victim = it;
+    plans_.erase( victim );
+    ++stats_.evictions;
+}
+
+void RedistributionPlanCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    plans_.clear();
+    stats_.numPlans = 0;
+}
+
+void RedistributionPlanCache::Invalidate( const Grid& grid )
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for( auto it=plans_.begin(); it!=plans_.end(); )
+    {
+        if( it->first.source.grid == &grid || it->first.target.grid == &grid )
+            it = plans_.erase( it );
+        else
+            ++it;
+    }
+    stats_.numPlans = plans_.size();
+}
+
+void RedistributionPlanCache::SetMaxPlans( size_t maxPlans )
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    maxPlans_ = maxPlans;
+    while( plans_.size() > maxPlans_ )
+        EvictLeastRecent();
+    stats_.numPlans = plans_.size();
+}
+
+size_t RedistributionPlanCache::MaxPlans() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return maxPlans_;
+}
+
+void RedistributionPlanCache::SetEnabled( bool enabled )
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    enabled_ = enabled;
+    if( !enabled_ )
+    {
+        plans_.clear();
+        stats_.numPlans = 0;
+    }
+}
+
+bool RedistributionPlanCache::Enabled() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return enabled_;
+}
+
+RedistributionPlanStatistics RedistributionPlanCache::Statistics() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void RedistributionPlanCache::ResetStatistics()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.hits = 0;
+    stats_.misses = 0;
+    stats_.evictions = 0;
+}
+
+RedistributionPlanCache& RedistributionPlans()
+{
+    // Constructed (thread-safely) on first use and intentionally never
+    // deleted, so that grids destroyed after finalization, or during static
+    // destruction, can still invalidate their plans. Every lookup and
+    // insertion is guarded by the mutex of the cache.
+    static RedistributionPlanCache* redistributionPlans =
+      new RedistributionPlanCache;
+    return *redistributionPlans;
+}
+
+void DestroyRedistributionPlans()
+{ RedistributionPlans().Clear(); }
+
+void InvalidateRedistributionPlans( const Grid& grid )
+{ RedistributionPlans().Invalidate( grid ); }
+
+Int RedistributionChunkSize()
+{ return redistributionChunkSize_; }
+
+void SetRedistributionChunkSize( Int chunkSize )
+{
+    if( chunkSize < 1 )
+        LogicError("Redistribution chunk size must be positive");
+    redistributionChunkSize_ = chunkSize;
+}
+
+} // namespace El
@@ -0,0 +1,104 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <atomic>
+#include <cstdlib>
+
+namespace
+{
+std::atomic<size_t> scratchArenaLimit_{size_t(1) << 28};
+
+size_t RoundUp( size_t numBytes )
+{
+    const size_t alignment = El::ScratchArena::Alignment;
+    return ((numBytes+alignment-1)/alignment)*alignment;
+}
+} // namespace <anon>
+
+namespace El
+{
+
+void* ScratchArena::Allocate( size_t numBytes )
+{
+    if( numBytes == 0 )
+        return nullptr;
+    const size_t roundedBytes = RoundUp( numBytes );
+
+    // Only resize the block while nothing points into it
+    if( numLive_ == 0 && Max(highWater_,roundedBytes) > capacity_ )
+        Grow( Max(highWater_,roundedBytes) );
+
+    highWater_ = Max( highWater_, top_+roundedBytes );
+    if( top_+roundedBytes > capacity_ )
+    {
+        ++numFallbacks_;
+        return nullptr;
+    }
+
+    void* ptr = buffer_ + top_;
+    top_ += roundedBytes;
+    ++numLive_;
+    return ptr;
+}
+
+void ScratchArena::Free( void* ptr, size_t numBytes )
+{
+    EL_DEBUG_ONLY(
+      if( numLive_ == 0 )
+          LogicError("Released more scratch allocations than were made");
+    )
+    const size_t roundedBytes = RoundUp( numBytes );
+    if( static_cast<byte*>(ptr)+roundedBytes == buffer_+top_ )
+        top_ -= roundedBytes;
+    // Out-of-order releases are reclaimed once the arena drains
+    if( --numLive_ == 0 )
+        top_ = 0;
+}
+
+void ScratchArena::Reserve( size_t numBytes )
+{
+    highWater_ = Max( highWater_, RoundUp(numBytes) );
+    if( numLive_ == 0 && highWater_ > capacity_ )
+        Grow( highWater_ );
+}
+
+void ScratchArena::Grow( size_t numBytes )
+{
+    const size_t newCapacity = Min( RoundUp(numBytes), ScratchArenaLimit() );
+    if( newCapacity <= capacity_ )
+        return;
+
+    void* ptr = nullptr;
+    if( posix_memalign( &ptr, Alignment, newCapacity ) != 0 )
+        return;
+    std::free( buffer_ );
+    buffer_ = static_cast<byte*>(ptr);
+    capacity_ = newCapacity;
+}
+
+ScratchArena::~ScratchArena()
+{ std::free( buffer_ ); }
+
+ScratchArena& ThreadScratchArena()
+{
+    static thread_local ScratchArena arena;
+    return arena;
+}
+
+void ReserveScratchArena( size_t numBytes )
+{ ThreadScratchArena().Reserve( numBytes ); }
+
+size_t ScratchArenaLimit()
+{ return scratchArenaLimit_.load(); }
+
+void SetScratchArenaLimit( size_t numBytes )
+{ scratchArenaLimit_.store( numBytes ); }
+
+} // namespace El
@@ -8,6 +8,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
 
 #include <algorithm>
 #include <set>
@@ -162,7 +163,11 @@ void Initialize( int& argc, char**& argv )
                  << endl;
         }
 #else
-        mpi::Initialize( argc, argv );
+        // A progress thread needs to call into MPI concurrently
+        if( std::getenv("EL_PROGRESS_THREAD") )
+            mpi::InitializeThread( argc, argv, mpi::THREAD_MULTIPLE );
+        else
+            mpi::Initialize( argc, argv );
 #endif
         ::elemInitializedMpi = true;
     }
@@ -199,6 +204,23 @@ void Initialize( int& argc, char**& argv )
     // Create the types and ops.
     // mpfr::SetPrecision within InitializeRandom created the BigFloat types
     mpi::CreateCustom();
+
+    // Profile the communication if requested through the environment
+    if( const char* basename = std::getenv("EL_COMM_PROFILE") )
+        mpi::EnableProfiling( basename );
+    if( const char* interval = std::getenv("EL_PROGRESS_THREAD") )
+    {
+        if( !mpi::StartProgressThread( std::atof(interval) ) &&
+            mpi::Rank() == 0 )
+            cerr << "Warning: EL_PROGRESS_THREAD requires "
+                    "MPI_THREAD_MULTIPLE support" << endl;
+    }
+
+    // Gemm autotuning and the persistent tunings
+    if( std::getenv("EL_GEMM_AUTOTUNE") )
+        EnableGemmAutotuning();
+    if( const char* filename = std::getenv("EL_GEMM_TUNING_FILE") )
+        LoadGemmTuning( filename );
 }
 
 void Finalize()
@@ -218,6 +240,18 @@ void Finalize()
         delete ::args;
         ::args = 0;
 
+        if( !mpi::ProfileBasename().empty() && !mpi::Finalized() )
+            mpi::WriteProfile( mpi::ProfileBasename() );
+        mpi::DisableProfiling();
+        mpi::StopProgressThread();
+
+        const char* tuningFile = std::getenv("EL_GEMM_TUNING_FILE");
+        if( tuningFile && GemmAutotuningEnabled() && !mpi::Finalized() )
+            SaveGemmTuning( tuningFile );
+        ClearGemmTuning();
+        EnableGemmAutotuning( false );
+
+        Grid::ClearCache();
         Grid::FinalizeDefault();
         Grid::FinalizeTrivial();
 
@@ -238,6 +272,9 @@ void Finalize()
 #endif
 
         FinalizeRandom();
+
+        DestroyHostMemoryPool();
+        DestroyRedistributionPlans();
     }
 
 #ifdef HYDROGEN_HAVE_CUDA
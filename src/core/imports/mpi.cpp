@@ -14,6 +14,10 @@
 */
 #include <El-lite.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 typedef unsigned char* UCP;
 
 #ifdef HYDROGEN_HAVE_CUDA
@@ -30,6 +34,8 @@ typedef unsigned char* UCP;
 #define EL_CHECK_MPI(mpi_call) CheckMpi( mpi_call )
 #endif // #ifdef HYDROGEN_HAVE_CUDA
 
+#include "./mpi_profile.hpp"
+
 namespace {
 
 inline void
@@ -74,6 +80,125 @@ bool CommSameSizeAsInteger() EL_NO_EXCEPT
 bool GroupSameSizeAsInteger() EL_NO_EXCEPT
 { return sizeof(MPI_Group) == sizeof(int); }
 
+// Large messages
+// ==============
+namespace {
+
+Int maxMessageCount = std::numeric_limits<int>::max();
+
+// Describes count contiguous entries of the given type using an int count,
+// which is only possible for more than maxMessageCount entries by shipping a
+// single entry of a derived datatype: numChunks chunks of maxMessageCount
+// entries followed by the remainder. The extent of the derived datatype is
+// that of the count entries, so that it may be used as the block of a gather
+// or all-to-all.
+class LargeMessage
+{
+public:
+    LargeMessage( size_t count, MPI_Datatype type ) EL_NO_RELEASE_EXCEPT
+    : count_(count), type_(type)
+    {
+        const size_t maxCount = maxMessageCount;
+        if( count <= maxCount )
+            return;
+        MPI_Aint lowerBound, extent;
+        EL_CHECK_MPI( MPI_Type_get_extent( type, &lowerBound, &extent ) );
+        const size_t numChunks = count / maxCount;
+        const size_t remainder = count - numChunks*maxCount;
+
+        MPI_Datatype chunk, chunks, combined;
+        EL_CHECK_MPI( MPI_Type_contiguous( int(maxCount), type, &chunk ) );
+        EL_CHECK_MPI( MPI_Type_contiguous( int(numChunks), chunk, &chunks ) );
+        if( remainder == 0 )
+        {
+            combined = chunks;
+        }
+        else
+        {
+            MPI_Datatype rest;
+            EL_CHECK_MPI( MPI_Type_contiguous( int(remainder), type, &rest ) );
+            int blockLengths[2] = { 1, 1 };
+            MPI_Aint displs[2] = { 0, MPI_Aint(numChunks*maxCount)*extent };
+            MPI_Datatype types[2] = { chunks, rest };
+            EL_CHECK_MPI
+            ( MPI_Type_create_struct
+              ( 2, blockLengths, displs, types, &combined ) );
+            EL_CHECK_MPI( MPI_Type_free( &rest ) );
+            EL_CHECK_MPI( MPI_Type_free( &chunks ) );
+        }
+        EL_CHECK_MPI( MPI_Type_free( &chunk ) );
+        // Do not let alignment padding of the struct change the extent
+        EL_CHECK_MPI
+        ( MPI_Type_create_resized
+          ( combined, lowerBound, MPI_Aint(count)*extent, &type_ ) );
+        EL_CHECK_MPI( MPI_Type_free( &combined ) );
+        EL_CHECK_MPI( MPI_Type_commit( &type_ ) );
+        count_ = 1;
+        derived_ = true;
+    }
+
+    ~LargeMessage()
+    {
+        if( derived_ )
+            MPI_Type_free( &type_ );
+    }
+
+    int Count() const EL_NO_EXCEPT { return int(count_); }
+    MPI_Datatype Type() const EL_NO_EXCEPT { return type_; }
+
+private:
+    size_t count_;
+    MPI_Datatype type_;
+    bool derived_=false;
+};
+
+// Reductions over derived datatypes cannot use the predefined operations, so
+// large reductions are instead performed in pieces of at most
+// maxMessageCount entries
+template<typename Function>
+void ReduceInPieces( size_t count, Function reducePiece )
+{
+    const size_t maxCount = maxMessageCount;
+    for( size_t offset=0; offset<count; offset+=maxCount )
+        reducePiece( offset, int(Min(maxCount,count-offset)) );
+}
+
+// Likewise for a reduce-scatter of blocks of rc entries of entrySize bytes:
+// each piece gathers the same range of every block into a contiguous buffer
+template<typename Function>
+void ReduceScatterInPieces
+( const byte* sbuf, byte* rbuf, size_t rc, size_t entrySize, int commSize,
+  Function reducePiece )
+{
+    const size_t maxCount = maxMessageCount;
+    vector<byte> pieceSend;
+    for( size_t offset=0; offset<rc; offset+=maxCount )
+    {
+        const size_t pieceSize = Min(maxCount,rc-offset);
+        const size_t pieceBytes = pieceSize*entrySize;
+        pieceSend.resize( commSize*pieceBytes );
+        for( int q=0; q<commSize; ++q )
+            MemCopy
+            ( &pieceSend[q*pieceBytes], &sbuf[(q*rc+offset)*entrySize],
+              pieceBytes );
+        reducePiece
+        ( pieceSend.data(), &rbuf[offset*entrySize], int(pieceSize) );
+    }
+}
+
+} // anonymous namespace
+
+void SetMaxMessageCount( Int maxCount )
+{
+    EL_DEBUG_CSE
+    if( maxCount < 1 )
+        LogicError("The maximum message count must be positive");
+    maxMessageCount = Min( maxCount, Int(std::numeric_limits<int>::max()) );
+}
+
+Int GetMaxMessageCount() EL_NO_EXCEPT
+{ return maxMessageCount; }
+
 // MPI environmental routines
 // ==========================
 
@@ -178,6 +303,21 @@ EL_NO_RELEASE_EXCEPT
     );
 }
 
+void Create
+( Comm parentComm, Group subsetGroup, int tag, Comm& subsetComm )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI_COMM_CREATE_GROUP
+    EL_CHECK_MPI(
+        MPI_Comm_create_group
+        ( parentComm.comm, subsetGroup.group, tag, &subsetComm.comm )
+    );
+#else
+    LogicError("MPI_Comm_create_group is not supported");
+#endif
+}
+
 void Dup( Comm original, Comm& duplicate ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
@@ -190,12 +330,123 @@ void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT
     EL_CHECK_MPI( MPI_Comm_split( comm.comm, color, key, &newComm.comm ) );
 }
 
+void SplitShared( Comm comm, int key, Comm& nodeComm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI3_SHARED_MEMORY
+    EL_CHECK_MPI
+    ( MPI_Comm_split_type
+      ( comm.comm, MPI_COMM_TYPE_SHARED, key, MPI_INFO_NULL, &nodeComm.comm ) );
+#else
+    Split( comm, Rank(comm), key, nodeComm );
+#endif
+}
+
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     EL_CHECK_MPI( MPI_Comm_free( &comm.comm ) );
 }
 
+void AllocateShared
+( size_t numBytes, Comm nodeComm, Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI3_SHARED_MEMORY
+    void* baseptr;
+    EL_CHECK_MPI
+    ( MPI_Win_allocate_shared
+      ( MPI_Aint(numBytes), 1, MPI_INFO_NULL, nodeComm.comm,
+        &baseptr, &window.win ) );
+    EL_CHECK_MPI( MPI_Win_lock_all( MPI_MODE_NOCHECK, window.win ) );
+#else
+    LogicError("MPI-3 shared memory windows are not supported");
+#endif
+}
+
+void* SharedBase( Window window, int rank ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI3_SHARED_MEMORY
+    MPI_Aint size;
+    int dispUnit;
+    void* baseptr;
+    EL_CHECK_MPI
+    ( MPI_Win_shared_query( window.win, rank, &size, &dispUnit, &baseptr ) );
+    return baseptr;
+#else
+    LogicError("MPI-3 shared memory windows are not supported");
+    return nullptr;
+#endif
+}
+
+void Sync( Window window ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI3_SHARED_MEMORY
+    EL_CHECK_MPI( MPI_Win_sync( window.win ) );
+#endif
+}
+
+void Free( Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI3_SHARED_MEMORY
+    EL_CHECK_MPI( MPI_Win_unlock_all( window.win ) );
+    EL_CHECK_MPI( MPI_Win_free( &window.win ) );
+#endif
+}
+
+void Create( Comm comm, NodeHierarchy& hierarchy ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const int commRank = Rank( comm );
+    const int commSize = Size( comm );
+
+    // Order the processes within each node, and the nodes themselves, by
+    // their ranks in the original communicator
+    SplitShared( comm, commRank, hierarchy.nodeComm );
+    const bool leader = ( Rank(hierarchy.nodeComm) == 0 );
+    Split
+    ( comm, ( leader ? 0 : UNDEFINED ), commRank, hierarchy.leaderComm );
+    hierarchy.node = ( leader ? Rank(hierarchy.leaderComm) : 0 );
+    Broadcast( hierarchy.node, 0, hierarchy.nodeComm );
+
+    vector<int> nodes( commSize );
+    AllGather( &hierarchy.node, 1, nodes.data(), 1, comm );
+    const int numNodes = *std::max_element( nodes.begin(), nodes.end() ) + 1;
+    hierarchy.nodeSizes.assign( numNodes, 0 );
+    for( int q=0; q<commSize; ++q )
+        ++hierarchy.nodeSizes[nodes[q]];
+    hierarchy.nodeOffs.resize( numNodes );
+    int off = 0;
+    for( int node=0; node<numNodes; ++node )
+    {
+        hierarchy.nodeOffs[node] = off;
+        off += hierarchy.nodeSizes[node];
+    }
+    hierarchy.nodeOrder.resize( commSize );
+    vector<int> nodeOffs( hierarchy.nodeOffs );
+    hierarchy.contiguous = true;
+    for( int q=0; q<commSize; ++q )
+    {
+        const int k = nodeOffs[nodes[q]]++;
+        hierarchy.nodeOrder[k] = q;
+        hierarchy.contiguous = hierarchy.contiguous && ( k == q );
+    }
+}
+
+void Free( NodeHierarchy& hierarchy ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( hierarchy.nodeComm != COMM_NULL )
+        Free( hierarchy.nodeComm );
+    if( hierarchy.leaderComm != COMM_NULL )
+        Free( hierarchy.leaderComm );
+    hierarchy.nodeComm = COMM_NULL;
+    hierarchy.leaderComm = COMM_NULL;
+}
+
 bool Congruent( Comm comm1, Comm comm2 ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
@@ -215,6 +466,26 @@ EL_NO_RELEASE_EXCEPT
 #endif
 }
 
+void SetName( Comm comm, const string& name ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( comm == COMM_NULL )
+        return;
+    EL_CHECK_MPI
+    ( MPI_Comm_set_name( comm.comm, const_cast<char*>(name.c_str()) ) );
+}
+
+string Name( Comm comm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( comm == COMM_NULL )
+        return "null";
+    char name[MPI_MAX_OBJECT_NAME];
+    int nameLength;
+    EL_CHECK_MPI( MPI_Comm_get_name( comm.comm, name, &nameLength ) );
+    return string( name, nameLength );
+}
+
 // Cartesian communicator routines
 // ===============================
 
@@ -496,6 +767,7 @@ void Wait( Request<T>& request, Status& status ) EL_NO_RELEASE_EXCEPT
         request.receivingPacked = false;
     }
     request.buffer.clear();
+    request.sendBuffer.clear();
 }
 
 template<typename T,
@@ -536,6 +808,7 @@ EL_NO_RELEASE_EXCEPT
             requests[j].receivingPacked = false;
         }
         requests[j].buffer.clear();
+        requests[j].sendBuffer.clear();
     }
 }
 
@@ -551,6 +824,57 @@ EL_NO_RELEASE_EXCEPT
 bool IProbe( int source, Comm comm, Status& status ) EL_NO_RELEASE_EXCEPT
 { return IProbe( source, 0, comm, status ); }
 
+namespace {
+std::thread progressThread;
+std::atomic<bool> progressThreadRunning(false);
+}
+
+void Progress() EL_NO_RELEASE_EXCEPT
+{
+    // Any call which enters the MPI library advances the outstanding
+    // requests; a probe of MPI_COMM_SELF is about the cheapest such call
+    int flag;
+    EL_CHECK_MPI
+    ( MPI_Iprobe
+      ( MPI_ANY_SOURCE, MPI_ANY_TAG, MPI_COMM_SELF, &flag,
+        MPI_STATUS_IGNORE ) );
+}
+
+bool StartProgressThread( double interval )
+{
+    EL_DEBUG_CSE
+    if( progressThreadRunning )
+        return true;
+    if( QueryThread() != THREAD_MULTIPLE )
+        return false;
+    if( interval < 0 )
+        LogicError("Invalid progress thread interval of ",interval);
+    const std::chrono::duration<double> sleepTime( interval );
+    progressThreadRunning = true;
+    progressThread = std::thread
+    ( [sleepTime]()
+      {
+          while( progressThreadRunning )
+          {
+              Progress();
+              std::this_thread::sleep_for( sleepTime );
+          }
+      } );
+    return true;
+}
+
+void StopProgressThread()
+{
+    EL_DEBUG_CSE
+    if( !progressThreadRunning )
+        return;
+    progressThreadRunning = false;
+    progressThread.join();
+}
+
+bool ProgressThreadRunning() EL_NO_EXCEPT
+{ return progressThreadRunning; }
+
 template<typename T>
 int GetCount( Status& status ) EL_NO_RELEASE_EXCEPT
 {
@@ -932,68 +1256,69 @@ EL_NO_RELEASE_EXCEPT
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void TaggedSendRecv
-( const Real* sbuf, int sc, int to,   int stag,
-        Real* rbuf, int rc, int from, int rtag, Comm comm )
+( const Real* sbuf, Int sc, int to,   int stag,
+        Real* rbuf, Int rc, int from, int rtag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     Status status;
+    LargeMessage send( sc, TypeMap<Real>() ), recv( rc, TypeMap<Real>() );
     EL_CHECK_MPI
     ( MPI_Sendrecv
-      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(), to,   stag,
-        rbuf,                    rc, TypeMap<Real>(), from, rtag,
+      ( const_cast<Real*>(sbuf), send.Count(), send.Type(), to,   stag,
+        rbuf,                    recv.Count(), recv.Type(), from, rtag,
         comm.comm, &status ) );
 }
 
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void TaggedSendRecv
-( const Complex<Real>* sbuf, int sc, int to,   int stag,
-        Complex<Real>* rbuf, int rc, int from, int rtag, Comm comm )
+( const Complex<Real>* sbuf, Int sc, int to,   int stag,
+        Complex<Real>* rbuf, Int rc, int from, int rtag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
-    EL_CHECK_MPI
-    ( MPI_Sendrecv
-      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(), to,   stag,
-        rbuf,                             2*rc, TypeMap<Real>(), from, rtag,
-        comm.comm, &status ) );
+    LargeMessage send( 2*size_t(sc), TypeMap<Real>() ),
+                 recv( 2*size_t(rc), TypeMap<Real>() );
 #else
+    LargeMessage send( sc, TypeMap<Complex<Real>>() ),
+                 recv( rc, TypeMap<Complex<Real>>() );
+#endif
     EL_CHECK_MPI
     ( MPI_Sendrecv
       ( const_cast<Complex<Real>*>(sbuf),
-        sc, TypeMap<Complex<Real>>(), to,   stag,
+        send.Count(), send.Type(), to,   stag,
         rbuf,
-        rc, TypeMap<Complex<Real>>(), from, rtag, comm.comm, &status ) );
-#endif
+        recv.Count(), recv.Type(), from, rtag, comm.comm, &status ) );
 }
 
 template<typename T,
          typename/*=DisableIf<IsPacked<T>>*/,
          typename/*=void*/>
 void TaggedSendRecv
-( const T* sbuf, int sc, int to,   int stag,
-        T* rbuf, int rc, int from, int rtag, Comm comm )
+( const T* sbuf, Int sc, int to,   int stag,
+        T* rbuf, Int rc, int from, int rtag, Comm comm )
 {
     EL_DEBUG_CSE
     Status status;
     std::vector<byte> packedSend, packedRecv;
     Serialize( sc, sbuf, packedSend );
     ReserveSerialized( rc, rbuf, packedRecv );
+    LargeMessage send( sc, TypeMap<T>() ), recv( rc, TypeMap<T>() );
     EL_CHECK_MPI
     ( MPI_Sendrecv
-      ( packedSend.data(), sc, TypeMap<T>(), to,   stag,
-        packedRecv.data(), rc, TypeMap<T>(), from, rtag,
+      ( packedSend.data(), send.Count(), send.Type(), to,   stag,
+        packedRecv.data(), recv.Count(), recv.Type(), from, rtag,
         comm.comm, &status ) );
     Deserialize( rc, packedRecv, rbuf );
 }
 
 template<typename T>
 void SendRecv
-( const T* sbuf, int sc, int to,
-        T* rbuf, int rc, int from, Comm comm )
+( const T* sbuf, Int sc, int to,
+        T* rbuf, Int rc, int from, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { TaggedSendRecv( sbuf, sc, to, 0, rbuf, rc, from, ANY_TAG, comm ); }
 
@@ -1014,44 +1339,43 @@ EL_NO_RELEASE_EXCEPT
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void TaggedSendRecv
-( Real* buf, int count, int to, int stag, int from, int rtag, Comm comm )
+( Real* buf, Int count, int to, int stag, int from, int rtag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     Status status;
+    LargeMessage msg( count, TypeMap<Real>() );
     EL_CHECK_MPI
     ( MPI_Sendrecv_replace
-      ( buf, count, TypeMap<Real>(), to, stag, from, rtag, comm.comm,
+      ( buf, msg.Count(), msg.Type(), to, stag, from, rtag, comm.comm,
         &status ) );
 }
 
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void TaggedSendRecv
-( Complex<Real>* buf, int count, int to, int stag, int from, int rtag,
+( Complex<Real>* buf, Int count, int to, int stag, int from, int rtag,
   Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
-    EL_CHECK_MPI
-    ( MPI_Sendrecv_replace
-      ( buf, 2*count, TypeMap<Real>(), to, stag, from, rtag, comm.comm,
-        &status ) );
+    LargeMessage msg( 2*size_t(count), TypeMap<Real>() );
 #else
+    LargeMessage msg( count, TypeMap<Complex<Real>>() );
+#endif
     EL_CHECK_MPI
     ( MPI_Sendrecv_replace
-      ( buf, count, TypeMap<Complex<Real>>(),
+      ( buf, msg.Count(), msg.Type(),
         to, stag, from, rtag, comm.comm, &status ) );
-#endif
 }
 
 template<typename T,
          typename/*=DisableIf<IsPacked<T>>*/,
          typename/*=void*/>
 void TaggedSendRecv
-( T* buf, int count, int to, int stag, int from, int rtag, Comm comm )
+( T* buf, Int count, int to, int stag, int from, int rtag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
@@ -1059,48 +1383,53 @@ EL_NO_RELEASE_EXCEPT
     ReserveSerialized( count, buf, packedBuf );
     Serialize( count, buf, packedBuf );
     Status status;
+    LargeMessage msg( count, TypeMap<T>() );
     EL_CHECK_MPI
     ( MPI_Sendrecv_replace
-      ( packedBuf.data(), count, TypeMap<T>(), to, stag, from, rtag,
+      ( packedBuf.data(), msg.Count(), msg.Type(), to, stag, from, rtag,
         comm.comm, &status ) );
     Deserialize( count, packedBuf, buf );
 }
 
 template<typename T>
-void SendRecv( T* buf, int count, int to, int from, Comm comm )
+void SendRecv( T* buf, Int count, int to, int from, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { TaggedSendRecv( buf, count, to, 0, from, ANY_TAG, comm ); }
 
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
-void Broadcast( Real* buf, int count, int root, Comm comm )
+void Broadcast( Real* buf, Int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     if( Size(comm) == 1 || count == 0 )
         return;
-    EL_CHECK_MPI( MPI_Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
+    LargeMessage msg( count, TypeMap<Real>() );
+    EL_CHECK_MPI
+    ( MPI_Bcast( buf, msg.Count(), msg.Type(), root, comm.comm ) );
 }
 
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
-void Broadcast( Complex<Real>* buf, int count, int root, Comm comm )
+void Broadcast( Complex<Real>* buf, Int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     if( Size(comm) == 1 )
         return;
 #ifdef EL_AVOID_COMPLEX_MPI
-    EL_CHECK_MPI( MPI_Bcast( buf, 2*count, TypeMap<Real>(), root, comm.comm ) );
+    LargeMessage msg( 2*size_t(count), TypeMap<Real>() );
 #else
-    EL_CHECK_MPI( MPI_Bcast( buf, count, TypeMap<Complex<Real>>(), root, comm.comm ) );
+    LargeMessage msg( count, TypeMap<Complex<Real>>() );
 #endif
+    EL_CHECK_MPI
+    ( MPI_Bcast( buf, msg.Count(), msg.Type(), root, comm.comm ) );
 }
 
 template<typename T,
          typename/*=DisableIf<IsPacked<T>>*/,
          typename/*=void*/>
-void Broadcast( T* buf, int count, int root, Comm comm )
+void Broadcast( T* buf, Int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
@@ -1108,8 +1437,9 @@ EL_NO_RELEASE_EXCEPT
         return;
     std::vector<byte> packedBuf;
     Serialize( count, buf, packedBuf );
+    LargeMessage msg( count, TypeMap<T>() );
     EL_CHECK_MPI(
-      MPI_Bcast( packedBuf.data(), count, TypeMap<T>(), root, comm.comm )
+      MPI_Bcast( packedBuf.data(), msg.Count(), msg.Type(), root, comm.comm )
     );
     Deserialize( count, packedBuf, buf );
 }
@@ -1167,10 +1497,13 @@ void IBroadcast
     request.receivingPacked = true;
     request.recvCount = count;
     request.unpackedRecvBuf = buf;
-    ReserveSerialized( count, buf, request.buffer );
+    if( mpi::Rank(comm) == root )
+        Serialize( count, buf, request.buffer );
+    else
+        ReserveSerialized( count, buf, request.buffer );
     EL_CHECK_MPI
     ( MPI_Ibcast
-      ( request.buffer.data(), count, TypeMap<Real>(), root, comm.comm,
+      ( request.buffer.data(), count, TypeMap<T>(), root, comm.comm,
         &request.backend ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
@@ -1184,36 +1517,42 @@ void IBroadcast( T& b, int root, Comm comm, Request<T>& request )
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void Gather
-( const Real* sbuf, int sc,
-        Real* rbuf, int rc, int root, Comm comm )
+( const Real* sbuf, Int sc,
+        Real* rbuf, Int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    LargeMessage send( sc, TypeMap<Real>() ),
+                 recv( rc, TypeMap<Real>() );
     EL_CHECK_MPI
     ( MPI_Gather
-      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
-        rbuf,                    rc, TypeMap<Real>(), root, comm.comm ) );
+      ( const_cast<Real*>(sbuf), send.Count(), send.Type(),
+        rbuf,                    recv.Count(), recv.Type(), root, comm.comm ) );
 }
 
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void Gather
-( const Complex<Real>* sbuf, int sc,
-        Complex<Real>* rbuf, int rc, int root, Comm comm )
+( const Complex<Real>* sbuf, Int sc,
+        Complex<Real>* rbuf, Int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
+    LargeMessage send( 2*size_t(sc), TypeMap<Real>() ),
+                 recv( 2*size_t(rc), TypeMap<Real>() );
     EL_CHECK_MPI
     ( MPI_Gather
-      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
-        rbuf,                             2*rc, TypeMap<Real>(),
+      ( const_cast<Complex<Real>*>(sbuf), send.Count(), send.Type(),
+        rbuf,                             recv.Count(), recv.Type(),
         root, comm.comm ) );
 #else
+    LargeMessage send( sc, TypeMap<Complex<Real>>() ),
+                 recv( rc, TypeMap<Complex<Real>>() );
     EL_CHECK_MPI
     ( MPI_Gather
-      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
-        rbuf,                             rc, TypeMap<Complex<Real>>(),
+      ( const_cast<Complex<Real>*>(sbuf), send.Count(), send.Type(),
+        rbuf,                             recv.Count(), recv.Type(),
         root, comm.comm ) );
 #endif
 }
@@ -1222,24 +1561,26 @@ template<typename T,
          typename/*=DisableIf<IsPacked<T>>*/,
          typename/*=void*/>
 void Gather
-( const T* sbuf, int sc,
-        T* rbuf, int rc, int root, Comm comm )
+( const T* sbuf, Int sc,
+        T* rbuf, Int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
-    const int totalRecv = rc*commSize;
+    const Int totalRecv = rc*commSize;
 
     std::vector<byte> packedSend, packedRecv;
     Serialize( sc, sbuf, packedSend );
 
     if( commRank == root )
         ReserveSerialized( totalRecv, rbuf, packedRecv );
+    LargeMessage send( sc, TypeMap<T>() ),
+                 recv( rc, TypeMap<T>() );
     EL_CHECK_MPI
     ( MPI_Gather
-      ( packedSend.data(), sc, TypeMap<T>(),
-        packedRecv.data(), rc, TypeMap<T>(), root, comm.comm ) );
+      ( packedSend.data(), send.Count(), send.Type(),
+        packedRecv.data(), recv.Count(), recv.Type(), root, comm.comm ) );
     if( commRank == root )
         Deserialize( totalRecv, packedRecv, rbuf );
 }
@@ -1303,6 +1644,7 @@ void IGather
 {
     EL_DEBUG_CSE
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    Serialize( sc, sbuf, request.sendBuffer );
     if( mpi::Rank(comm) == root )
     {
         const int commSize = mpi::Size(comm);
@@ -1313,8 +1655,8 @@ void IGather
     }
     EL_CHECK_MPI
     ( MPI_Igather
-      ( request.buffer.data(), sc, TypeMap<Real>(),
-        rbuf,                  rc, TypeMap<Real>(), root, comm.comm,
+      ( request.sendBuffer.data(), sc, TypeMap<T>(),
+        request.buffer.data(),     rc, TypeMap<T>(), root, comm.comm,
         &request.backend ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
@@ -1425,55 +1767,65 @@ EL_NO_RELEASE_EXCEPT
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void AllGather
-( const Real* sbuf, int sc,
-        Real* rbuf, int rc, Comm comm )
+( const Real* sbuf, Int sc,
+        Real* rbuf, Int rc, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
 #ifdef EL_USE_BYTE_ALLGATHERS
+    LargeMessage send( sizeof(Real)*size_t(sc), MPI_UNSIGNED_CHAR ),
+                 recv( sizeof(Real)*size_t(rc), MPI_UNSIGNED_CHAR );
     EL_CHECK_MPI
     ( MPI_Allgather
       ( reinterpret_cast<UCP>(const_cast<Real*>(sbuf)),
-        sizeof(Real)*sc, MPI_UNSIGNED_CHAR,
+        send.Count(), send.Type(),
         reinterpret_cast<UCP>(rbuf),
-        sizeof(Real)*rc, MPI_UNSIGNED_CHAR,
+        recv.Count(), recv.Type(),
         comm.comm ) );
 #else
+    LargeMessage send( sc, TypeMap<Real>() ),
+                 recv( rc, TypeMap<Real>() );
     EL_CHECK_MPI
     ( MPI_Allgather
-      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
-        rbuf,                    rc, TypeMap<Real>(), comm.comm ) );
+      ( const_cast<Real*>(sbuf), send.Count(), send.Type(),
+        rbuf,                    recv.Count(), recv.Type(), comm.comm ) );
 #endif
 }
 
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void AllGather
-( const Complex<Real>* sbuf, int sc,
-        Complex<Real>* rbuf, int rc, Comm comm )
+( const Complex<Real>* sbuf, Int sc,
+        Complex<Real>* rbuf, Int rc, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
 #ifdef EL_USE_BYTE_ALLGATHERS
+    LargeMessage send( 2*sizeof(Real)*size_t(sc), MPI_UNSIGNED_CHAR ),
+                 recv( 2*sizeof(Real)*size_t(rc), MPI_UNSIGNED_CHAR );
     EL_CHECK_MPI
     ( MPI_Allgather
       ( reinterpret_cast<UCP>(const_cast<Complex<Real>*>(sbuf)),
-        2*sizeof(Real)*sc, MPI_UNSIGNED_CHAR,
+        send.Count(), send.Type(),
         reinterpret_cast<UCP>(rbuf),
-        2*sizeof(Real)*rc, MPI_UNSIGNED_CHAR,
+        recv.Count(), recv.Type(),
         comm.comm ) );
 #else
  #ifdef EL_AVOID_COMPLEX_MPI
+    LargeMessage send( 2*size_t(sc), TypeMap<Real>() ),
+                 recv( 2*size_t(rc), TypeMap<Real>() );
     EL_CHECK_MPI
     ( MPI_Allgather
-      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
-        rbuf,                             2*rc, TypeMap<Real>(),
+      ( const_cast<Complex<Real>*>(sbuf), send.Count(), send.Type(),
+        rbuf,                             recv.Count(), recv.Type(),
         comm.comm ) );
  #else
+    LargeMessage send( sc, TypeMap<Complex<Real>>() ),
+                 recv( rc, TypeMap<Complex<Real>>() );
     EL_CHECK_MPI
     ( MPI_Allgather
-      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
-        rbuf,                             rc, TypeMap<Complex<Real>>(),
+      ( const_cast<Complex<Real>*>(sbuf), send.Count(), send.Type(),
+        rbuf,                             recv.Count(), recv.Type(),
         comm.comm ) );
  #endif
 #endif
@@ -1483,25 +1835,125 @@ template<typename T,
          typename/*=DisableIf<IsPacked<T>>*/,
          typename/*=void*/>
 void AllGather
-( const T* sbuf, int sc,
-        T* rbuf, int rc, Comm comm )
+( const T* sbuf, Int sc,
+        T* rbuf, Int rc, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     const int commSize = mpi::Size(comm);
-    const int totalRecv = rc*commSize;
+    const Int totalRecv = rc*commSize;
 
     std::vector<byte> packedSend, packedRecv;
     Serialize( sc, sbuf, packedSend );
 
     ReserveSerialized( totalRecv, rbuf, packedRecv );
+    LargeMessage send( sc, TypeMap<T>() ),
+                 recv( rc, TypeMap<T>() );
     EL_CHECK_MPI
     ( MPI_Allgather
-      ( packedSend.data(), sc, TypeMap<T>(),
-        packedRecv.data(), rc, TypeMap<T>(), comm.comm ) );
+      ( packedSend.data(), send.Count(), send.Type(),
+        packedRecv.data(), recv.Count(), recv.Type(), comm.comm ) );
     Deserialize( totalRecv, packedRecv, rbuf );
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Real* sbuf, Int sc,
+        Real* rbuf, Int rc, Comm comm,
+  Request<Real>& request )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    // A derived datatype may be freed as soon as the operation is started
+ #ifdef EL_USE_BYTE_ALLGATHERS
+    LargeMessage send( sizeof(Real)*size_t(sc), MPI_UNSIGNED_CHAR ),
+                 recv( sizeof(Real)*size_t(rc), MPI_UNSIGNED_CHAR );
+    EL_CHECK_MPI
+    ( MPI_Iallgather
+      ( reinterpret_cast<UCP>(const_cast<Real*>(sbuf)),
+        send.Count(), send.Type(),
+        reinterpret_cast<UCP>(rbuf),
+        recv.Count(), recv.Type(),
+        comm.comm, &request.backend ) );
+ #else
+    LargeMessage send( sc, TypeMap<Real>() ), recv( rc, TypeMap<Real>() );
+    EL_CHECK_MPI
+    ( MPI_Iallgather
+      ( const_cast<Real*>(sbuf), send.Count(), send.Type(),
+        rbuf,                    recv.Count(), recv.Type(),
+        comm.comm, &request.backend ) );
+ #endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Complex<Real>* sbuf, Int sc,
+        Complex<Real>* rbuf, Int rc, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+ #ifdef EL_USE_BYTE_ALLGATHERS
+    LargeMessage send( 2*sizeof(Real)*size_t(sc), MPI_UNSIGNED_CHAR ),
+                 recv( 2*sizeof(Real)*size_t(rc), MPI_UNSIGNED_CHAR );
+    EL_CHECK_MPI
+    ( MPI_Iallgather
+      ( reinterpret_cast<UCP>(const_cast<Complex<Real>*>(sbuf)),
+        send.Count(), send.Type(),
+        reinterpret_cast<UCP>(rbuf),
+        recv.Count(), recv.Type(),
+        comm.comm, &request.backend ) );
+ #else
+  #ifdef EL_AVOID_COMPLEX_MPI
+    LargeMessage send( 2*size_t(sc), TypeMap<Real>() ),
+                 recv( 2*size_t(rc), TypeMap<Real>() );
+  #else
+    LargeMessage send( sc, TypeMap<Complex<Real>>() ),
+                 recv( rc, TypeMap<Complex<Real>>() );
+  #endif
+    EL_CHECK_MPI
+    ( MPI_Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), send.Count(), send.Type(),
+        rbuf,                             recv.Count(), recv.Type(),
+        comm.comm, &request.backend ) );
+ #endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllGather
+( const T* sbuf, Int sc,
+        T* rbuf, Int rc, Comm comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    const Int totalRecv = rc*mpi::Size(comm);
+    Serialize( sc, sbuf, request.sendBuffer );
+    request.receivingPacked = true;
+    request.recvCount = totalRecv;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( totalRecv, rbuf, request.buffer );
+    LargeMessage send( sc, TypeMap<T>() ), recv( rc, TypeMap<T>() );
+    EL_CHECK_MPI
+    ( MPI_Iallgather
+      ( request.sendBuffer.data(), send.Count(), send.Type(),
+        request.buffer.data(),     recv.Count(), recv.Type(),
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void AllGather
@@ -1622,36 +2074,42 @@ EL_NO_RELEASE_EXCEPT
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void Scatter
-( const Real* sbuf, int sc,
-        Real* rbuf, int rc, int root, Comm comm )
+( const Real* sbuf, Int sc,
+        Real* rbuf, Int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    LargeMessage send( sc, TypeMap<Real>() ),
+                 recv( rc, TypeMap<Real>() );
     EL_CHECK_MPI
     ( MPI_Scatter
-      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
-        rbuf,                    rc, TypeMap<Real>(), root, comm.comm ) );
+      ( const_cast<Real*>(sbuf), send.Count(), send.Type(),
+        rbuf,                    recv.Count(), recv.Type(), root, comm.comm ) );
 }
 
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void Scatter
-( const Complex<Real>* sbuf, int sc,
-        Complex<Real>* rbuf, int rc, int root, Comm comm )
+( const Complex<Real>* sbuf, Int sc,
+        Complex<Real>* rbuf, Int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
+    LargeMessage send( 2*size_t(sc), TypeMap<Real>() ),
+                 recv( 2*size_t(rc), TypeMap<Real>() );
     EL_CHECK_MPI
     ( MPI_Scatter
-      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
-        rbuf,                             2*rc, TypeMap<Real>(), root,
+      ( const_cast<Complex<Real>*>(sbuf), send.Count(), send.Type(),
+        rbuf,                             recv.Count(), recv.Type(), root,
         comm.comm ) );
 #else
+    LargeMessage send( sc, TypeMap<Complex<Real>>() ),
+                 recv( rc, TypeMap<Complex<Real>>() );
     EL_CHECK_MPI
     ( MPI_Scatter
-      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
-        rbuf,                             rc, TypeMap<Complex<Real>>(),
+      ( const_cast<Complex<Real>*>(sbuf), send.Count(), send.Type(),
+        rbuf,                             recv.Count(), recv.Type(),
         root, comm.comm ) );
 #endif
 }
@@ -1660,53 +2118,59 @@ template<typename T,
          typename/*=DisableIf<IsPacked<T>>*/,
          typename/*=void*/>
 void Scatter
-( const T* sbuf, int sc,
-        T* rbuf, int rc, int root, Comm comm )
+( const T* sbuf, Int sc,
+        T* rbuf, Int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
-    const int totalSend = sc*commSize;
+    const Int totalSend = sc*commSize;
 
     std::vector<byte> packedSend, packedRecv;
     if( commRank == root )
         Serialize( totalSend, sbuf, packedSend );
 
     ReserveSerialized( rc, rbuf, packedRecv );
+    LargeMessage send( sc, TypeMap<T>() ),
+                 recv( rc, TypeMap<T>() );
     EL_CHECK_MPI
     ( MPI_Scatter
-      ( packedSend.data(), sc, TypeMap<T>(),
-        packedRecv.data(), rc, TypeMap<T>(), root, comm.comm ) );
+      ( packedSend.data(), send.Count(), send.Type(),
+        packedRecv.data(), recv.Count(), recv.Type(), root, comm.comm ) );
     Deserialize( rc, packedRecv, rbuf );
 }
 
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
-void Scatter( Real* buf, int sc, int rc, int root, Comm comm )
+void Scatter( Real* buf, Int sc, Int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     const int commRank = Rank( comm );
     if( commRank == root )
     {
+        LargeMessage send( sc, TypeMap<Real>() ),
+                     recv( rc, TypeMap<Real>() );
         EL_CHECK_MPI
         ( MPI_Scatter
-          ( buf,          sc, TypeMap<Real>(),
-            MPI_IN_PLACE, rc, TypeMap<Real>(), root, comm.comm ) );
+          ( buf,          send.Count(), send.Type(),
+            MPI_IN_PLACE, recv.Count(), recv.Type(), root, comm.comm ) );
     }
     else
     {
+        LargeMessage send( sc, TypeMap<Real>() ),
+                     recv( rc, TypeMap<Real>() );
         EL_CHECK_MPI
         ( MPI_Scatter
-          ( 0,   sc, TypeMap<Real>(),
-            buf, rc, TypeMap<Real>(), root, comm.comm ) );
+          ( 0,   send.Count(), send.Type(),
+            buf, recv.Count(), recv.Type(), root, comm.comm ) );
     }
 }
 
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
-void Scatter( Complex<Real>* buf, int sc, int rc, int root, Comm comm )
+void Scatter( Complex<Real>* buf, Int sc, Int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
@@ -1714,29 +2178,37 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
+        LargeMessage send( 2*size_t(sc), TypeMap<Real>() ),
+                     recv( 2*size_t(rc), TypeMap<Real>() );
         EL_CHECK_MPI
         ( MPI_Scatter
-          ( buf,          2*sc, TypeMap<Real>(),
-            MPI_IN_PLACE, 2*rc, TypeMap<Real>(), root, comm.comm ) );
+          ( buf,          send.Count(), send.Type(),
+            MPI_IN_PLACE, recv.Count(), recv.Type(), root, comm.comm ) );
 #else
+        LargeMessage send( sc, TypeMap<Complex<Real>>() ),
+                     recv( rc, TypeMap<Complex<Real>>() );
         EL_CHECK_MPI
         ( MPI_Scatter
-          ( buf,          sc, TypeMap<Complex<Real>>(),
-            MPI_IN_PLACE, rc, TypeMap<Complex<Real>>(), root, comm.comm ) );
+          ( buf,          send.Count(), send.Type(),
+            MPI_IN_PLACE, recv.Count(), recv.Type(), root, comm.comm ) );
 #endif
     }
     else
     {
 #ifdef EL_AVOID_COMPLEX_MPI
+        LargeMessage send( 2*size_t(sc), TypeMap<Real>() ),
+                     recv( 2*size_t(rc), TypeMap<Real>() );
         EL_CHECK_MPI
         ( MPI_Scatter
-          ( 0,   2*sc, TypeMap<Real>(),
-            buf, 2*rc, TypeMap<Real>(), root, comm.comm ) );
+          ( 0,   send.Count(), send.Type(),
+            buf, recv.Count(), recv.Type(), root, comm.comm ) );
 #else
+        LargeMessage send( sc, TypeMap<Complex<Real>>() ),
+                     recv( rc, TypeMap<Complex<Real>>() );
         EL_CHECK_MPI
         ( MPI_Scatter
-          ( 0,   sc, TypeMap<Complex<Real>>(),
-            buf, rc, TypeMap<Complex<Real>>(), root, comm.comm ) );
+          ( 0,   send.Count(), send.Type(),
+            buf, recv.Count(), recv.Type(), root, comm.comm ) );
 #endif
     }
 }
@@ -1744,13 +2216,13 @@ EL_NO_RELEASE_EXCEPT
 template<typename T,
          typename/*=DisableIf<IsPacked<T>>*/,
          typename/*=void*/>
-void Scatter( T* buf, int sc, int rc, int root, Comm comm )
+void Scatter( T* buf, Int sc, Int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
-    const int totalSend = sc*commSize;
+    const Int totalSend = sc*commSize;
 
     // TODO(poulson): Use in-place option?
 
@@ -1759,49 +2231,57 @@ EL_NO_RELEASE_EXCEPT
         Serialize( totalSend, buf, packedSend );
 
     ReserveSerialized( rc, buf, packedRecv );
+    LargeMessage send( sc, TypeMap<T>() ),
+                 recv( rc, TypeMap<T>() );
     EL_CHECK_MPI
     ( MPI_Scatter
-      ( packedSend.data(), sc, TypeMap<T>(),
-        packedRecv.data(), rc, TypeMap<T>(), root, comm.comm ) );
+      ( packedSend.data(), send.Count(), send.Type(),
+        packedRecv.data(), recv.Count(), recv.Type(), root, comm.comm ) );
     Deserialize( rc, packedRecv, buf );
 }
 
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void AllToAll
-( const Real* sbuf, int sc,
-        Real* rbuf, int rc, Comm comm )
+( const Real* sbuf, Int sc,
+        Real* rbuf, Int rc, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    LargeMessage send( sc, TypeMap<Real>() ),
+                 recv( rc, TypeMap<Real>() );
     EL_CHECK_MPI
     ( MPI_Alltoall
-      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
-        rbuf,                    rc, TypeMap<Real>(), comm.comm ) );
+      ( const_cast<Real*>(sbuf), send.Count(), send.Type(),
+        rbuf,                    recv.Count(), recv.Type(), comm.comm ) );
 }
 
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void AllToAll
-( const Complex<Real>* sbuf, int sc,
-        Complex<Real>* rbuf, int rc, Comm comm )
+( const Complex<Real>* sbuf, Int sc,
+        Complex<Real>* rbuf, Int rc, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
 #ifdef EL_AVOID_COMPLEX_MPI
+    LargeMessage send( 2*size_t(sc), TypeMap<Real>() ),
+                 recv( 2*size_t(rc), TypeMap<Real>() );
     EL_CHECK_MPI
     ( MPI_Alltoall
       ( const_cast<Complex<Real>*>(sbuf),
-        2*sc, TypeMap<Real>(),
+        send.Count(), send.Type(),
         rbuf,
-        2*rc, TypeMap<Real>(), comm.comm ) );
+        recv.Count(), recv.Type(), comm.comm ) );
 #else
+    LargeMessage send( sc, TypeMap<Complex<Real>>() ),
+                 recv( rc, TypeMap<Complex<Real>>() );
     EL_CHECK_MPI
     ( MPI_Alltoall
       ( const_cast<Complex<Real>*>(sbuf),
-        sc, TypeMap<Complex<Real>>(),
+        send.Count(), send.Type(),
         rbuf,
-        rc, TypeMap<Complex<Real>>(), comm.comm ) );
+        recv.Count(), recv.Type(), comm.comm ) );
 #endif
 }
 
@@ -1809,25 +2289,100 @@ template<typename T,
          typename/*=DisableIf<IsPacked<T>>*/,
          typename/*=void*/>
 void AllToAll
-( const T* sbuf, int sc,
-        T* rbuf, int rc, Comm comm )
+( const T* sbuf, Int sc,
+        T* rbuf, Int rc, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     const int commSize = mpi::Size( comm );
-    const int totalSend = sc*commSize;
-    const int totalRecv = rc*commSize;
+    const Int totalSend = sc*commSize;
+    const Int totalRecv = rc*commSize;
 
     std::vector<byte> packedSend, packedRecv;
     Serialize( totalSend, sbuf, packedSend );
     ReserveSerialized( totalRecv, rbuf, packedRecv );
+    LargeMessage send( sc, TypeMap<T>() ),
+                 recv( rc, TypeMap<T>() );
     EL_CHECK_MPI
     ( MPI_Alltoall
-      ( packedSend.data(), sc, TypeMap<T>(),
-        packedRecv.data(), rc, TypeMap<T>(), comm.comm ) );
+      ( packedSend.data(), send.Count(), send.Type(),
+        packedRecv.data(), recv.Count(), recv.Type(), comm.comm ) );
     Deserialize( totalRecv, packedRecv, rbuf );
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllToAll
+( const Real* sbuf, Int sc,
+        Real* rbuf, Int rc, Comm comm,
+  Request<Real>& request )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    LargeMessage send( sc, TypeMap<Real>() ), recv( rc, TypeMap<Real>() );
+    EL_CHECK_MPI
+    ( MPI_Ialltoall
+      ( const_cast<Real*>(sbuf), send.Count(), send.Type(),
+        rbuf,                    recv.Count(), recv.Type(),
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllToAll
+( const Complex<Real>* sbuf, Int sc,
+        Complex<Real>* rbuf, Int rc, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+ #ifdef EL_AVOID_COMPLEX_MPI
+    LargeMessage send( 2*size_t(sc), TypeMap<Real>() ),
+                 recv( 2*size_t(rc), TypeMap<Real>() );
+ #else
+    LargeMessage send( sc, TypeMap<Complex<Real>>() ),
+                 recv( rc, TypeMap<Complex<Real>>() );
+ #endif
+    EL_CHECK_MPI
+    ( MPI_Ialltoall
+      ( const_cast<Complex<Real>*>(sbuf), send.Count(), send.Type(),
+        rbuf,                             recv.Count(), recv.Type(),
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllToAll
+( const T* sbuf, Int sc,
+        T* rbuf, Int rc, Comm comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    const Int commSize = mpi::Size( comm );
+    Serialize( sc*commSize, sbuf, request.sendBuffer );
+    request.receivingPacked = true;
+    request.recvCount = rc*commSize;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( rc*commSize, rbuf, request.buffer );
+    LargeMessage send( sc, TypeMap<T>() ), recv( rc, TypeMap<T>() );
+    EL_CHECK_MPI
+    ( MPI_Ialltoall
+      ( request.sendBuffer.data(), send.Count(), send.Type(),
+        request.buffer.data(),     recv.Count(), recv.Type(),
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void AllToAll
@@ -1915,7 +2470,231 @@ EL_NO_RELEASE_EXCEPT
     Deserialize( totalRecv, packedRecv, rbuf );
 }
 
-template<typename T>
+// Variable all-to-all algorithms
+// ==============================
+// Unlike MPI_Alltoallv, only the pairs of processes which exchange data send
+// messages, so the pairwise and sparse algorithms send exactly the same
+// messages and can be freely mixed across processes. Bruck's algorithm
+// forwards data through intermediate processes and therefore requires every
+// process to choose it.
+
+namespace {
+
+#ifdef EL_USE_CUSTOM_ALLTOALLV
+AllToAllAlgorithm allToAllAlgorithm = ALLTOALL_DEFAULT;
+#else
+AllToAllAlgorithm allToAllAlgorithm = ALLTOALL_NATIVE;
+#endif
+
+// Exchanges with at most one in sparsityRatio of the processes as partners
+// post all of their messages at once
+const int sparsityRatio = 4;
+// Dense exchanges with at least this many bytes per partner proceed in
+// rounds of pairwise exchanges to limit the number of messages in flight
+const double pairwiseBytes = 8192;
+// Dense exchanges with at most this many bytes per partner on communicators
+// of at least bruckMinSize processes aggregate them with Bruck's algorithm
+const double bruckBytes = 256;
+const int bruckMinSize = 8;
+
+AllToAllAlgorithm ChooseAllToAll
+( const int* scs, const int* rcs, size_t typeSize,
+  int commSize, int commRank )
+{
+    int numPartners = 0;
+    double numBytes = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank || (scs[q] == 0 && rcs[q] == 0) )
+            continue;
+        ++numPartners;
+        numBytes += double(scs[q]+rcs[q])*typeSize;
+    }
+    if( numPartners*sparsityRatio <= commSize ||
+        numBytes < pairwiseBytes*numPartners )
+        return ALLTOALL_SPARSE;
+    return ALLTOALL_PAIRWISE;
+}
+
+// Whether this process would benefit from Bruck's algorithm
+bool BruckCandidate
+( const int* scs, size_t typeSize, int commSize, int commRank )
+{
+    if( commSize < bruckMinSize )
+        return false;
+    int numPartners = 0;
+    double numBytes = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank || scs[q] == 0 )
+            continue;
+        ++numPartners;
+        numBytes += double(scs[q])*typeSize;
+    }
+    return 2*numPartners >= commSize && numBytes <= bruckBytes*numPartners;
+}
+
+// Post every receive and send at once (without the barrier and ready-mode
+// sends which would otherwise be required)
+template<typename T>
+void SparseExchange
+( const T* sbuf, const int* scs, const int* sds,
+        T* rbuf, const int* rcs, const int* rds, Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    vector<Request<T>> requests( 2*commSize );
+    int numRequests = 0;
+    for( int q=0; q<commSize; ++q )
+        if( q != commRank && rcs[q] != 0 )
+            IRecv( &rbuf[rds[q]], rcs[q], q, comm, requests[numRequests++] );
+    for( int q=0; q<commSize; ++q )
+        if( q != commRank && scs[q] != 0 )
+            ISend( &sbuf[sds[q]], scs[q], q, comm, requests[numRequests++] );
+    std::copy_n( &sbuf[sds[commRank]], scs[commRank], &rbuf[rds[commRank]] );
+    WaitAll( numRequests, requests.data() );
+}
+
+// In step k, send to the process k ranks ahead and receive from the one k
+// ranks behind
+template<typename T>
+void PairwiseExchange
+( const T* sbuf, const int* scs, const int* sds,
+        T* rbuf, const int* rcs, const int* rds, Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    std::copy_n( &sbuf[sds[commRank]], scs[commRank], &rbuf[rds[commRank]] );
+    Request<T> requests[2];
+    for( int k=1; k<commSize; ++k )
+    {
+        const int to = (commRank+k) % commSize;
+        const int from = (commRank-k+commSize) % commSize;
+        int numRequests = 0;
+        if( rcs[from] != 0 )
+            IRecv
+            ( &rbuf[rds[from]], rcs[from], from, comm,
+              requests[numRequests++] );
+        if( scs[to] != 0 )
+            ISend
+            ( &sbuf[sds[to]], scs[to], to, comm, requests[numRequests++] );
+        WaitAll( numRequests, requests );
+    }
+}
+
+// Bruck's algorithm: in the step with distance 2^k, every block which still
+// has to travel a distance with bit k set is forwarded 2^k ranks ahead, so
+// that only log2(p) (pairs of) messages are sent
+template<typename T>
+void BruckExchange
+( const T* sbuf, const int* scs, const int* sds,
+        T* rbuf, const int* rcs, const int* rds, Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    // Block j holds the data which still has to travel j ranks ahead
+    vector<vector<T>> blocks( commSize );
+    for( int j=0; j<commSize; ++j )
+    {
+        const int q = (commRank+j) % commSize;
+        blocks[j].assign( &sbuf[sds[q]], &sbuf[sds[q]]+scs[q] );
+    }
+
+    vector<int> sendSizes, recvSizes;
+    vector<T> sendBuf, recvBuf;
+    for( int dist=1; dist<commSize; dist*=2 )
+    {
+        const int to = (commRank+dist) % commSize;
+        const int from = (commRank-dist+commSize) % commSize;
+        sendSizes.clear();
+        sendBuf.clear();
+        for( int j=dist; j<commSize; ++j )
+        {
+            if( j & dist )
+            {
+                sendSizes.push_back( blocks[j].size() );
+                sendBuf.insert
+                ( sendBuf.end(), blocks[j].begin(), blocks[j].end() );
+            }
+        }
+
+        // The sizes of the forwarded blocks are not known in advance
+        const int numBlocks = sendSizes.size();
+        recvSizes.resize( numBlocks );
+        SendRecv
+        ( sendSizes.data(), numBlocks, to,
+          recvSizes.data(), numBlocks, from, comm );
+        int totalRecv = 0;
+        for( const int size : recvSizes )
+            totalRecv += size;
+        recvBuf.resize( totalRecv );
+        SendRecv
+        ( sendBuf.data(), int(sendBuf.size()), to,
+          recvBuf.data(), totalRecv, from, comm );
+
+        int offset = 0, block = 0;
+        for( int j=dist; j<commSize; ++j )
+        {
+            if( j & dist )
+            {
+                const int size = recvSizes[block++];
+                blocks[j].assign
+                ( recvBuf.begin()+offset, recvBuf.begin()+offset+size );
+                offset += size;
+            }
+        }
+    }
+
+    // Block j now holds the data from the process j ranks behind
+    for( int j=0; j<commSize; ++j )
+    {
+        const int q = (commRank-j+commSize) % commSize;
+        EL_DEBUG_ONLY(
+          if( int(blocks[j].size()) != rcs[q] )
+              LogicError("Received ",blocks[j].size()," entries from ",q,
+                         " rather than ",rcs[q]);
+        )
+        std::copy( blocks[j].begin(), blocks[j].end(), &rbuf[rds[q]] );
+    }
+}
+
+template<typename T>
+void AllToAll
+( const T* sbuf, const int* scs, const int* sds,
+        T* rbuf, const int* rcs, const int* rds, Comm comm,
+  AllToAllAlgorithm alg )
+{
+    EL_DEBUG_CSE
+    if( alg == ALLTOALL_DEFAULT )
+        alg = ChooseAllToAll( scs, rcs, sizeof(T), Size(comm), Rank(comm) );
+    switch( alg )
+    {
+    case ALLTOALL_PAIRWISE:
+        PairwiseExchange( sbuf, scs, sds, rbuf, rcs, rds, comm );
+        break;
+    case ALLTOALL_BRUCK:
+        BruckExchange( sbuf, scs, sds, rbuf, rcs, rds, comm );
+        break;
+    case ALLTOALL_SPARSE:
+        SparseExchange( sbuf, scs, sds, rbuf, rcs, rds, comm );
+        break;
+    default:
+        AllToAll( sbuf, scs, sds, rbuf, rcs, rds, comm );
+    }
+}
+
+} // anonymous namespace
+
+void SetAllToAllAlgorithm( AllToAllAlgorithm alg ) EL_NO_EXCEPT
+{ allToAllAlgorithm = alg; }
+
+AllToAllAlgorithm GetAllToAllAlgorithm() EL_NO_EXCEPT
+{ return allToAllAlgorithm; }
+
+template<typename T>
 vector<T> AllToAll
 ( const vector<T>& sendBuf,
   const vector<int>& sendCounts,
@@ -1924,17 +2703,168 @@ vector<T> AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    AllToAllAlgorithm alg = GetAllToAllAlgorithm();
+
+    // Alongside the counts, each process votes on whether the exchange is
+    // small and dense enough for Bruck's algorithm, which is only used if
+    // every process agrees
+    const int vote = alg == ALLTOALL_DEFAULT &&
+      BruckCandidate( sendCounts.data(), sizeof(T), commSize, commRank );
+    vector<int> sendInfo(2*commSize), recvInfo(2*commSize);
+    for( int q=0; q<commSize; ++q )
+    {
+        sendInfo[2*q] = sendCounts[q];
+        sendInfo[2*q+1] = vote;
+    }
+    AllToAll( sendInfo.data(), 2, recvInfo.data(), 2, comm );
     vector<int> recvCounts(commSize);
-    AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+    bool unanimous = true;
+    for( int q=0; q<commSize; ++q )
+    {
+        recvCounts[q] = recvInfo[2*q];
+        unanimous = unanimous && recvInfo[2*q+1];
+    }
+    if( unanimous && alg == ALLTOALL_DEFAULT )
+        alg = ALLTOALL_BRUCK;
+
     vector<int> recvOffs;
     const int totalRecv = El::Scan( recvCounts, recvOffs );
     vector<T> recvBuf(totalRecv);
     AllToAll
     ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
-      recvBuf.data(), recvCounts.data(), recvOffs.data(), comm );
+      recvBuf.data(), recvCounts.data(), recvOffs.data(), comm, alg );
     return recvBuf;
 }
 
+#ifdef EL_USE_64BIT_INTS
+// Variable-count collectives with Int counts
+// ==========================================
+namespace {
+
+// Narrows Int counts and displacements for the int collectives, unless a
+// count exceeds the maximum message count or a count or displacement would
+// not fit in an int (even when doubled to ship complex data as real pairs)
+bool NarrowCounts
+( const Int* counts, const Int* displs, int n,
+  vector<int>& intCounts, vector<int>& intDispls )
+{
+    const Int maxInt = std::numeric_limits<int>::max() / 2;
+    const Int maxCount = Min( maxMessageCount, maxInt );
+    intCounts.resize( n );
+    intDispls.resize( n );
+    for( int q=0; q<n; ++q )
+    {
+        if( counts[q] > maxCount || displs[q] > maxInt )
+            return false;
+        intCounts[q] = int(counts[q]);
+        intDispls[q] = int(displs[q]);
+    }
+    return true;
+}
+
+// As PairwiseExchange, but with the Int counts of SendRecv, which ships
+// large blocks as LargeMessages. A zero count on either side of a pair
+// replaces the corresponding partner with MPI_PROC_NULL.
+template<typename T>
+void PairwiseSendRecv
+( const T* sbuf, const Int* scs, const Int* sds,
+        T* rbuf, const Int* rcs, const Int* rds, Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    std::copy_n( &sbuf[sds[commRank]], scs[commRank], &rbuf[rds[commRank]] );
+    for( int k=1; k<commSize; ++k )
+    {
+        const int to = (commRank+k) % commSize;
+        const int from = (commRank-k+commSize) % commSize;
+        SendRecv
+        ( &sbuf[sds[to]],   scs[to],   scs[to]   ? to   : MPI_PROC_NULL,
+          &rbuf[rds[from]], rcs[from], rcs[from] ? from : MPI_PROC_NULL,
+          comm );
+    }
+}
+
+} // anonymous namespace
+
+template<typename T>
+void Gather
+( const T* sbuf, Int sc,
+        T* rbuf, const Int* rcs, const Int* rds,
+  int root, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    vector<int> intCounts, intDispls;
+    int fits = 1;
+    if( commRank == root )
+        fits = NarrowCounts( rcs, rds, commSize, intCounts, intDispls );
+    Broadcast( fits, root, comm );
+    if( fits )
+    {
+        Gather
+        ( sbuf, int(sc), rbuf, intCounts.data(), intDispls.data(),
+          root, comm );
+        return;
+    }
+
+    // Every process sends its contribution to the root, and only the root
+    // receives
+    vector<Int> scs(commSize,0), sds(commSize,0), zeros;
+    scs[root] = sc;
+    if( commRank != root )
+    {
+        zeros.resize( commSize, 0 );
+        rcs = rds = zeros.data();
+    }
+    PairwiseSendRecv( sbuf, scs.data(), sds.data(), rbuf, rcs, rds, comm );
+}
+
+template<typename T>
+void AllGather
+( const T* sbuf, Int sc,
+        T* rbuf, const Int* rcs, const Int* rds, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    // Every process has the same counts, and hence reaches the same decision
+    const int commSize = Size( comm );
+    vector<int> intCounts, intDispls;
+    if( NarrowCounts( rcs, rds, commSize, intCounts, intDispls ) )
+    {
+        AllGather
+        ( sbuf, int(sc), rbuf, intCounts.data(), intDispls.data(), comm );
+        return;
+    }
+    vector<Int> scs(commSize,sc), sds(commSize,0);
+    PairwiseSendRecv( sbuf, scs.data(), sds.data(), rbuf, rcs, rds, comm );
+}
+
+template<typename T>
+void AllToAll
+( const T* sbuf, const Int* scs, const Int* sds,
+        T* rbuf, const Int* rcs, const Int* rds, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const int commSize = Size( comm );
+    vector<int> intSendCounts, intSendDispls, intRecvCounts, intRecvDispls;
+    const int fits = AllReduce
+    ( int(NarrowCounts( scs, sds, commSize, intSendCounts, intSendDispls ) &&
+          NarrowCounts( rcs, rds, commSize, intRecvCounts, intRecvDispls )),
+      MIN, comm );
+    if( fits )
+        AllToAll
+        ( sbuf, intSendCounts.data(), intSendDispls.data(),
+          rbuf, intRecvCounts.data(), intRecvDispls.data(), comm );
+    else
+        PairwiseSendRecv( sbuf, scs, sds, rbuf, rcs, rds, comm );
+}
+#endif // ifdef EL_USE_64BIT_INTS
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void Reduce
@@ -2161,61 +3091,61 @@ EL_NO_RELEASE_EXCEPT
 
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
-void AllReduce( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
+void AllReduce( const Real* sbuf, Real* rbuf, Int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    if( count != 0 )
-    {
-        MPI_Op opC = NativeOp<Real>( op );
-        EL_CHECK_MPI
-        ( MPI_Allreduce
-          ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(), opC,
-            comm.comm ) );
-    }
+    MPI_Op opC = NativeOp<Real>( op );
+    ReduceInPieces
+    ( count, [&]( size_t offset, int pieceSize )
+      {
+          EL_CHECK_MPI
+          ( MPI_Allreduce
+            ( const_cast<Real*>(sbuf+offset), rbuf+offset, pieceSize,
+              TypeMap<Real>(), opC, comm.comm ) );
+      } );
 }
 
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void AllReduce
-( const Complex<Real>* sbuf, Complex<Real>* rbuf, int count, Op op, Comm comm )
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, Int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    if( count != 0 )
-    {
 #ifdef EL_AVOID_COMPLEX_MPI
-        if( op == SUM )
-        {
-            MPI_Op opC = NativeOp<Real>( op );
-            EL_CHECK_MPI
-            ( MPI_Allreduce
-                ( const_cast<Complex<Real>*>(sbuf),
-                  rbuf, 2*count, TypeMap<Real>(), opC, comm.comm ) );
-        }
-        else
-        {
-            MPI_Op opC = NativeOp<Complex<Real>>( op );
-            EL_CHECK_MPI
-            ( MPI_Allreduce
-              ( const_cast<Complex<Real>*>(sbuf),
-                rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm ) );
-        }
-#else
-        MPI_Op opC = NativeOp<Complex<Real>>( op );
-        EL_CHECK_MPI
-        ( MPI_Allreduce
-          ( const_cast<Complex<Real>*>(sbuf),
-            rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm ) );
-#endif
+    if( op == SUM )
+    {
+        MPI_Op opC = NativeOp<Real>( op );
+        const Real* sbufReal = reinterpret_cast<const Real*>(sbuf);
+        Real* rbufReal = reinterpret_cast<Real*>(rbuf);
+        ReduceInPieces
+        ( 2*size_t(count), [&]( size_t offset, int pieceSize )
+          {
+              EL_CHECK_MPI
+              ( MPI_Allreduce
+                ( const_cast<Real*>(sbufReal+offset), rbufReal+offset,
+                  pieceSize, TypeMap<Real>(), opC, comm.comm ) );
+          } );
+        return;
     }
+#endif
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    ReduceInPieces
+    ( count, [&]( size_t offset, int pieceSize )
+      {
+          EL_CHECK_MPI
+          ( MPI_Allreduce
+            ( const_cast<Complex<Real>*>(sbuf+offset), rbuf+offset,
+              pieceSize, TypeMap<Complex<Real>>(), opC, comm.comm ) );
+      } );
 }
 
 template<typename T,
          typename/*=DisableIf<IsPacked<T>>*/,
          typename/*=void*/>
 void AllReduce
-( const T* sbuf, T* rbuf, int count, Op op, Comm comm )
+( const T* sbuf, T* rbuf, Int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
@@ -2227,15 +3157,20 @@ EL_NO_RELEASE_EXCEPT
     Serialize( count, sbuf, packedSend );
 
     ReserveSerialized( count, rbuf, packedRecv );
-    EL_CHECK_MPI
-    ( MPI_Allreduce
-      ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
-        opC, comm.comm ) );
+    const size_t entrySize = packedRecv.size() / count;
+    ReduceInPieces
+    ( count, [&]( size_t offset, int pieceSize )
+      {
+          EL_CHECK_MPI
+          ( MPI_Allreduce
+            ( &packedSend[offset*entrySize], &packedRecv[offset*entrySize],
+              pieceSize, TypeMap<T>(), opC, comm.comm ) );
+      } );
     Deserialize( count, packedRecv, rbuf );
 }
 
 template<typename T>
-void AllReduce( const T* sbuf, T* rbuf, int count, Comm comm )
+void AllReduce( const T* sbuf, T* rbuf, Int count, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { AllReduce( sbuf, rbuf, count, SUM, comm ); }
 
@@ -2251,7 +3186,7 @@ EL_NO_RELEASE_EXCEPT
 
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
-void AllReduce( Real* buf, int count, Op op, Comm comm )
+void AllReduce( Real* buf, Int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
@@ -2259,14 +3194,19 @@ EL_NO_RELEASE_EXCEPT
         return;
 
     MPI_Op opC = NativeOp<Real>( op );
-    EL_CHECK_MPI
-    ( MPI_Allreduce
-      ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, comm.comm ) );
+    ReduceInPieces
+    ( count, [&]( size_t offset, int pieceSize )
+      {
+          EL_CHECK_MPI
+          ( MPI_Allreduce
+            ( MPI_IN_PLACE, buf+offset, pieceSize, TypeMap<Real>(), opC,
+              comm.comm ) );
+      } );
 }
 
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
-void AllReduce( Complex<Real>* buf, int count, Op op, Comm comm )
+void AllReduce( Complex<Real>* buf, Int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
@@ -2277,53 +3217,227 @@ EL_NO_RELEASE_EXCEPT
     if( op == SUM )
     {
         MPI_Op opC = NativeOp<Real>( op );
-        EL_CHECK_MPI
-        ( MPI_Allreduce
-          ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, comm.comm ) );
+        Real* bufReal = reinterpret_cast<Real*>(buf);
+        ReduceInPieces
+        ( 2*size_t(count), [&]( size_t offset, int pieceSize )
+          {
+              EL_CHECK_MPI
+              ( MPI_Allreduce
+                ( MPI_IN_PLACE, bufReal+offset, pieceSize, TypeMap<Real>(),
+                  opC, comm.comm ) );
+          } );
+        return;
     }
-    else
+#endif
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    ReduceInPieces
+    ( count, [&]( size_t offset, int pieceSize )
+      {
+          EL_CHECK_MPI
+          ( MPI_Allreduce
+            ( MPI_IN_PLACE, buf+offset, pieceSize, TypeMap<Complex<Real>>(),
+              opC, comm.comm ) );
+      } );
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void AllReduce( T* buf, Int count, Op op, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( count == 0 )
+        return;
+
+    MPI_Op opC = NativeOp<T>( op );
+    std::vector<byte> packedSend, packedRecv;
+    Serialize( count, buf, packedSend );
+
+    ReserveSerialized( count, buf, packedRecv );
+    const size_t entrySize = packedRecv.size() / count;
+    ReduceInPieces
+    ( count, [&]( size_t offset, int pieceSize )
+      {
+          EL_CHECK_MPI
+          ( MPI_Allreduce
+            ( &packedSend[offset*entrySize], &packedRecv[offset*entrySize],
+              pieceSize, TypeMap<T>(), opC, comm.comm ) );
+      } );
+    Deserialize( count, packedRecv, buf );
+}
+
+template<typename T>
+void AllReduce( T* buf, Int count, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{ AllReduce( buf, count, SUM, comm ); }
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( const Real* sbuf, Real* rbuf, Int count, Op op, Comm comm,
+  Request<Real>& request )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    // Reductions over derived datatypes cannot use the predefined operations,
+    // so one which is too large for a single message is performed in pieces
+    // before returning an already completed request
+    if( size_t(count) > size_t(GetMaxMessageCount()) )
     {
-        MPI_Op opC = NativeOp<Complex<Real>>( op );
+        AllReduce( sbuf, rbuf, count, op, comm );
+        request.receivingPacked = false;
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+    MPI_Op opC = NativeOp<Real>( op );
+    EL_CHECK_MPI
+    ( MPI_Iallreduce
+      ( const_cast<Real*>(sbuf), rbuf, int(count), TypeMap<Real>(), opC,
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, Int count, Op op,
+  Comm comm, Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    // Reductions over derived datatypes cannot use the predefined operations,
+    // so one which is too large for a single message is performed in pieces
+    // before returning an already completed request
+    if( 2*size_t(count) > size_t(GetMaxMessageCount()) )
+    {
+        AllReduce( sbuf, rbuf, count, op, comm );
+        request.receivingPacked = false;
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+ #ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        MPI_Op opC = NativeOp<Real>( op );
         EL_CHECK_MPI
-        ( MPI_Allreduce
-          ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(),
-            opC, comm.comm ) );
+        ( MPI_Iallreduce
+          ( const_cast<Complex<Real>*>(sbuf), rbuf, 2*int(count),
+            TypeMap<Real>(), opC, comm.comm, &request.backend ) );
+        return;
+    }
+ #endif
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    EL_CHECK_MPI
+    ( MPI_Iallreduce
+      ( const_cast<Complex<Real>*>(sbuf), rbuf, int(count),
+        TypeMap<Complex<Real>>(), opC, comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllReduce
+( const T* sbuf, T* rbuf, Int count, Op op, Comm comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    // Reductions over derived datatypes cannot use the predefined operations,
+    // so one which is too large for a single message is performed in pieces
+    // before returning an already completed request
+    if( size_t(count) > size_t(GetMaxMessageCount()) )
+    {
+        AllReduce( sbuf, rbuf, count, op, comm );
+        request.receivingPacked = false;
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+    MPI_Op opC = NativeOp<T>( op );
+    Serialize( count, sbuf, request.sendBuffer );
+    request.receivingPacked = true;
+    request.recvCount = count;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( count, rbuf, request.buffer );
+    EL_CHECK_MPI
+    ( MPI_Iallreduce
+      ( request.sendBuffer.data(), request.buffer.data(), int(count),
+        TypeMap<T>(), opC, comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( Real* buf, Int count, Op op, Comm comm, Request<Real>& request )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    if( size_t(count) > size_t(GetMaxMessageCount()) )
+    {
+        AllReduce( buf, count, op, comm );
+        request.receivingPacked = false;
+        request.backend = MPI_REQUEST_NULL;
+        return;
     }
+    MPI_Op opC = NativeOp<Real>( op );
+    EL_CHECK_MPI
+    ( MPI_Iallreduce
+      ( MPI_IN_PLACE, buf, int(count), TypeMap<Real>(), opC, comm.comm,
+        &request.backend ) );
 #else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( Complex<Real>* buf, Int count, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    if( 2*size_t(count) > size_t(GetMaxMessageCount()) )
+    {
+        AllReduce( buf, count, op, comm );
+        request.receivingPacked = false;
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+ #ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        MPI_Op opC = NativeOp<Real>( op );
+        EL_CHECK_MPI
+        ( MPI_Iallreduce
+          ( MPI_IN_PLACE, buf, 2*int(count), TypeMap<Real>(), opC,
+            comm.comm, &request.backend ) );
+        return;
+    }
+ #endif
     MPI_Op opC = NativeOp<Complex<Real>>( op );
     EL_CHECK_MPI
-    ( MPI_Allreduce
-      ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC,
-        comm.comm ) );
+    ( MPI_Iallreduce
+      ( MPI_IN_PLACE, buf, int(count), TypeMap<Complex<Real>>(), opC,
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
 #endif
 }
 
 template<typename T,
          typename/*=DisableIf<IsPacked<T>>*/,
          typename/*=void*/>
-void AllReduce( T* buf, int count, Op op, Comm comm )
-EL_NO_RELEASE_EXCEPT
-{
-    EL_DEBUG_CSE
-    if( count == 0 )
-        return;
-
-    MPI_Op opC = NativeOp<T>( op );
-    std::vector<byte> packedSend, packedRecv;
-    Serialize( count, buf, packedSend );
-
-    ReserveSerialized( count, buf, packedRecv );
-    EL_CHECK_MPI
-    ( MPI_Allreduce
-      ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
-        opC, comm.comm ) );
-    Deserialize( count, packedRecv, buf );
-}
-
-template<typename T>
-void AllReduce( T* buf, int count, Comm comm )
-EL_NO_RELEASE_EXCEPT
-{ AllReduce( buf, count, SUM, comm ); }
+void IAllReduce( T* buf, Int count, Op op, Comm comm, Request<T>& request )
+{ IAllReduce( static_cast<const T*>(buf), buf, count, op, comm, request ); }
 
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
@@ -2531,6 +3645,142 @@ void ReduceScatter( T* buf, int rc, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { ReduceScatter( buf, rc, SUM, comm ); }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IReduceScatter
+( const Real* sbuf, Real* rbuf, Int rc, Op op, Comm comm,
+  Request<Real>& request )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    MPI_Op opC = NativeOp<Real>( op );
+    // Reductions over derived datatypes cannot use the predefined operations,
+    // so one which is too large for a single message is performed in pieces
+    // before returning an already completed request
+    if( size_t(rc) > size_t(GetMaxMessageCount()) )
+    {
+        ReduceScatterInPieces
+        ( reinterpret_cast<const byte*>(sbuf), reinterpret_cast<byte*>(rbuf),
+          size_t(rc), sizeof(Real), mpi::Size(comm),
+          [&]( const byte* pieceSend, byte* pieceRecv, int pieceSize )
+          {
+              EL_CHECK_MPI
+              ( MPI_Reduce_scatter_block
+                ( const_cast<byte*>(pieceSend), pieceRecv, pieceSize,
+                  TypeMap<Real>(), opC, comm.comm ) );
+          } );
+        request.receivingPacked = false;
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+    EL_CHECK_MPI
+    ( MPI_Ireduce_scatter_block
+      ( const_cast<Real*>(sbuf), rbuf, int(rc), TypeMap<Real>(), opC,
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IReduceScatter
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, Int rc, Op op,
+  Comm comm, Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+ #ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        MPI_Op opC = NativeOp<Real>( op );
+        if( 2*size_t(rc) <= size_t(GetMaxMessageCount()) )
+        {
+            EL_CHECK_MPI
+            ( MPI_Ireduce_scatter_block
+              ( const_cast<Complex<Real>*>(sbuf), rbuf, 2*int(rc),
+                TypeMap<Real>(), opC, comm.comm, &request.backend ) );
+            return;
+        }
+    }
+ #endif
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    // Reductions over derived datatypes cannot use the predefined operations,
+    // so one which is too large for a single message is performed in pieces
+    // before returning an already completed request
+    if( size_t(rc) > size_t(GetMaxMessageCount()) )
+    {
+        ReduceScatterInPieces
+        ( reinterpret_cast<const byte*>(sbuf), reinterpret_cast<byte*>(rbuf),
+          size_t(rc), sizeof(Complex<Real>), mpi::Size(comm),
+          [&]( const byte* pieceSend, byte* pieceRecv, int pieceSize )
+          {
+              EL_CHECK_MPI
+              ( MPI_Reduce_scatter_block
+                ( const_cast<byte*>(pieceSend), pieceRecv, pieceSize,
+                  TypeMap<Complex<Real>>(), opC, comm.comm ) );
+          } );
+        request.receivingPacked = false;
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+    EL_CHECK_MPI
+    ( MPI_Ireduce_scatter_block
+      ( const_cast<Complex<Real>*>(sbuf), rbuf, int(rc),
+        TypeMap<Complex<Real>>(), opC, comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IReduceScatter
+( const T* sbuf, T* rbuf, Int rc, Op op, Comm comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    MPI_Op opC = NativeOp<T>( op );
+    const int commSize = mpi::Size( comm );
+    Serialize( rc*commSize, sbuf, request.sendBuffer );
+    ReserveSerialized( rc, rbuf, request.buffer );
+    // Reductions over derived datatypes cannot use the predefined operations,
+    // so one which is too large for a single message is performed in pieces
+    // before returning an already completed request
+    if( size_t(rc) > size_t(GetMaxMessageCount()) )
+    {
+        const size_t entrySize = request.buffer.size() / rc;
+        ReduceScatterInPieces
+        ( request.sendBuffer.data(), request.buffer.data(), rc, entrySize,
+          commSize,
+          [&]( const byte* pieceSend, byte* pieceRecv, int pieceSize )
+          {
+              EL_CHECK_MPI
+              ( MPI_Reduce_scatter_block
+                ( const_cast<byte*>(pieceSend), pieceRecv, pieceSize,
+                  TypeMap<T>(), opC, comm.comm ) );
+          } );
+        Deserialize( rc, request.buffer, rbuf );
+        request.buffer.clear();
+        request.sendBuffer.clear();
+        request.receivingPacked = false;
+        request.backend = MPI_REQUEST_NULL;
+        return;
+    }
+    request.receivingPacked = true;
+    request.recvCount = rc;
+    request.unpackedRecvBuf = rbuf;
+    EL_CHECK_MPI
+    ( MPI_Ireduce_scatter_block
+      ( request.sendBuffer.data(), request.buffer.data(), int(rc),
+        TypeMap<T>(), opC, comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void ReduceScatter
@@ -2814,50 +4064,407 @@ void SparseAllToAll
         vector<T>& recvBuffer,
   const vector<int>& recvCounts,
   const vector<int>& recvDispls,
-        Comm comm )
+        Comm comm, AllToAllAlgorithm alg )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(VerifySendsAndRecvs( sendCounts, recvCounts, comm ))
-#ifdef EL_USE_CUSTOM_ALLTOALLV
-    const int commSize = Size( comm );
-    int numSends=0,numRecvs=0;
-    for( int q=0; q<commSize; ++q )
+    AllToAll
+    ( sendBuffer.data(), sendCounts.data(), sendDispls.data(),
+      recvBuffer.data(), recvCounts.data(), recvDispls.data(), comm, alg );
+}
+
+template<typename T>
+void SparseAllToAll
+( const vector<T>& sendBuffer,
+  const vector<int>& sendCounts,
+  const vector<int>& sendDispls,
+        vector<T>& recvBuffer,
+  const vector<int>& recvCounts,
+  const vector<int>& recvDispls,
+        Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    SparseAllToAll
+    ( sendBuffer, sendCounts, sendDispls,
+      recvBuffer, recvCounts, recvDispls, comm, GetAllToAllAlgorithm() );
+}
+
+// Hierarchical collectives
+// ------------------------
+template<typename T>
+void LeaderAllGather
+( const T* sbuf, int sc, T* rbuf, int rc, const NodeHierarchy& hierarchy )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const int commSize = hierarchy.nodeOrder.size();
+    const int nodeSize = hierarchy.nodeSizes[hierarchy.node];
+    const int nodeOff = hierarchy.nodeOffs[hierarchy.node];
+    const bool leader = ( hierarchy.leaderComm != COMM_NULL );
+
+    // Gather in node order (directly into rbuf if that is the final order)
+    vector<T> nodeOrdered;
+    T* gathered = rbuf;
+    if( !hierarchy.contiguous && leader )
     {
-        if( sendCounts[q] != 0 )
-            ++numSends;
-        if( recvCounts[q] != 0 )
-            ++numRecvs;
+        nodeOrdered.resize( commSize*rc );
+        gathered = nodeOrdered.data();
     }
-    vector<Status> statuses(numSends+numRecvs);
-    vector<Request<T>> requests(numSends+numRecvs);
-    int rCount=0;
-    for( int q=0; q<commSize; ++q )
+    Gather
+    ( sbuf, sc, ( leader ? &gathered[nodeOff*rc] : nullptr ), rc,
+      0, hierarchy.nodeComm );
+    if( !leader )
+        return;
+
+    const int numNodes = hierarchy.nodeSizes.size();
+    vector<int> rcs( numNodes ), rds( numNodes );
+    for( int node=0; node<numNodes; ++node )
     {
-        int count = recvCounts[q];
-        int displ = recvDispls[q];
-        if( count != 0 )
-            IRecv( &recvBuffer[displ], count, q, comm, requests[rCount++] );
+        rcs[node] = hierarchy.nodeSizes[node]*rc;
+        rds[node] = hierarchy.nodeOffs[node]*rc;
     }
+    vector<T> nodeBuf( gathered+nodeOff*rc, gathered+(nodeOff+nodeSize)*rc );
+    AllGather
+    ( nodeBuf.data(), nodeSize*rc,
+      gathered, rcs.data(), rds.data(), hierarchy.leaderComm );
 
-    // Ensure that recvs are posted before the sends
-    // (Invalid MPI_Irecv's have been observed otherwise)
-    Barrier( comm );
+    if( !hierarchy.contiguous )
+        for( int k=0; k<commSize; ++k )
+            MemCopy( &rbuf[hierarchy.nodeOrder[k]*rc], &gathered[k*rc], rc );
+}
 
-    for( int q=0; q<commSize; ++q )
+template<typename T>
+void LeaderAllGather
+( const T* sbuf, Int sc, T* rbuf, const Int* rcs, const Int* rds,
+  const NodeHierarchy& hierarchy ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const int commSize = hierarchy.nodeOrder.size();
+    const int numNodes = hierarchy.nodeSizes.size();
+    const int nodeSize = hierarchy.nodeSizes[hierarchy.node];
+    const int nodeOff = hierarchy.nodeOffs[hierarchy.node];
+    const bool leader = ( hierarchy.leaderComm != COMM_NULL );
+
+    // The contributions are packed in node order
+    vector<Int> packedOffs( commSize+1, 0 );
+    for( int k=0; k<commSize; ++k )
+        packedOffs[k+1] = packedOffs[k] + rcs[hierarchy.nodeOrder[k]];
+    vector<T> packed( leader ? packedOffs[commSize] : 0 );
+
+    vector<Int> memberCounts( nodeSize ), memberDispls( nodeSize );
+    for( int i=0; i<nodeSize; ++i )
+    {
+        memberCounts[i] = rcs[hierarchy.nodeOrder[nodeOff+i]];
+        memberDispls[i] = packedOffs[nodeOff+i] - packedOffs[nodeOff];
+    }
+    Gather
+    ( sbuf, sc, ( leader ? packed.data()+packedOffs[nodeOff] : nullptr ),
+      memberCounts.data(), memberDispls.data(), 0, hierarchy.nodeComm );
+    if( !leader )
+        return;
+
+    vector<Int> nodeCounts( numNodes ), nodeDispls( numNodes );
+    for( int node=0; node<numNodes; ++node )
+    {
+        const int first = hierarchy.nodeOffs[node];
+        nodeDispls[node] = packedOffs[first];
+        nodeCounts[node] =
+          packedOffs[first+hierarchy.nodeSizes[node]] - packedOffs[first];
+    }
+    vector<T> nodeBuf
+    ( packed.data()+nodeDispls[hierarchy.node],
+      packed.data()+nodeDispls[hierarchy.node]+nodeCounts[hierarchy.node] );
+    AllGather
+    ( nodeBuf.data(), nodeCounts[hierarchy.node],
+      packed.data(), nodeCounts.data(), nodeDispls.data(),
+      hierarchy.leaderComm );
+
+    for( int k=0; k<commSize; ++k )
+    {
+        const int rank = hierarchy.nodeOrder[k];
+        MemCopy( rbuf+rds[rank], packed.data()+packedOffs[k], rcs[rank] );
+    }
+}
+
+template<typename T>
+void AllGather
+( const T* sbuf, int sc, T* rbuf, int rc, const NodeHierarchy& hierarchy )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const int commSize = hierarchy.nodeOrder.size();
+    LeaderAllGather( sbuf, sc, rbuf, rc, hierarchy );
+    Broadcast( rbuf, commSize*rc, 0, hierarchy.nodeComm );
+}
+
+template<typename T>
+void AllReduce
+( const T* sbuf, T* rbuf, int count, Op op, const NodeHierarchy& hierarchy )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    Reduce( sbuf, rbuf, count, op, 0, hierarchy.nodeComm );
+    if( hierarchy.leaderComm != COMM_NULL )
+        AllReduce( rbuf, count, op, hierarchy.leaderComm );
+    Broadcast( rbuf, count, 0, hierarchy.nodeComm );
+}
+
+template<typename T>
+void AllReduce( T* buf, int count, Op op, const NodeHierarchy& hierarchy )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    Reduce( buf, count, op, 0, hierarchy.nodeComm );
+    if( hierarchy.leaderComm != COMM_NULL )
+        AllReduce( buf, count, op, hierarchy.leaderComm );
+    Broadcast( buf, count, 0, hierarchy.nodeComm );
+}
+
+template<typename T>
+void ReduceScatter
+( const T* sbuf, T* rbuf, int rc, Op op, const NodeHierarchy& hierarchy )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const int commSize = hierarchy.nodeOrder.size();
+    const int numNodes = hierarchy.nodeSizes.size();
+    const bool leader = ( hierarchy.leaderComm != COMM_NULL );
+
+    // Sum the contributions of the node in node order onto the leader
+    vector<T> nodeOrdered;
+    const T* ordered = sbuf;
+    if( !hierarchy.contiguous )
+    {
+        nodeOrdered.resize( commSize*rc );
+        for( int k=0; k<commSize; ++k )
+            MemCopy( &nodeOrdered[k*rc], &sbuf[hierarchy.nodeOrder[k]*rc], rc );
+        ordered = nodeOrdered.data();
+    }
+    vector<T> nodeSums( leader ? commSize*rc : 0 );
+    Reduce( ordered, nodeSums.data(), commSize*rc, op, 0, hierarchy.nodeComm );
+
+    // Sum the blocks of each node across the leaders and hand them out
+    vector<T> nodeBlock;
+    if( leader )
+    {
+        vector<int> rcs( numNodes );
+        for( int node=0; node<numNodes; ++node )
+            rcs[node] = hierarchy.nodeSizes[node]*rc;
+        nodeBlock.resize( rcs[hierarchy.node] );
+        ReduceScatter
+        ( nodeSums.data(), nodeBlock.data(), rcs.data(), op,
+          hierarchy.leaderComm );
+    }
+    Scatter( nodeBlock.data(), rc, rbuf, rc, 0, hierarchy.nodeComm );
+}
+
+template<typename T>
+void ReduceScatter( T* buf, int rc, Op op, const NodeHierarchy& hierarchy )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    vector<T> recvBuf( rc );
+    ReduceScatter( buf, recvBuf.data(), rc, op, hierarchy );
+    MemCopy( buf, recvBuf.data(), rc );
+}
+
+// Reduced-precision collectives
+// -----------------------------
+namespace {
+
+template<typename Real>
+struct IsTransportReal
+{
+    static const bool value =
+      std::is_same<Real,float>::value || std::is_same<Real,double>::value;
+};
+
+// Round to the nearest bfloat16 (with ties to even), which keeps the
+// exponent of a float and the leading seven bits of its mantissa
+inline std::uint16_t FloatToBFloat16( float alpha ) EL_NO_EXCEPT
+{
+    std::uint32_t bits;
+    std::memcpy( &bits, &alpha, sizeof(bits) );
+    if( (bits & 0x7fffffffu) > 0x7f800000u )
+        return std::uint16_t((bits >> 16) | 0x40u);
+    bits += 0x7fffu + ((bits >> 16) & 1u);
+    return std::uint16_t(bits >> 16);
+}
+
+inline float BFloat16ToFloat( std::uint16_t alpha ) EL_NO_EXCEPT
+{
+    const std::uint32_t bits = std::uint32_t(alpha) << 16;
+    float beta;
+    std::memcpy( &beta, &bits, sizeof(beta) );
+    return beta;
+}
+
+// The number of bytes used to ship each entry of T
+template<typename T>
+int TransportSize( TransportPrecision precision ) EL_NO_EXCEPT
+{
+    if( !ReducesTransport<T>( precision ) )
+        return sizeof(T);
+    const int numReals = ( IsComplex<T>::value ? 2 : 1 );
+    return numReals*( precision == TRANSPORT_SINGLE ?
+                      sizeof(float) : sizeof(std::uint16_t) );
+}
+
+template<typename T,typename=EnableIf<IsTransportReal<Base<T>>>>
+void PackTransport
+( const T* buf, Int count, byte* wire, TransportPrecision precision )
+{
+    typedef Base<T> Real;
+    const Int numReals = count*( IsComplex<T>::value ? 2 : 1 );
+    const Real* EL_RESTRICT in = reinterpret_cast<const Real*>(buf);
+    if( precision == TRANSPORT_SINGLE )
+    {
+        float* EL_RESTRICT out = reinterpret_cast<float*>(wire);
+        EL_SIMD
+        for( Int i=0; i<numReals; ++i )
+            out[i] = float(in[i]);
+    }
+    else
+    {
+        std::uint16_t* EL_RESTRICT out =
+          reinterpret_cast<std::uint16_t*>(wire);
+        EL_SIMD
+        for( Int i=0; i<numReals; ++i )
+            out[i] = FloatToBFloat16( float(in[i]) );
+    }
+}
+
+template<typename T,typename=EnableIf<IsTransportReal<Base<T>>>>
+void UnpackTransport
+( const byte* wire, Int count, T* buf, TransportPrecision precision )
+{
+    typedef Base<T> Real;
+    const Int numReals = count*( IsComplex<T>::value ? 2 : 1 );
+    Real* EL_RESTRICT out = reinterpret_cast<Real*>(buf);
+    if( precision == TRANSPORT_SINGLE )
+    {
+        const float* EL_RESTRICT in = reinterpret_cast<const float*>(wire);
+        EL_SIMD
+        for( Int i=0; i<numReals; ++i )
+            out[i] = Real(in[i]);
+    }
+    else
+    {
+        const std::uint16_t* EL_RESTRICT in =
+          reinterpret_cast<const std::uint16_t*>(wire);
+        EL_SIMD
+        for( Int i=0; i<numReals; ++i )
+            out[i] = Real(BFloat16ToFloat(in[i]));
+    }
+}
+
+// Only float and double data is ever reduced
+template<typename T,typename=DisableIf<IsTransportReal<Base<T>>>,
+         typename=void>
+void PackTransport
+( const T* buf, Int count, byte* wire, TransportPrecision precision )
+{ LogicError("Cannot reduce the transport precision of this type"); }
+
+template<typename T,typename=DisableIf<IsTransportReal<Base<T>>>,
+         typename=void>
+void UnpackTransport
+( const byte* wire, Int count, T* buf, TransportPrecision precision )
+{ LogicError("Cannot reduce the transport precision of this type"); }
+
+} // namespace <anon>
+
+template<typename T>
+void AllGather
+( const T* sbuf, Int sc, T* rbuf, Int rc, Comm comm,
+  TransportPrecision precision ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( !ReducesTransport<T>( precision ) )
+    {
+        AllGather( sbuf, sc, rbuf, rc, comm );
+        return;
+    }
+    const size_t commSize = Size( comm );
+    const size_t entrySize = TransportSize<T>( precision );
+    const size_t sendBytes = entrySize*size_t(sc);
+    const size_t recvBytes = entrySize*size_t(rc);
+    vector<byte> sendWire( sendBytes ), recvWire( commSize*recvBytes );
+    PackTransport( sbuf, sc, sendWire.data(), precision );
+    // The byte counts may exceed an int, which the Int-count overload ships
+    // as a LargeMessage
+    AllGather
+    ( sendWire.data(), Int(sendBytes), recvWire.data(), Int(recvBytes),
+      comm );
+    UnpackTransport( recvWire.data(), Int(commSize)*rc, rbuf, precision );
+}
+
+template<typename T>
+void AllGather
+( const T* sbuf, Int sc, T* rbuf, Int rc, const NodeHierarchy& hierarchy,
+  TransportPrecision precision ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const size_t commSize = hierarchy.nodeOrder.size();
+    const size_t entrySize = TransportSize<T>( precision );
+    const size_t sendBytes = entrySize*size_t(sc);
+    const size_t recvBytes = entrySize*size_t(rc);
+    // The hierarchical collectives use int counts and displacements, so a
+    // wire which would not fit is shipped in full precision instead
+    const size_t maxCount = GetMaxMessageCount();
+    if( !ReducesTransport<T>( precision ) || commSize*recvBytes > maxCount )
+    {
+        EL_DEBUG_ONLY(
+          if( commSize*size_t(rc) > maxCount )
+              LogicError("Hierarchical AllGather requires an int count");
+        )
+        AllGather( sbuf, int(sc), rbuf, int(rc), hierarchy );
+        return;
+    }
+    vector<byte> sendWire( sendBytes ), recvWire( commSize*recvBytes );
+    PackTransport( sbuf, sc, sendWire.data(), precision );
+    AllGather
+    ( sendWire.data(), int(sendBytes), recvWire.data(), int(recvBytes),
+      hierarchy );
+    UnpackTransport( recvWire.data(), Int(commSize)*rc, rbuf, precision );
+}
+
+template<typename T>
+void Broadcast
+( T* buf, Int count, int root, Comm comm, TransportPrecision precision )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( !ReducesTransport<T>( precision ) )
     {
-        int count = sendCounts[q];
-        int displ = sendDispls[q];
-        if( count != 0 )
-            IRSend( &sendBuffer[displ], count, q, comm, requests[rCount++] );
+        Broadcast( buf, count, root, comm );
+        return;
     }
-    WaitAll( numSends+numRecvs, requests.data(), statuses.data() );
+    const size_t numBytes = TransportSize<T>( precision )*size_t(count);
+    vector<byte> wire( numBytes );
+    if( Rank(comm) == root )
+        PackTransport( buf, count, wire.data(), precision );
+    Broadcast( wire.data(), Int(numBytes), root, comm );
+    UnpackTransport( wire.data(), count, buf, precision );
+}
+
+#ifdef EL_USE_64BIT_INTS
+#define MPI_PROTO_INT_COUNTS(T) \
+  template void Gather \
+  ( const T* sbuf, Int sc, \
+          T* rbuf, const Int* rcs, const Int* rds, int root, Comm comm ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void AllGather \
+  ( const T* sbuf, Int sc, \
+          T* rbuf, const Int* rcs, const Int* rds, Comm comm ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void AllToAll \
+  ( const T* sbuf, const Int* scs, const Int* sds, \
+          T* rbuf, const Int* rcs, const Int* rds, Comm comm ) \
+  EL_NO_RELEASE_EXCEPT;
 #else
-    AllToAll
-    ( sendBuffer.data(), sendCounts.data(), sendDispls.data(),
-      recvBuffer.data(), recvCounts.data(), recvDispls.data(), comm );
+#define MPI_PROTO_INT_COUNTS(T)
 #endif
-}
 
 #define MPI_PROTO(T) \
   template bool Test( Request<T>& request ) EL_NO_RELEASE_EXCEPT; \
@@ -2917,23 +4524,23 @@ EL_NO_RELEASE_EXCEPT
   template T IRecv<T>( int from, Comm comm, Request<T>& request ) \
   EL_NO_RELEASE_EXCEPT; \
   template void TaggedSendRecv \
-  ( const T* sbuf, int sc, int to,   int stag, \
-          T* rbuf, int rc, int from, int rtag, Comm comm ) \
+  ( const T* sbuf, Int sc, int to,   int stag, \
+          T* rbuf, Int rc, int from, int rtag, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void SendRecv \
-  ( const T* sbuf, int sc, int to, \
-          T* rbuf, int rc, int from, Comm comm ) EL_NO_RELEASE_EXCEPT; \
+  ( const T* sbuf, Int sc, int to, \
+          T* rbuf, Int rc, int from, Comm comm ) EL_NO_RELEASE_EXCEPT; \
   template T TaggedSendRecv \
   ( T sb, int to, int stag, int from, int rtag, Comm comm ); \
   template T SendRecv( T sb, int to, int from, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void TaggedSendRecv \
-  ( T* buf, int count, int to, int stag, int from, int rtag, Comm comm ) \
+  ( T* buf, Int count, int to, int stag, int from, int rtag, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void SendRecv \
-  ( T* buf, int count, int to, int from, Comm comm ) \
+  ( T* buf, Int count, int to, int from, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
-  template void Broadcast( T* buf, int count, int root, Comm comm ) \
+  template void Broadcast( T* buf, Int count, int root, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void Broadcast( T& b, int root, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
@@ -2942,7 +4549,7 @@ EL_NO_RELEASE_EXCEPT
   template void IBroadcast \
   ( T& b, int root, Comm comm, Request<T>& request ); \
   template void Gather \
-  ( const T* sbuf, int sc, T* rbuf, int rc, int root, Comm comm ) \
+  ( const T* sbuf, Int sc, T* rbuf, Int rc, int root, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void IGather \
   ( const T* sbuf, int sc, \
@@ -2952,22 +4559,28 @@ EL_NO_RELEASE_EXCEPT
   ( const T* sbuf, int sc, \
           T* rbuf, const int* rcs, const int* rds, int root, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
-  template void AllGather( const T* sbuf, int sc, T* rbuf, int rc, Comm comm ) \
+  template void AllGather( const T* sbuf, Int sc, T* rbuf, Int rc, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllGather \
+  ( const T* sbuf, Int sc, T* rbuf, Int rc, Comm comm, \
+    Request<T>& request ); \
   template void AllGather \
   ( const T* sbuf, int sc, \
           T* rbuf, const int* rcs, const int* rds, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void Scatter \
-  ( const T* sbuf, int sc, \
-          T* rbuf, int rc, int root, Comm comm ) \
+  ( const T* sbuf, Int sc, \
+          T* rbuf, Int rc, int root, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
-  template void Scatter( T* buf, int sc, int rc, int root, Comm comm ) \
+  template void Scatter( T* buf, Int sc, Int rc, int root, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void AllToAll \
-  ( const T* sbuf, int sc, \
-          T* rbuf, int rc, Comm comm ) \
+  ( const T* sbuf, Int sc, \
+          T* rbuf, Int rc, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllToAll \
+  ( const T* sbuf, Int sc, T* rbuf, Int rc, Comm comm, \
+    Request<T>& request ); \
   template void AllToAll \
   ( const T* sbuf, const int* scs, const int* sds, \
           T* rbuf, const int* rcs, const int* rds, Comm comm ) \
@@ -2993,18 +4606,23 @@ EL_NO_RELEASE_EXCEPT
   template void Reduce( T* buf, int count, int root, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void AllReduce \
-  ( const T* sbuf, T* rbuf, int count, Op op, Comm comm ) \
+  ( const T* sbuf, T* rbuf, Int count, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
-  template void AllReduce( const T* sbuf, T* rbuf, int count, Comm comm ) \
+  template void AllReduce( const T* sbuf, T* rbuf, Int count, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template T AllReduce( T sb, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template T AllReduce( T sb, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
-  template void AllReduce( T* buf, int count, Op op, Comm comm ) \
+  template void AllReduce( T* buf, Int count, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
-  template void AllReduce( T* buf, int count, Comm comm ) \
+  template void AllReduce( T* buf, Int count, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllReduce \
+  ( const T* sbuf, T* rbuf, Int count, Op op, Comm comm, \
+    Request<T>& request ); \
+  template void IAllReduce \
+  ( T* buf, Int count, Op op, Comm comm, Request<T>& request ); \
   template void ReduceScatter( T* sbuf, T* rbuf, int rc, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void ReduceScatter( T* sbuf, T* rbuf, int rc, Comm comm ) \
@@ -3017,6 +4635,9 @@ EL_NO_RELEASE_EXCEPT
   EL_NO_RELEASE_EXCEPT; \
   template void ReduceScatter( T* buf, int rc, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IReduceScatter \
+  ( const T* sbuf, T* rbuf, Int rc, Op op, Comm comm, \
+    Request<T>& request ); \
   template void ReduceScatter \
   ( const T* sbuf, T* rbuf, const int* rcs, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
@@ -3034,7 +4655,8 @@ EL_NO_RELEASE_EXCEPT
   template void Scan( T* buf, int count, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void Scan( T* buf, int count, Comm comm ) \
-  EL_NO_RELEASE_EXCEPT;
+  EL_NO_RELEASE_EXCEPT; \
+  MPI_PROTO_INT_COUNTS(T)
 
 MPI_PROTO(byte)
 MPI_PROTO(int)
@@ -3101,7 +4723,46 @@ MPI_PROTO(Entry<Complex<BigFloat>>)
           vector<T>& recvBuffer, \
     const vector<int>& recvCounts, \
     const vector<int>& recvDispls, \
-          Comm comm ) EL_NO_RELEASE_EXCEPT;
+          Comm comm ) EL_NO_RELEASE_EXCEPT; \
+  template void SparseAllToAll \
+  ( const vector<T>& sendBuffer, \
+    const vector<int>& sendCounts, \
+    const vector<int>& sendDispls, \
+          vector<T>& recvBuffer, \
+    const vector<int>& recvCounts, \
+    const vector<int>& recvDispls, \
+          Comm comm, AllToAllAlgorithm alg ) EL_NO_RELEASE_EXCEPT; \
+  template void LeaderAllGather \
+  ( const T* sbuf, int sc, T* rbuf, int rc, \
+    const NodeHierarchy& hierarchy ) EL_NO_RELEASE_EXCEPT; \
+  template void LeaderAllGather \
+  ( const T* sbuf, Int sc, T* rbuf, const Int* rcs, const Int* rds, \
+    const NodeHierarchy& hierarchy ) EL_NO_RELEASE_EXCEPT; \
+  template void AllGather \
+  ( const T* sbuf, int sc, T* rbuf, int rc, \
+    const NodeHierarchy& hierarchy ) EL_NO_RELEASE_EXCEPT; \
+  template void AllReduce \
+  ( const T* sbuf, T* rbuf, int count, Op op, \
+    const NodeHierarchy& hierarchy ) EL_NO_RELEASE_EXCEPT; \
+  template void AllReduce \
+  ( T* buf, int count, Op op, const NodeHierarchy& hierarchy ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void ReduceScatter \
+  ( const T* sbuf, T* rbuf, int rc, Op op, \
+    const NodeHierarchy& hierarchy ) EL_NO_RELEASE_EXCEPT; \
+  template void ReduceScatter \
+  ( T* buf, int rc, Op op, const NodeHierarchy& hierarchy ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void AllGather \
+  ( const T* sbuf, Int sc, T* rbuf, Int rc, Comm comm, \
+    TransportPrecision precision ) EL_NO_RELEASE_EXCEPT; \
+  template void AllGather \
+  ( const T* sbuf, Int sc, T* rbuf, Int rc, \
+    const NodeHierarchy& hierarchy, TransportPrecision precision ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void Broadcast \
+  ( T* buf, Int count, int root, Comm comm, TransportPrecision precision ) \
+  EL_NO_RELEASE_EXCEPT;
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
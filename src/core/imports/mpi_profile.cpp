@@ -0,0 +1,391 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <tuple>
+
+namespace El {
+namespace mpi {
+
+bool profilingEnabled = false;
+
+namespace {
+
+// Calls are tallied by the region path, the communicator name, the
+// operation, and the power-of-two bucket of the number of bytes
+struct CallKey
+{
+    string region, comm, op;
+    int bucket;
+};
+bool operator<( const CallKey& a, const CallKey& b )
+{
+    return std::tie(a.region,a.comm,a.op,a.bucket) <
+           std::tie(b.region,b.comm,b.op,b.bucket);
+}
+
+struct CallStats
+{
+    Int count=0;
+    double bytes=0, seconds=0;
+    // Only used for the summary which is reduced over the processes
+    double minSeconds=0, maxSeconds=0;
+    int numRanks=1;
+};
+
+struct TraceEvent
+{
+    const char* name;
+    const char* category;
+    string comm, region;
+    int thread;
+    double start, duration, bytes;
+};
+
+// Beyond this many events, the timeline is truncated (but the calls are
+// still tallied)
+const size_t maxTraceEvents = 1 << 18;
+
+string basename_;
+double origin_ = 0;
+bool haveOrigin_ = false;
+
+// The tallies and the timeline are shared by the threads of the process
+std::mutex profileMutex_;
+std::map<CallKey,CallStats> stats_;
+vector<TraceEvent> trace_;
+Int numDroppedEvents_ = 0;
+
+// Each thread has its own stack of regions, and its events are shown on
+// their own row of the timeline
+std::atomic<int> numThreads_(0);
+thread_local const int thread_ = numThreads_++;
+thread_local vector<const char*> regions_;
+thread_local vector<size_t> regionPathLengths_;
+thread_local vector<double> regionStarts_;
+thread_local string regionPath_;
+
+// A zero-byte call falls into bucket 0, whereas bucket b > 0 holds calls of
+// [2^(b-1),2^b) bytes
+int Bucket( double bytes )
+{
+    if( bytes < 1 )
+        return 0;
+    return 1 + int(std::floor(std::log2(bytes)));
+}
+
+string BucketName( int bucket )
+{
+    if( bucket == 0 )
+        return "0";
+    std::ostringstream os;
+    os << "[" << (Int(1) << (bucket-1)) << "," << (Int(1) << bucket) << ")";
+    return os.str();
+}
+
+string CommName( MPI_Comm comm )
+{
+    if( comm == MPI_COMM_NULL )
+        return "-";
+    char name[MPI_MAX_OBJECT_NAME];
+    int nameLength;
+    PMPI_Comm_get_name( comm, name, &nameLength );
+    if( nameLength > 0 )
+        return string( name, nameLength );
+    int commSize;
+    PMPI_Comm_size( comm, &commSize );
+    return "unnamed(" + std::to_string(commSize) + ")";
+}
+
+// The caller must hold profileMutex_
+void AddEvent
+( const char* name, const char* category, const string& comm,
+  double start, double stop, double bytes )
+{
+    if( trace_.size() < maxTraceEvents )
+        trace_.push_back
+        ( TraceEvent
+          {name,category,comm,regionPath_,thread_,start,stop-start,bytes} );
+    else
+        ++numDroppedEvents_;
+}
+
+string Escape( const string& str )
+{
+    string escaped;
+    for( const char c : str )
+    {
+        if( c == '"' || c == '\\' )
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+void WriteStats
+( std::ostream& os, const vector<std::pair<CallKey,CallStats>>& stats,
+  bool reduced )
+{
+    os << "  \"calls\": [";
+    for( size_t k=0; k<stats.size(); ++k )
+    {
+        const CallKey& key = stats[k].first;
+        const CallStats& value = stats[k].second;
+        os << (k==0 ? "\n" : ",\n")
+           << "    {\"region\": \""
+           << (key.region.empty() ? "(none)" : Escape(key.region)) << "\""
+           << ", \"comm\": \"" << Escape(key.comm) << "\""
+           << ", \"op\": \"" << key.op << "\""
+           << ", \"bytesBucket\": \"" << BucketName(key.bucket) << "\""
+           << ", \"count\": " << value.count
+           << ", \"bytes\": " << value.bytes
+           << ", \"seconds\": " << value.seconds;
+        if( reduced )
+            os << ", \"minSeconds\": " << value.minSeconds
+               << ", \"maxSeconds\": " << value.maxSeconds
+               << ", \"numRanks\": " << value.numRanks;
+        os << "}";
+    }
+    os << "\n  ]\n";
+}
+
+// Sort the most expensive entries to the front
+vector<std::pair<CallKey,CallStats>>
+SortedStats( const std::map<CallKey,CallStats>& stats, bool reduced )
+{
+    vector<std::pair<CallKey,CallStats>> sorted( stats.begin(), stats.end() );
+    std::stable_sort
+    ( sorted.begin(), sorted.end(),
+      [&]( const std::pair<CallKey,CallStats>& a,
+           const std::pair<CallKey,CallStats>& b )
+      { return reduced ? a.second.maxSeconds > b.second.maxSeconds
+                       : a.second.seconds > b.second.seconds; } );
+    return sorted;
+}
+
+void WriteRankProfile( const string& basename, int rank )
+{
+    std::lock_guard<std::mutex> lock( profileMutex_ );
+    const string prefix = basename + "." + std::to_string(rank);
+
+    std::ofstream summary( prefix+".json" );
+    if( !summary.is_open() )
+        RuntimeError("Could not open ",prefix,".json");
+    summary.precision( 10 );
+    summary << "{\n"
+            << "  \"rank\": " << rank << ",\n"
+            << "  \"droppedTraceEvents\": " << numDroppedEvents_ << ",\n";
+    WriteStats( summary, SortedStats(stats_,false), false );
+    summary << "}\n";
+
+    // The Chrome trace event format measures time in microseconds
+    std::ofstream trace( prefix+".trace.json" );
+    if( !trace.is_open() )
+        RuntimeError("Could not open ",prefix,".trace.json");
+    trace.precision( 15 );
+    trace << "{\"traceEvents\": [\n"
+          << "  {\"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << rank
+          << ", \"args\": {\"name\": \"rank " << rank << "\"}}";
+    for( const auto& event : trace_ )
+    {
+        trace << ",\n  {\"name\": \"" << event.name << "\""
+              << ", \"cat\": \"" << event.category << "\""
+              << ", \"ph\": \"X\", \"pid\": " << rank
+              << ", \"tid\": " << event.thread
+              << ", \"ts\": " << 1.e6*(event.start-origin_)
+              << ", \"dur\": " << 1.e6*event.duration
+              << ", \"args\": {\"region\": \"" << Escape(event.region) << "\"";
+        if( std::strcmp( event.category, "mpi" ) == 0 )
+            trace << ", \"comm\": \"" << Escape(event.comm) << "\""
+                  << ", \"bytes\": " << event.bytes;
+        trace << "}}";
+    }
+    trace << "\n], \"displayTimeUnit\": \"ms\"}\n";
+}
+
+string SerializeStats()
+{
+    std::lock_guard<std::mutex> lock( profileMutex_ );
+    std::ostringstream os;
+    os.precision( 17 );
+    for( const auto& entry : stats_ )
+        os << entry.first.region << '\t' << entry.first.comm << '\t'
+           << entry.first.op << '\t' << entry.first.bucket << '\t'
+           << entry.second.count << '\t' << entry.second.bytes << '\t'
+           << entry.second.seconds << '\n';
+    return os.str();
+}
+
+void MergeStats
+( const string& serialized, std::map<CallKey,CallStats>& reduced )
+{
+    std::istringstream is( serialized );
+    string line;
+    while( std::getline( is, line ) )
+    {
+        std::istringstream lineStream( line );
+        CallKey key;
+        CallStats value;
+        std::getline( lineStream, key.region, '\t' );
+        std::getline( lineStream, key.comm, '\t' );
+        std::getline( lineStream, key.op, '\t' );
+        lineStream >> key.bucket >> value.count >> value.bytes
+                   >> value.seconds;
+        auto it = reduced.find( key );
+        if( it == reduced.end() )
+        {
+            value.minSeconds = value.maxSeconds = value.seconds;
+            reduced[key] = value;
+        }
+        else
+        {
+            CallStats& total = it->second;
+            total.count += value.count;
+            total.bytes += value.bytes;
+            total.seconds += value.seconds;
+            total.minSeconds = Min( total.minSeconds, value.seconds );
+            total.maxSeconds = Max( total.maxSeconds, value.seconds );
+            ++total.numRanks;
+        }
+    }
+}
+
+} // anonymous namespace
+
+void EnableProfiling( const string& basename )
+{
+    basename_ = basename;
+    if( !haveOrigin_ )
+    {
+        origin_ = Time();
+        haveOrigin_ = true;
+    }
+    profilingEnabled = true;
+}
+
+void DisableProfiling() EL_NO_EXCEPT
+{ profilingEnabled = false; }
+
+const string& ProfileBasename() EL_NO_EXCEPT
+{ return basename_; }
+
+void ClearProfile()
+{
+    std::lock_guard<std::mutex> lock( profileMutex_ );
+    stats_.clear();
+    trace_.clear();
+    numDroppedEvents_ = 0;
+    origin_ = Time();
+    haveOrigin_ = true;
+}
+
+void RecordCall
+( const char* op, MPI_Comm comm, double bytes, double start, double stop )
+EL_NO_EXCEPT
+{
+    if( !profilingEnabled )
+        return;
+    const string commName = CommName( comm );
+    std::lock_guard<std::mutex> lock( profileMutex_ );
+    CallStats& stats = stats_[CallKey{regionPath_,commName,op,Bucket(bytes)}];
+    ++stats.count;
+    stats.bytes += bytes;
+    stats.seconds += stop - start;
+    AddEvent( op, "mpi", commName, start, stop, bytes );
+}
+
+void ProfileRegion::Push( const char* name ) EL_NO_EXCEPT
+{
+    // A region which directly re-enters itself (e.g., an overload which
+    // forwards to another) does not lengthen the path
+    const bool reentered =
+      !regions_.empty() && std::strcmp( regions_.back(), name ) == 0;
+    regions_.push_back( name );
+    regionPathLengths_.push_back( regionPath_.size() );
+    regionStarts_.push_back( Time() );
+    if( reentered )
+        return;
+    if( !regionPath_.empty() )
+        regionPath_ += '/';
+    regionPath_ += name;
+}
+
+void ProfileRegion::Pop() EL_NO_EXCEPT
+{
+    // The profile may have been cleared or written while within the region
+    if( regions_.empty() )
+        return;
+    const char* name = regions_.back();
+    const double start = regionStarts_.back();
+    const double stop = Time();
+    if( profilingEnabled )
+    {
+        std::lock_guard<std::mutex> lock( profileMutex_ );
+        AddEvent( name, "region", "", start, stop, 0 );
+    }
+    regionPath_.resize( regionPathLengths_.back() );
+    regions_.pop_back();
+    regionPathLengths_.pop_back();
+    regionStarts_.pop_back();
+}
+
+void WriteProfile( const string& basename )
+{
+    EL_DEBUG_CSE
+    // Do not profile the communication needed to write the profile
+    const bool wasEnabled = profilingEnabled;
+    profilingEnabled = false;
+
+    const int commRank = Rank( COMM_WORLD );
+    const int commSize = Size( COMM_WORLD );
+    WriteRankProfile( basename, commRank );
+
+    const string serialized = SerializeStats();
+    const int localSize = serialized.size();
+    vector<int> sizes( commSize ), offsets( commSize );
+    Gather( &localSize, 1, sizes.data(), 1, 0, COMM_WORLD );
+    int totalSize = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        offsets[q] = totalSize;
+        totalSize += sizes[q];
+    }
+    vector<byte> gathered( Max(totalSize,1) );
+    Gather
+    ( reinterpret_cast<const byte*>(serialized.data()), localSize,
+      gathered.data(), sizes.data(), offsets.data(), 0, COMM_WORLD );
+
+    if( commRank == 0 )
+    {
+        std::map<CallKey,CallStats> reduced;
+        for( int q=0; q<commSize; ++q )
+            MergeStats
+            ( string
+              ( reinterpret_cast<const char*>(&gathered[offsets[q]]),
+                sizes[q] ), reduced );
+
+        std::ofstream summary( basename+".json" );
+        if( !summary.is_open() )
+            RuntimeError("Could not open ",basename,".json");
+        summary.precision( 10 );
+        summary << "{\n"
+                << "  \"numRanks\": " << commSize << ",\n";
+        WriteStats( summary, SortedStats(reduced,true), true );
+        summary << "}\n";
+    }
+
+    profilingEnabled = wasEnabled;
+}
+
+} // namespace mpi
+} // namespace El
@@ -0,0 +1,515 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IMPORTS_MPI_PROFILE_HPP
+#define EL_IMPORTS_MPI_PROFILE_HPP
+
+// Shims around the MPI routines which communicate, which are substituted for
+// them (via the macros at the bottom of this file) within the translation
+// unit of the MPI wrappers. Each shim directly calls the PMPI routine when
+// profiling is disabled, so that the only cost is a single branch; otherwise
+// the call is timed and recorded along with the number of bytes that the
+// calling process contributes to and obtains from it.
+//
+// Only mpi.cpp should include this file.
+
+namespace El {
+namespace mpi {
+namespace profile {
+
+inline double TypeBytes( int count, MPI_Datatype type ) EL_NO_EXCEPT
+{
+    // The size of the derived datatypes describing large messages may not
+    // fit in an int
+    MPI_Count typeSize;
+    PMPI_Type_size_x( type, &typeSize );
+    return double(count)*typeSize;
+}
+
+inline double TypeBytes
+( const int* counts, int numCounts, MPI_Datatype type ) EL_NO_EXCEPT
+{
+    double totalCount = 0;
+    for( int q=0; q<numCounts; ++q )
+        totalCount += counts[q];
+    return TypeBytes( 1, type )*totalCount;
+}
+
+inline int CommSize( MPI_Comm comm ) EL_NO_EXCEPT
+{
+    int commSize;
+    PMPI_Comm_size( comm, &commSize );
+    return commSize;
+}
+
+inline bool IsRoot( int root, MPI_Comm comm ) EL_NO_EXCEPT
+{
+    int commRank;
+    PMPI_Comm_rank( comm, &commRank );
+    return commRank == root;
+}
+
+inline bool InPlace( const void* buf ) EL_NO_EXCEPT
+{ return buf == MPI_IN_PLACE; }
+
+template<typename BytesFunc,typename CallFunc>
+inline int Timed
+( const char* op, MPI_Comm comm, BytesFunc bytes, CallFunc call )
+EL_NO_EXCEPT
+{
+    if( !Profiling() )
+        return call();
+    const double start = PMPI_Wtime();
+    const int error = call();
+    const double stop = PMPI_Wtime();
+    RecordCall( op, comm, bytes(), start, stop );
+    return error;
+}
+
+// Point-to-point
+// ==============
+inline int Send
+( const void* buf, int count, MPI_Datatype type, int to, int tag,
+  MPI_Comm comm ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Send", comm, [&]() { return TypeBytes(count,type); },
+      [&]()
+      { return PMPI_Send
+        ( const_cast<void*>(buf), count, type, to, tag, comm ); } );
+}
+
+inline int Isend
+( const void* buf, int count, MPI_Datatype type, int to, int tag,
+  MPI_Comm comm, MPI_Request* request ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Isend", comm, [&]() { return TypeBytes(count,type); },
+      [&]()
+      { return PMPI_Isend
+        ( const_cast<void*>(buf), count, type, to, tag, comm, request ); } );
+}
+
+inline int Irsend
+( const void* buf, int count, MPI_Datatype type, int to, int tag,
+  MPI_Comm comm, MPI_Request* request ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Irsend", comm, [&]() { return TypeBytes(count,type); },
+      [&]()
+      { return PMPI_Irsend
+        ( const_cast<void*>(buf), count, type, to, tag, comm, request ); } );
+}
+
+inline int Issend
+( const void* buf, int count, MPI_Datatype type, int to, int tag,
+  MPI_Comm comm, MPI_Request* request ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Issend", comm, [&]() { return TypeBytes(count,type); },
+      [&]()
+      { return PMPI_Issend
+        ( const_cast<void*>(buf), count, type, to, tag, comm, request ); } );
+}
+
+// The receive counts are upper bounds on the amount of data received
+inline int Recv
+( void* buf, int count, MPI_Datatype type, int from, int tag,
+  MPI_Comm comm, MPI_Status* status ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Recv", comm, [&]() { return TypeBytes(count,type); },
+      [&]()
+      { return PMPI_Recv( buf, count, type, from, tag, comm, status ); } );
+}
+
+inline int Irecv
+( void* buf, int count, MPI_Datatype type, int from, int tag,
+  MPI_Comm comm, MPI_Request* request ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Irecv", comm, [&]() { return TypeBytes(count,type); },
+      [&]()
+      { return PMPI_Irecv( buf, count, type, from, tag, comm, request ); } );
+}
+
+inline int Sendrecv
+( const void* sbuf, int sc, MPI_Datatype stype, int to, int stag,
+        void* rbuf, int rc, MPI_Datatype rtype, int from, int rtag,
+  MPI_Comm comm, MPI_Status* status ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Sendrecv", comm,
+      [&]() { return TypeBytes(sc,stype) + TypeBytes(rc,rtype); },
+      [&]()
+      { return PMPI_Sendrecv
+        ( const_cast<void*>(sbuf), sc, stype, to, stag,
+          rbuf, rc, rtype, from, rtag, comm, status ); } );
+}
+
+inline int Sendrecv_replace
+( void* buf, int count, MPI_Datatype type, int to, int stag,
+  int from, int rtag, MPI_Comm comm, MPI_Status* status ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Sendrecv_replace", comm, [&]() { return 2*TypeBytes(count,type); },
+      [&]()
+      { return PMPI_Sendrecv_replace
+        ( buf, count, type, to, stag, from, rtag, comm, status ); } );
+}
+
+// Completion routines (which are not associated with a communicator)
+inline int Wait( MPI_Request* request, MPI_Status* status ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Wait", MPI_COMM_NULL, []() { return 0.; },
+      [&]() { return PMPI_Wait( request, status ); } );
+}
+
+inline int Waitall
+( int numRequests, MPI_Request* requests, MPI_Status* statuses )
+EL_NO_EXCEPT
+{
+    return Timed
+    ( "Waitall", MPI_COMM_NULL, []() { return 0.; },
+      [&]() { return PMPI_Waitall( numRequests, requests, statuses ); } );
+}
+
+inline int Test( MPI_Request* request, int* flag, MPI_Status* status )
+EL_NO_EXCEPT
+{
+    return Timed
+    ( "Test", MPI_COMM_NULL, []() { return 0.; },
+      [&]() { return PMPI_Test( request, flag, status ); } );
+}
+
+// Collectives
+// ===========
+inline int Barrier( MPI_Comm comm ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Barrier", comm, []() { return 0.; },
+      [&]() { return PMPI_Barrier( comm ); } );
+}
+
+inline int Bcast
+( void* buf, int count, MPI_Datatype type, int root, MPI_Comm comm )
+EL_NO_EXCEPT
+{
+    return Timed
+    ( "Bcast", comm, [&]() { return TypeBytes(count,type); },
+      [&]() { return PMPI_Bcast( buf, count, type, root, comm ); } );
+}
+
+inline int Gather
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, int root, MPI_Comm comm )
+EL_NO_EXCEPT
+{
+    return Timed
+    ( "Gather", comm,
+      [&]()
+      { const bool isRoot = IsRoot( root, comm );
+        return ( InPlace(sbuf) ? 0. : TypeBytes(sc,stype) ) +
+               ( isRoot ? TypeBytes(rc,rtype)*CommSize(comm) : 0. ); },
+      [&]()
+      { return PMPI_Gather
+        ( const_cast<void*>(sbuf), sc, stype, rbuf, rc, rtype, root,
+          comm ); } );
+}
+
+inline int Gatherv
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, const int* rcs, const int* rds, MPI_Datatype rtype,
+  int root, MPI_Comm comm ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Gatherv", comm,
+      [&]()
+      { const bool isRoot = IsRoot( root, comm );
+        return ( InPlace(sbuf) ? 0. : TypeBytes(sc,stype) ) +
+               ( isRoot ? TypeBytes(rcs,CommSize(comm),rtype) : 0. ); },
+      [&]()
+      { return PMPI_Gatherv
+        ( const_cast<void*>(sbuf), sc, stype,
+          rbuf, const_cast<int*>(rcs), const_cast<int*>(rds), rtype,
+          root, comm ); } );
+}
+
+inline int Allgather
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, MPI_Comm comm )
+EL_NO_EXCEPT
+{
+    return Timed
+    ( "Allgather", comm,
+      [&]()
+      { return ( InPlace(sbuf) ? 0. : TypeBytes(sc,stype) ) +
+               TypeBytes(rc,rtype)*CommSize(comm); },
+      [&]()
+      { return PMPI_Allgather
+        ( const_cast<void*>(sbuf), sc, stype, rbuf, rc, rtype, comm ); } );
+}
+
+inline int Allgatherv
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, const int* rcs, const int* rds, MPI_Datatype rtype,
+  MPI_Comm comm ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Allgatherv", comm,
+      [&]()
+      { return ( InPlace(sbuf) ? 0. : TypeBytes(sc,stype) ) +
+               TypeBytes(rcs,CommSize(comm),rtype); },
+      [&]()
+      { return PMPI_Allgatherv
+        ( const_cast<void*>(sbuf), sc, stype,
+          rbuf, const_cast<int*>(rcs), const_cast<int*>(rds), rtype,
+          comm ); } );
+}
+
+inline int Scatter
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, int root, MPI_Comm comm )
+EL_NO_EXCEPT
+{
+    return Timed
+    ( "Scatter", comm,
+      [&]()
+      { const bool isRoot = IsRoot( root, comm );
+        return ( isRoot ? TypeBytes(sc,stype)*CommSize(comm) : 0. ) +
+               ( InPlace(rbuf) ? 0. : TypeBytes(rc,rtype) ); },
+      [&]()
+      { return PMPI_Scatter
+        ( const_cast<void*>(sbuf), sc, stype, rbuf, rc, rtype, root,
+          comm ); } );
+}
+
+inline int Alltoall
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, MPI_Comm comm )
+EL_NO_EXCEPT
+{
+    return Timed
+    ( "Alltoall", comm,
+      [&]()
+      { return ( TypeBytes(sc,stype) + TypeBytes(rc,rtype) )*
+               CommSize(comm); },
+      [&]()
+      { return PMPI_Alltoall
+        ( const_cast<void*>(sbuf), sc, stype, rbuf, rc, rtype, comm ); } );
+}
+
+inline int Alltoallv
+( const void* sbuf, const int* scs, const int* sds, MPI_Datatype stype,
+        void* rbuf, const int* rcs, const int* rds, MPI_Datatype rtype,
+  MPI_Comm comm ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Alltoallv", comm,
+      [&]()
+      { const int commSize = CommSize( comm );
+        return TypeBytes(scs,commSize,stype) +
+               TypeBytes(rcs,commSize,rtype); },
+      [&]()
+      { return PMPI_Alltoallv
+        ( const_cast<void*>(sbuf),
+          const_cast<int*>(scs), const_cast<int*>(sds), stype,
+          rbuf, const_cast<int*>(rcs), const_cast<int*>(rds), rtype,
+          comm ); } );
+}
+
+inline int Reduce
+( const void* sbuf, void* rbuf, int count, MPI_Datatype type, MPI_Op op,
+  int root, MPI_Comm comm ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Reduce", comm,
+      [&]()
+      { return TypeBytes(count,type)*( IsRoot(root,comm) ? 2 : 1 ); },
+      [&]()
+      { return PMPI_Reduce
+        ( const_cast<void*>(sbuf), rbuf, count, type, op, root,
+          comm ); } );
+}
+
+inline int Allreduce
+( const void* sbuf, void* rbuf, int count, MPI_Datatype type, MPI_Op op,
+  MPI_Comm comm ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Allreduce", comm, [&]() { return 2*TypeBytes(count,type); },
+      [&]()
+      { return PMPI_Allreduce
+        ( const_cast<void*>(sbuf), rbuf, count, type, op, comm ); } );
+}
+
+inline int Reduce_scatter
+( const void* sbuf, void* rbuf, const int* rcs, MPI_Datatype type,
+  MPI_Op op, MPI_Comm comm ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Reduce_scatter", comm,
+      [&]()
+      { int commRank;
+        PMPI_Comm_rank( comm, &commRank );
+        return TypeBytes(rcs,CommSize(comm),type) +
+               TypeBytes(rcs[commRank],type); },
+      [&]()
+      { return PMPI_Reduce_scatter
+        ( const_cast<void*>(sbuf), rbuf, const_cast<int*>(rcs), type, op,
+          comm ); } );
+}
+
+inline int Scan
+( const void* sbuf, void* rbuf, int count, MPI_Datatype type, MPI_Op op,
+  MPI_Comm comm ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Scan", comm, [&]() { return 2*TypeBytes(count,type); },
+      [&]()
+      { return PMPI_Scan
+        ( const_cast<void*>(sbuf), rbuf, count, type, op, comm ); } );
+}
+
+#ifdef EL_HAVE_MPI_REDUCE_SCATTER_BLOCK
+inline int Reduce_scatter_block
+( const void* sbuf, void* rbuf, int rc, MPI_Datatype type, MPI_Op op,
+  MPI_Comm comm ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Reduce_scatter_block", comm,
+      [&]() { return TypeBytes(rc,type)*(CommSize(comm)+1); },
+      [&]()
+      { return PMPI_Reduce_scatter_block
+        ( const_cast<void*>(sbuf), rbuf, rc, type, op, comm ); } );
+}
+#endif
+
+#ifdef EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES
+inline int Ibcast
+( void* buf, int count, MPI_Datatype type, int root, MPI_Comm comm,
+  MPI_Request* request ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Ibcast", comm, [&]() { return TypeBytes(count,type); },
+      [&]()
+      { return PMPI_Ibcast( buf, count, type, root, comm, request ); } );
+}
+
+inline int Igather
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, int root, MPI_Comm comm,
+  MPI_Request* request ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Igather", comm,
+      [&]()
+      { const bool isRoot = IsRoot( root, comm );
+        return ( InPlace(sbuf) ? 0. : TypeBytes(sc,stype) ) +
+               ( isRoot ? TypeBytes(rc,rtype)*CommSize(comm) : 0. ); },
+      [&]()
+      { return PMPI_Igather
+        ( sbuf, sc, stype, rbuf, rc, rtype, root, comm, request ); } );
+}
+
+inline int Iallgather
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, MPI_Comm comm,
+  MPI_Request* request ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Iallgather", comm,
+      [&]()
+      { return ( InPlace(sbuf) ? 0. : TypeBytes(sc,stype) ) +
+               TypeBytes(rc,rtype)*CommSize(comm); },
+      [&]()
+      { return PMPI_Iallgather
+        ( sbuf, sc, stype, rbuf, rc, rtype, comm, request ); } );
+}
+
+inline int Ialltoall
+( const void* sbuf, int sc, MPI_Datatype stype,
+        void* rbuf, int rc, MPI_Datatype rtype, MPI_Comm comm,
+  MPI_Request* request ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Ialltoall", comm,
+      [&]()
+      { return ( TypeBytes(sc,stype) + TypeBytes(rc,rtype) )*
+               CommSize(comm); },
+      [&]()
+      { return PMPI_Ialltoall
+        ( sbuf, sc, stype, rbuf, rc, rtype, comm, request ); } );
+}
+
+inline int Iallreduce
+( const void* sbuf, void* rbuf, int count, MPI_Datatype type, MPI_Op op,
+  MPI_Comm comm, MPI_Request* request ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Iallreduce", comm, [&]() { return 2*TypeBytes(count,type); },
+      [&]()
+      { return PMPI_Iallreduce
+        ( sbuf, rbuf, count, type, op, comm, request ); } );
+}
+
+inline int Ireduce_scatter_block
+( const void* sbuf, void* rbuf, int rc, MPI_Datatype type, MPI_Op op,
+  MPI_Comm comm, MPI_Request* request ) EL_NO_EXCEPT
+{
+    return Timed
+    ( "Ireduce_scatter_block", comm,
+      [&]() { return TypeBytes(rc,type)*(CommSize(comm)+1); },
+      [&]()
+      { return PMPI_Ireduce_scatter_block
+        ( sbuf, rbuf, rc, type, op, comm, request ); } );
+}
+#endif
+
+} // namespace profile
+} // namespace mpi
+} // namespace El
+
+#define MPI_Send El::mpi::profile::Send
+#define MPI_Isend El::mpi::profile::Isend
+#define MPI_Irsend El::mpi::profile::Irsend
+#define MPI_Issend El::mpi::profile::Issend
+#define MPI_Recv El::mpi::profile::Recv
+#define MPI_Irecv El::mpi::profile::Irecv
+#define MPI_Sendrecv El::mpi::profile::Sendrecv
+#define MPI_Sendrecv_replace El::mpi::profile::Sendrecv_replace
+#define MPI_Wait El::mpi::profile::Wait
+#define MPI_Waitall El::mpi::profile::Waitall
+#define MPI_Test El::mpi::profile::Test
+#define MPI_Barrier El::mpi::profile::Barrier
+#define MPI_Bcast El::mpi::profile::Bcast
+#define MPI_Gather El::mpi::profile::Gather
+#define MPI_Gatherv El::mpi::profile::Gatherv
+#define MPI_Allgather El::mpi::profile::Allgather
+#define MPI_Allgatherv El::mpi::profile::Allgatherv
+#define MPI_Scatter El::mpi::profile::Scatter
+#define MPI_Alltoall El::mpi::profile::Alltoall
+#define MPI_Alltoallv El::mpi::profile::Alltoallv
+#define MPI_Reduce El::mpi::profile::Reduce
+#define MPI_Allreduce El::mpi::profile::Allreduce
+#define MPI_Reduce_scatter El::mpi::profile::Reduce_scatter
+#define MPI_Scan El::mpi::profile::Scan
+#ifdef EL_HAVE_MPI_REDUCE_SCATTER_BLOCK
+# define MPI_Reduce_scatter_block El::mpi::profile::Reduce_scatter_block
+#endif
+#ifdef EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES
+# define MPI_Ibcast El::mpi::profile::Ibcast
+# define MPI_Igather El::mpi::profile::Igather
+# define MPI_Iallgather El::mpi::profile::Iallgather
+# define MPI_Ialltoall El::mpi::profile::Ialltoall
+# define MPI_Iallreduce El::mpi::profile::Iallreduce
+# define MPI_Ireduce_scatter_block El::mpi::profile::Ireduce_scatter_block
+#endif
+
+#endif // ifndef EL_IMPORTS_MPI_PROFILE_HPP
@@ -124,6 +124,56 @@ Orientation CharToOrientation( char c )
 
 } // namespace OrientationNS
 
+namespace GemmAlgorithmNS {
+
+std::string GemmAlgorithmToString( GemmAlgorithm alg )
+{
+    std::string algString;
+    switch( alg )
+    {
+        case GEMM_DEFAULT:           algString = "DEFAULT";          break;
+        case GEMM_SUMMA_A:           algString = "SUMMA_A";          break;
+        case GEMM_SUMMA_B:           algString = "SUMMA_B";          break;
+        case GEMM_SUMMA_C:           algString = "SUMMA_C";          break;
+        case GEMM_SUMMA_DOT:         algString = "SUMMA_DOT";        break;
+        case GEMM_CANNON:            algString = "CANNON";           break;
+        case GEMM_SUMMA_C_LOOKAHEAD: algString = "SUMMA_C_LOOKAHEAD"; break;
+        case GEMM_2_5D:              algString = "2_5D";             break;
+        default:                     algString = "3D";               break;
+    }
+    return algString;
+}
+
+GemmAlgorithm StringToGemmAlgorithm( std::string s )
+{
+    // Most compilers' logic for detecting potentially uninitialized variables
+    // is horrendously bad.
+    GemmAlgorithm alg=GEMM_DEFAULT;
+    if( s == "DEFAULT" )
+        alg = GEMM_DEFAULT;
+    else if( s == "SUMMA_A" )
+        alg = GEMM_SUMMA_A;
+    else if( s == "SUMMA_B" )
+        alg = GEMM_SUMMA_B;
+    else if( s == "SUMMA_C" )
+        alg = GEMM_SUMMA_C;
+    else if( s == "SUMMA_DOT" )
+        alg = GEMM_SUMMA_DOT;
+    else if( s == "CANNON" )
+        alg = GEMM_CANNON;
+    else if( s == "SUMMA_C_LOOKAHEAD" )
+        alg = GEMM_SUMMA_C_LOOKAHEAD;
+    else if( s == "2_5D" )
+        alg = GEMM_2_5D;
+    else if( s == "3D" )
+        alg = GEMM_3D;
+    else
+        LogicError("StringToGemmAlgorithm does not recognize \"",s,"\"");
+    return alg;
+}
+
+} // namespace GemmAlgorithmNS
+
 namespace UnitOrNonUnitNS {
 
 char UnitOrNonUnitToChar( UnitOrNonUnit diag )
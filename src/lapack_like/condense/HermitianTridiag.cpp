@@ -111,7 +111,8 @@ void HermitianTridiag
         ( owningGroup, squareRanks.size(), squareRanks.data(), squareGroup );
 
         mpi::Comm viewingComm = grid.ViewingComm();
-        const Grid squareGrid( viewingComm, squareGroup, pSqrt );
+        const Grid& squareGrid =
+          Grid::Cached( viewingComm, squareGroup, pSqrt );
         DistMatrix<F> ASquare(squareGrid);
         DistMatrix<F,STAR,STAR> householderScalarsSquare(squareGrid);
 
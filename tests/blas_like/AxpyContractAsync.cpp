@@ -0,0 +1,75 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Start B += alpha Contract(A) asynchronously, perform some unrelated local
+// work while polling, and compare against the blocking AxpyContract (up to
+// the rounding of a possibly different order of summation)
+template<typename T,Dist U,Dist V,Dist X,Dist Y>
+void TestAxpyContractAsync( Int m, Int n, const Grid& g )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing [",DistToString(U),",",DistToString(V),"] -> [",
+     DistToString(X),",",DistToString(Y),"] with ",TypeName<T>());
+    const T alpha = T(3);
+
+    DistMatrix<T,U,V> A(g);
+    DistMatrix<T,X,Y> B(g), BRef(g);
+    A.AlignWith( B.DistData() );
+    Uniform( A, m, n );
+    Uniform( B, m, n );
+    BRef = B;
+    AxpyContract( alpha, A, BRef );
+
+    Matrix<T> C, D;
+    Uniform( C, 100, 100 );
+    auto handle = AxpyContractAsync( alpha, A, B );
+    Int numPolls = 0;
+    while( !handle.Test() )
+    {
+        Gemm( NORMAL, NORMAL, T(1), C, C, D );
+        ++numPolls;
+    }
+    if( !handle.Completed() )
+        LogicError("Handle was not marked as completed");
+
+    const Base<T> refNorm = FrobeniusNorm( BRef );
+    BRef -= B;
+    const Base<T> errorNorm = FrobeniusNorm( BRef );
+    if( errorNorm > 10*g.Size()*limits::Epsilon<Base<T>>()*refNorm )
+        LogicError("Asynchronous contraction error norm was ",errorNorm);
+    OutputFromRoot(g.Comm(),"passed after ",numPolls," polls");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",100);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+
+        TestAxpyContractAsync<double,MC,STAR,MC,MR>( m, n, g );
+        TestAxpyContractAsync<float,STAR,MR,MC,MR>( m, n, g );
+        TestAxpyContractAsync<Complex<double>,MC,STAR,MC,MR>( m, n, g );
+        TestAxpyContractAsync<double,VC,STAR,VC,STAR>( m, n, g );
+        // Falls back to the blocking contraction
+        TestAxpyContractAsync<double,STAR,STAR,MC,MR>( m, n, g );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
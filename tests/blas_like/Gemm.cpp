@@ -141,6 +141,50 @@ void TestGemm
             (orientA, orientB, alpha, A, B, beta, COrig, C, print);
     PopIndent();
 
+    // Test the variant of Gemm that keeps C stationary and overlaps the
+    // communication of each panel with the update from the previous one
+    C = COrig;
+    OutputFromRoot(g.Comm(),"Stationary C Algorithm with look-ahead:");
+    PushIndent();
+    mpi::Barrier(g.Comm());
+    timer.Start();
+    Gemm(orientA, orientB, alpha, A, B, beta, C, GEMM_SUMMA_C_LOOKAHEAD);
+    mpi::Barrier(g.Comm());
+    runTime = timer.Stop();
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = (IsComplex<T>::value ? 4*realGFlops : realGFlops);
+    OutputFromRoot
+        (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if (print)
+        Print(C, BuildString("C := ",alpha," A B + ",beta," C"));
+    if (correctness)
+        TestAssociativity
+            (orientA, orientB, alpha, A, B, beta, COrig, C, print);
+    PopIndent();
+
+    if (D == Device::CPU)
+    {
+        // Test Cannon's algorithm (over the square sub-grids of the grid)
+        C = COrig;
+        OutputFromRoot(g.Comm(),"Cannon's Algorithm:");
+        PushIndent();
+        mpi::Barrier(g.Comm());
+        timer.Start();
+        Gemm(orientA, orientB, alpha, A, B, beta, C, GEMM_CANNON);
+        mpi::Barrier(g.Comm());
+        runTime = timer.Stop();
+        realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+        gFlops = (IsComplex<T>::value ? 4*realGFlops : realGFlops);
+        OutputFromRoot
+            (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+        if (print)
+            Print(C, BuildString("C := ",alpha," A B + ",beta," C"));
+        if (correctness)
+            TestAssociativity
+                (orientA, orientB, alpha, A, B, beta, COrig, C, print);
+        PopIndent();
+    }
+
     if (orientA == NORMAL && orientB == NORMAL)
     {
         // Test the variant of Gemm for panel-panel dot products
@@ -0,0 +1,113 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare a layered product against SUMMA_C (the layers only change how the
+// inner dimension is split, so the results agree up to rounding)
+template<typename T>
+void TestLayered
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  GemmAlgorithm alg, int numLayers, const Grid& g )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing ",OrientationToChar(orientA),
+     OrientationToChar(orientB)," ",GemmAlgorithmToString(alg),
+     " with ",numLayers," layers and ",TypeName<T>());
+    DistMatrix<T> A(g), B(g), C(g), CRef(g);
+    if( orientA == NORMAL )
+        Uniform( A, m, k );
+    else
+        Uniform( A, k, m );
+    if( orientB == NORMAL )
+        Uniform( B, k, n );
+    else
+        Uniform( B, n, k );
+    Uniform( C, m, n );
+    CRef = C;
+
+    const T alpha = T(3), beta = T(-2);
+    Gemm( orientA, orientB, alpha, A, B, beta, C, alg, numLayers );
+    Gemm( orientA, orientB, alpha, A, B, beta, CRef, GEMM_SUMMA_C );
+    const Base<T> refNorm = FrobeniusNorm( CRef );
+    CRef -= C;
+    if( FrobeniusNorm(CRef) > 100*k*limits::Epsilon<Base<T>>()*refNorm )
+        LogicError("The layered product was incorrect");
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+void TestLayers( const Grid& g, int numLayers )
+{
+    const int layerSize = g.Size() / numLayers;
+    for( int layer=0; layer<numLayers; ++layer )
+        if( g.LayerGrid(numLayers,layer).Size() != layerSize )
+            LogicError("Layer ",layer," had the wrong size");
+    if( g.InGrid() )
+    {
+        const int layer = g.Layer( numLayers );
+        if( layer != g.VCRank() / layerSize )
+            LogicError("Wrong layer for VC rank ",g.VCRank());
+        if( g.OwnLayerGrid(numLayers).Size() != layerSize ||
+            g.OwnLayerGrid(numLayers).MCRank() !=
+            g.LayerGrid(numLayers,layer).MCRank() ||
+            g.OwnLayerGrid(numLayers).MRRank() !=
+            g.LayerGrid(numLayers,layer).MRRank() )
+            LogicError("The grids of our layer disagreed");
+        if( mpi::Size(g.DepthComm(numLayers)) != numLayers ||
+            mpi::Rank(g.DepthComm(numLayers)) != layer )
+            LogicError("The depth communicator was incorrect");
+    }
+}
+
+template<typename T>
+void TestOrientations( Int m, Int n, Int k, const Grid& g )
+{
+    const Orientation orients[] = { NORMAL, TRANSPOSE, ADJOINT };
+    for( const Orientation orientA : orients )
+        for( const Orientation orientB : orients )
+        {
+            if( IsComplex<T>::value ||
+                (orientA != ADJOINT && orientB != ADJOINT) )
+            {
+                TestLayered<T>( orientA, orientB, m, n, k, GEMM_3D, 0, g );
+                for( int numLayers=1; numLayers<=g.Size(); ++numLayers )
+                    if( g.Size() % numLayers == 0 && numLayers <= 4 )
+                        TestLayered<T>
+                        ( orientA, orientB, m, n, k, GEMM_2_5D, numLayers,
+                          g );
+            }
+        }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height of C",100);
+        const Int n = Input("--n","width of C",80);
+        const Int k = Input("--k","inner dimension",90);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        for( int numLayers=1; numLayers<=g.Size(); ++numLayers )
+            if( g.Size() % numLayers == 0 )
+                TestLayers( g, numLayers );
+        OutputFromRoot(comm,"Layers passed");
+
+        TestOrientations<double>( m, n, k, g );
+        TestOrientations<Complex<double>>( m, n, k, g );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Autotune a class of Gemms on first encounter, check the product against a
+// fixed variant, and check that the tuning survives a save and load
+template<typename T>
+void TestAutotune
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const std::string& filename, const Grid& g )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing ",OrientationToChar(orientA),
+     OrientationToChar(orientB)," with ",TypeName<T>());
+    ClearGemmTuning();
+    EnableGemmAutotuning();
+
+    DistMatrix<T> A(g), B(g), C(g), CRef(g);
+    if( orientA == NORMAL )
+        Uniform( A, m, k );
+    else
+        Uniform( A, k, m );
+    if( orientB == NORMAL )
+        Uniform( B, k, n );
+    else
+        Uniform( B, n, k );
+    Gemm( orientA, orientB, T(1), A, B, C );
+    Gemm( orientA, orientB, T(1), A, B, CRef, GEMM_SUMMA_C );
+    const Base<T> refNorm = FrobeniusNorm( CRef );
+    CRef -= C;
+    if( FrobeniusNorm(CRef) > 100*k*limits::Epsilon<Base<T>>()*refNorm )
+        LogicError("The autotuned product was incorrect");
+
+    GemmTuning tuning;
+    if( NumGemmTunings() != 1 ||
+        !LookupGemmTuning<T>( orientA, orientB, m, n, k, g, tuning ) )
+        LogicError("The class was not tuned");
+    OutputFromRoot
+    (g.Comm(),"  chose ",GemmAlgorithmToString(tuning.alg),
+     " with a blocksize of ",tuning.blocksize);
+
+    // Later calls within the class reuse the tuning
+    Gemm( orientA, orientB, T(1), A, B, C );
+    if( NumGemmTunings() != 1 )
+        LogicError("The class was tuned twice");
+
+    SaveGemmTuning( filename, g.Comm() );
+    mpi::Barrier( g.Comm() );
+    ClearGemmTuning();
+    LoadGemmTuning( filename, g.Comm() );
+    GemmTuning loaded;
+    if( !LookupGemmTuning<T>( orientA, orientB, m, n, k, g, loaded ) ||
+        loaded.alg != tuning.alg || loaded.blocksize != tuning.blocksize )
+        LogicError("The tuning was not restored from ",filename);
+
+    // A grid of the same shape but the opposite order is a different class
+    const Grid gFlip
+    ( g.Comm(), g.Height(),
+      g.Order() == COLUMN_MAJOR ? ROW_MAJOR : COLUMN_MAJOR );
+    if( LookupGemmTuning<T>( orientA, orientB, m, n, k, gFlip, loaded ) )
+        LogicError("The tuning was reused for a grid of the opposite order");
+
+    // TuneGemm records a class without a call
+    ClearGemmTuning();
+    TuneGemm<T>( orientA, orientB, 2*m, 2*n, k, g );
+    if( !LookupGemmTuning<T>( orientA, orientB, 2*m, 2*n, k, g, loaded ) )
+        LogicError("TuneGemm did not record the class");
+
+    EnableGemmAutotuning( false );
+    ClearGemmTuning();
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height of C",100);
+        const Int n = Input("--n","width of C",100);
+        const Int k = Input("--k","inner dimension",200);
+        const std::string filename =
+          Input("--filename","tuning file","GemmAutotune.txt");
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestAutotune<double>( NORMAL, NORMAL, m, n, k, filename, g );
+        TestAutotune<float>( NORMAL, TRANSPOSE, m, n, k, filename, g );
+        TestAutotune<Complex<double>>( ADJOINT, NORMAL, m, n, k, filename, g );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
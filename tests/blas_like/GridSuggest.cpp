@@ -0,0 +1,115 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The fastest of numReps runs of Gemm on the given grid
+template<typename T>
+double TimeGemm
+( Int m, Int n, Int k, GemmAlgorithm alg, const Grid& g, Int numReps )
+{
+    DistMatrix<T> A(g), B(g), C(g);
+    Uniform( A, m, k );
+    Uniform( B, k, n );
+    Zeros( C, m, n );
+    Timer timer;
+    double minTime = std::numeric_limits<double>::infinity();
+    for( Int rep=0; rep<numReps; ++rep )
+    {
+        mpi::Barrier( g.Comm() );
+        timer.Start();
+        Gemm( NORMAL, NORMAL, T(1), A, B, T(0), C, alg );
+        mpi::Barrier( g.Comm() );
+        minTime = Min( minTime, timer.Stop() );
+    }
+    mpi::Broadcast( minTime, 0, g.Comm() );
+    return minTime;
+}
+
+// Compare the suggested grid against an exhaustive search over every grid
+// height and order (the suggestion is only reported against the best
+// measured grid since timings of oversubscribed runs are noisy)
+template<typename T>
+void TestSuggestion
+( Int m, Int n, Int k, GemmAlgorithm alg, Int numReps, mpi::Comm comm )
+{
+    OutputFromRoot
+    (comm,"Testing ",m," x ",n," x ",k," Gemm with ",TypeName<T>());
+    const int commSize = mpi::Size( comm );
+    GridCostModel model;
+    model.entrySize = sizeof(T);
+    const GridSuggestion suggestion =
+      Grid::Suggest( comm, m, n, k, alg, model );
+    if( suggestion.height < 1 || commSize % suggestion.height != 0 )
+        LogicError("Suggested an invalid grid height of ",suggestion.height);
+    if( alg != GEMM_DEFAULT && suggestion.alg != alg )
+        LogicError("Suggestion changed the requested algorithm");
+
+    // Every process must arrive at the same suggestion
+    int height = suggestion.height;
+    mpi::Broadcast( height, 0, comm );
+    if( height != suggestion.height )
+        LogicError("Processes disagreed on the suggested grid height");
+
+    double bestTime = std::numeric_limits<double>::infinity();
+    double suggestedTime = bestTime;
+    int bestHeight = 0;
+    GridOrder bestOrder = COLUMN_MAJOR;
+    for( const GridOrder order : {COLUMN_MAJOR,ROW_MAJOR} )
+    {
+        for( int r=1; r<=commSize; ++r )
+        {
+            if( commSize % r != 0 )
+                continue;
+            const Grid g( comm, r, order );
+            const double time =
+              TimeGemm<T>( m, n, k, suggestion.alg, g, numReps );
+            if( time < bestTime )
+            {
+                bestTime = time;
+                bestHeight = r;
+                bestOrder = order;
+            }
+            if( r == suggestion.height && order == suggestion.order )
+                suggestedTime = time;
+        }
+    }
+    OutputFromRoot
+    (comm,"  suggested ",suggestion.height," x ",commSize/suggestion.height,
+     " ",suggestion.order==COLUMN_MAJOR ? "column-major" : "row-major",
+     " grid took ",suggestedTime," seconds (predicted ",suggestion.cost,
+     "); best was ",bestHeight," x ",commSize/bestHeight," ",
+     bestOrder==COLUMN_MAJOR ? "column-major" : "row-major",
+     " with ",bestTime," seconds");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height of C",200);
+        const Int n = Input("--n","width of C",200);
+        const Int k = Input("--k","inner dimension",200);
+        const Int numReps = Input("--numReps","timing repetitions",3);
+        ProcessInput();
+        PrintInputReport();
+
+        TestSuggestion<double>( m, n, k, GEMM_DEFAULT, numReps, comm );
+        TestSuggestion<double>( 4*m, n/4+1, k, GEMM_DEFAULT, numReps, comm );
+        TestSuggestion<double>( m, 4*n, k/4+1, GEMM_SUMMA_C, numReps, comm );
+        TestSuggestion<float>( m, n, 4*k, GEMM_SUMMA_A, numReps, comm );
+        OutputFromRoot(comm,"Grid suggestion tests passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
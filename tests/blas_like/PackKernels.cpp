@@ -0,0 +1,186 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+vector<T> RandomBuffer( Int size )
+{
+    vector<T> buffer(size);
+    for( auto& alpha : buffer )
+        alpha = SampleUniform<T>();
+    return buffer;
+}
+
+template<typename T>
+void CheckEqual
+( const vector<T>& A, const vector<T>& B, const std::string& name )
+{
+    for( size_t k=0; k<A.size(); ++k )
+        if( A[k] != B[k] )
+            LogicError(name," mismatch at position ",k);
+}
+
+template<typename T>
+void TestInterleave( Int m, Int n, Int colStrideA, Int colStrideB )
+{
+    const Int ldA = colStrideA*m + 1;
+    const Int ldB = colStrideB*m + 3;
+    const auto A = RandomBuffer<T>( ldA*n );
+    auto B = RandomBuffer<T>( ldB*n );
+    auto BRef = B;
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            BRef[i*colStrideB+j*ldB] = A[i*colStrideA+j*ldA];
+    copy::util::InterleaveMatrix<T,Device::CPU>
+    ( m, n, A.data(), colStrideA, ldA, B.data(), colStrideB, ldB );
+    CheckEqual( B, BRef, "InterleaveMatrix" );
+
+    const T alpha = SampleUniform<T>();
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            BRef[i*colStrideB+j*ldB] += alpha*A[i*colStrideA+j*ldA];
+    axpy::util::InterleaveMatrixUpdate<T,Device::CPU>
+    ( alpha, m, n, A.data(), colStrideA, ldA, B.data(), colStrideB, ldB );
+    CheckEqual( B, BRef, "InterleaveMatrixUpdate" );
+}
+
+template<typename T>
+void TestRowStrided( Int m, Int n, Int rowAlign, Int rowStride )
+{
+    const Int ldA = m + 2;
+    const auto A = RandomBuffer<T>( ldA*n );
+    const Int portionSize = m*MaxLength( n, rowStride );
+    vector<T> portions( rowStride*portionSize, T(0) ), portionsRef( portions );
+    for( Int j=0; j<n; ++j )
+    {
+        const Int k = Mod( j+rowAlign, rowStride );
+        for( Int i=0; i<m; ++i )
+            portionsRef[k*portionSize+i+(j/rowStride)*m] = A[i+j*ldA];
+    }
+    copy::util::RowStridedPack<T,Device::CPU>
+    ( m, n, rowAlign, rowStride, A.data(), ldA, portions.data(), portionSize );
+    CheckEqual( portions, portionsRef, "RowStridedPack" );
+
+    vector<T> B( ldA*n, T(0) );
+    copy::util::RowStridedUnpack<T,Device::CPU>
+    ( m, n, rowAlign, rowStride, portions.data(), portionSize, B.data(), ldA );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( B[i+j*ldA] != A[i+j*ldA] )
+                LogicError("RowStridedUnpack mismatch at (",i,",",j,")");
+}
+
+template<typename T>
+void TestPartialColStrided( Int m, Int colAlign, Int colStride, Int part )
+{
+    // A column distributed over colStride/part processes, repacked into
+    // portions for each of the colStride/(colStride/part) = part processes
+    const Int colStridePart = colStride / part;
+    const Int colStrideUnion = part;
+    const Int colRankPart = 0;
+    const Int colShiftA = Shift( colRankPart, colAlign, colStridePart );
+    const Int localHeight = Length( m, colShiftA, colStridePart );
+    const auto A = RandomBuffer<T>( localHeight );
+    const Int portionSize = MaxLength( m, colStride );
+    vector<T> portions( colStrideUnion*portionSize, T(0) );
+    auto portionsRef = portions;
+    for( Int k=0; k<colStrideUnion; ++k )
+    {
+        const Int colShift =
+          Shift( colRankPart+k*colStridePart, colAlign, colStride );
+        const Int colOffset = (colShift-colShiftA) / colStridePart;
+        const Int portionHeight = Length( m, colShift, colStride );
+        for( Int i=0; i<portionHeight; ++i )
+            portionsRef[k*portionSize+i] = A[colOffset+i*colStrideUnion];
+    }
+    copy::util::PartialColStridedColumnPack
+    ( m, colAlign, colStride, colStrideUnion, colStridePart, colRankPart,
+      colShiftA, A.data(), portions.data(), portionSize );
+    CheckEqual( portions, portionsRef, "PartialColStridedColumnPack" );
+}
+
+// Report the bandwidth (counting both reads and writes) of the kernels
+// relative to that of a single memcpy of the same amount of data
+template<typename T>
+void Bandwidth( Int m, Int n, Int rowStride, Int numReps, mpi::Comm comm )
+{
+    const Int ldA = m + 8;
+    const auto A = RandomBuffer<T>( ldA*n );
+    vector<T> B( ldA*n );
+    const double gigabytes = 2.*m*n*sizeof(T) / 1.e9;
+    Timer timer;
+    auto report = [&]( const std::string& name, std::function<void()> f )
+    {
+        f();
+        timer.Start();
+        for( Int rep=0; rep<numReps; ++rep )
+            f();
+        const double bandwidth = numReps*gigabytes / timer.Stop();
+        OutputFromRoot(comm,"  ",name,": ",bandwidth," GB/s");
+    };
+
+    report
+    ("memcpy", [&]() { MemCopy( B.data(), A.data(), m*n ); });
+    report
+    ("InterleaveMatrix (unit stride)", [&]()
+     { copy::util::InterleaveMatrix<T,Device::CPU>
+       ( m, n, A.data(), 1, ldA, B.data(), 1, m ); });
+    report
+    ("InterleaveMatrix (stride 2)", [&]()
+     { copy::util::InterleaveMatrix<T,Device::CPU>
+       ( m/2, n, A.data(), 2, ldA, B.data(), 1, m/2 ); });
+    report
+    ("RowStridedPack", [&]()
+     { copy::util::RowStridedPack<T,Device::CPU>
+       ( m, n, 0, rowStride, A.data(), ldA,
+         B.data(), m*MaxLength(n,rowStride) ); });
+    report
+    ("InterleaveMatrixUpdate", [&]()
+     { axpy::util::InterleaveMatrixUpdate<T,Device::CPU>
+       ( T(1), m, n, A.data(), 1, ldA, B.data(), 1, m ); });
+}
+
+template<typename T>
+void TestPackKernels( Int m, Int n, Int numReps, mpi::Comm comm )
+{
+    OutputFromRoot(comm,"Testing pack kernels with ",TypeName<T>());
+    for( const Int colStrideA : {1,2,3,5} )
+        for( const Int colStrideB : {1,2,4,7} )
+            TestInterleave<T>( m, n, colStrideA, colStrideB );
+    for( const Int rowStride : {1,2,3,8} )
+        TestRowStrided<T>( m, n, 1 % rowStride, rowStride );
+    TestPartialColStrided<T>( m*n, 1, 6, 2 );
+    TestPartialColStrided<T>( m*n, 3, 8, 4 );
+    OutputFromRoot(comm,"passed");
+    if( numReps > 0 )
+        Bandwidth<T>( m, n, 4, numReps, comm );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height of matrix",500);
+        const Int n = Input("--n","width of matrix",300);
+        const Int numReps = Input("--numReps","timing repetitions",10);
+        ProcessInput();
+        PrintInputReport();
+
+        TestPackKernels<float>( m, n, numReps, comm );
+        TestPackKernels<double>( m, n, numReps, comm );
+        TestPackKernels<Complex<double>>( m, n, numReps, comm );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <thread>
+using namespace El;
+
+std::string ReadFile( const std::string& filename )
+{
+    std::ifstream file( filename );
+    if( !file.is_open() )
+        LogicError("Could not open ",filename);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+void CheckContains
+( const std::string& contents, const std::string& pattern,
+  const std::string& filename )
+{
+    if( contents.find(pattern) == std::string::npos )
+        LogicError(filename," does not contain ",pattern);
+}
+
+void Multiply( Int m, const Grid& g )
+{
+    DistMatrix<double> A(g), B(g), C(g);
+    Uniform( A, m, m );
+    Uniform( B, m, m );
+    Zeros( C, m, m );
+    Gemm( NORMAL, NORMAL, 1., A, B, 0., C, GEMM_SUMMA_A );
+}
+
+// Record calls from within a region of the calling thread
+void RecordCalls( const char* region, Int numCalls )
+{
+    mpi::ProfileRegion profileRegion( region );
+    for( Int call=0; call<numCalls; ++call )
+    {
+        const double time = mpi::Time();
+        mpi::RecordCall( "Threaded", MPI_COMM_NULL, 8, time, time );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    try
+    {
+        const Int m = Input("--m","size of matrices",100);
+        const std::string basename =
+          Input("--basename","basename of the profile","CommProfile");
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        const std::string rankFile =
+          basename + "." + std::to_string(commRank) + ".json";
+
+        // Nothing is recorded while profiling is disabled
+        mpi::ClearProfile();
+        Multiply( m, g );
+        mpi::WriteProfile( basename );
+        if( ReadFile(rankFile).find("\"op\"") != std::string::npos )
+            LogicError("Calls were recorded while profiling was disabled");
+
+        // The Gemm is attributed to its variant and the grid communicators
+        mpi::EnableProfiling();
+        Multiply( m, g );
+        mpi::DisableProfiling();
+        mpi::WriteProfile( basename );
+
+        const std::string rankProfile = ReadFile( rankFile );
+        CheckContains( rankProfile, "Gemm::SUMMA_NNA", rankFile );
+        if( mpi::Size(comm) > 1 )
+        {
+            CheckContains( rankProfile, "\"comm\": \"", rankFile );
+            CheckContains( rankProfile, ".MC\"", rankFile );
+        }
+        const std::string traceFile =
+          basename + "." + std::to_string(commRank) + ".trace.json";
+        const std::string trace = ReadFile( traceFile );
+        CheckContains( trace, "\"traceEvents\"", traceFile );
+        CheckContains( trace, "\"ph\": \"X\"", traceFile );
+        if( commRank == 0 )
+        {
+            const std::string reduced = ReadFile( basename+".json" );
+            CheckContains( reduced, "\"maxSeconds\"", basename+".json" );
+            CheckContains( reduced, "Gemm::SUMMA_NNA", basename+".json" );
+        }
+
+        // Concurrent threads tally into the same profile, but each within
+        // its own stack of regions
+        const Int numCalls = 1000;
+        mpi::ClearProfile();
+        mpi::EnableProfiling();
+        std::thread threadA( RecordCalls, "ThreadA", numCalls );
+        std::thread threadB( RecordCalls, "ThreadB", numCalls );
+        threadA.join();
+        threadB.join();
+        mpi::DisableProfiling();
+        mpi::WriteProfile( basename );
+        const std::string threadProfile = ReadFile( rankFile );
+        for( const std::string region : { "ThreadA", "ThreadB" } )
+            CheckContains
+            ( threadProfile,
+              "{\"region\": \""+region+"\", \"comm\": \"-\", "
+              "\"op\": \"Threaded\", \"bytesBucket\": \"[8,16)\", "
+              "\"count\": "+std::to_string(numCalls)+",", rankFile );
+
+        mpi::ClearProfile();
+        OutputFromRoot(comm,"Communication profile tests passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
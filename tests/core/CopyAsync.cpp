@@ -0,0 +1,100 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Start B := A asynchronously, perform some unrelated local work while
+// polling, and compare against the blocking redistribution
+template<typename T,Dist U,Dist V,Dist X,Dist Y>
+void TestCopyAsync( Int m, Int n, const Grid& g )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing [",DistToString(U),",",DistToString(V),"] -> [",
+     DistToString(X),",",DistToString(Y),"] with ",TypeName<T>());
+
+    DistMatrix<T,U,V> A(g);
+    Uniform( A, m, n );
+    DistMatrix<T,X,Y> B(g), BRef(g);
+    BRef = A;
+
+    Matrix<T> C, D;
+    Uniform( C, 100, 100 );
+    auto handle = CopyAsync( A, B );
+    Int numPolls = 0;
+    while( !handle.Test() )
+    {
+        Gemm( NORMAL, NORMAL, T(1), C, C, D );
+        ++numPolls;
+    }
+    if( !handle.Completed() )
+        LogicError("Handle was not marked as completed");
+
+    BRef -= B;
+    const Base<T> errorNorm = FrobeniusNorm( BRef );
+    if( errorNorm != Base<T>(0) )
+        LogicError("Asynchronous copy error norm was ",errorNorm);
+    OutputFromRoot(g.Comm(),"passed after ",numPolls," polls");
+}
+
+// Keep two copies over the same communicator outstanding at once and
+// complete them in the opposite order
+template<typename T>
+void TestConcurrentCopies( Int m, Int n, const Grid& g )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing concurrent copies with ",TypeName<T>());
+    DistMatrix<T> A0(g), A1(g);
+    Uniform( A0, m, n );
+    Uniform( A1, n, m );
+    DistMatrix<T,MC,STAR> B0(g), B1(g), BRef0(g), BRef1(g);
+    BRef0 = A0;
+    BRef1 = A1;
+
+    auto handle0 = CopyAsync( A0, B0 );
+    auto handle1 = CopyAsync( A1, B1 );
+    handle1.Wait();
+    handle0.Wait();
+
+    BRef0 -= B0;
+    BRef1 -= B1;
+    const Base<T> errorNorm = FrobeniusNorm( BRef0 ) + FrobeniusNorm( BRef1 );
+    if( errorNorm != Base<T>(0) )
+        LogicError("Concurrent asynchronous copy error norm was ",errorNorm);
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",100);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+
+        TestCopyAsync<double,MC,MR,MC,STAR>( m, n, g );
+        TestCopyAsync<float,MC,MR,STAR,MR>( m, n, g );
+        TestCopyAsync<Complex<double>,MC,MR,VC,STAR>( m, n, g );
+        TestCopyAsync<double,VC,STAR,MC,MR>( m, n, g );
+        TestCopyAsync<double,MR,MC,VR,STAR>( m, n, g );
+        TestCopyAsync<double,VR,STAR,MR,MC>( m, n, g );
+        // Falls back to the blocking redistribution
+        TestCopyAsync<double,MC,MR,STAR,STAR>( m, n, g );
+
+        TestConcurrentCopies<double>( m, n, g );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,106 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Ensure that the VR, MD, and MDPerp communicators agree with the ranks
+// which were computed from the grid's shape
+void CheckCommunicators( const Grid& g )
+{
+    if( !g.InGrid() )
+        return;
+    if( mpi::Rank(g.VRComm()) != g.VRRank() )
+        LogicError("VR rank mismatch");
+    if( mpi::Size(g.MDComm()) != g.MDSize() ||
+        mpi::Rank(g.MDComm()) != g.MDRank() )
+        LogicError("MD communicator mismatch");
+    if( mpi::Size(g.MDPerpComm()) != g.MDPerpSize() ||
+        mpi::Rank(g.MDPerpComm()) != g.MDPerpRank() )
+        LogicError("MDPerp communicator mismatch");
+    for( int vcRank=0; vcRank<g.Size(); ++vcRank )
+        if( g.VCToViewing(vcRank) !=
+            mpi::Translate( g.VCComm(), vcRank, g.ViewingComm() ) )
+            LogicError("VC to viewing rank map mismatch");
+}
+
+template<typename T>
+void TestRedistributions( Int m, Int n, const Grid& g )
+{
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    DistMatrix<T,STAR,STAR> A_STAR_STAR(g);
+    A_STAR_STAR = A;
+
+    DistMatrix<T,MD,STAR> A_MD_STAR(g);
+    DistMatrix<T,VR,STAR> A_VR_STAR(g);
+    A_MD_STAR = A;
+    A_VR_STAR = A;
+    DistMatrix<T,STAR,STAR> B(g);
+    B = A_MD_STAR;
+    B -= A_STAR_STAR;
+    if( FrobeniusNorm(B) != Base<T>(0) )
+        LogicError("[MD,* ] redistribution failed");
+    B = A_VR_STAR;
+    B -= A_STAR_STAR;
+    if( FrobeniusNorm(B) != Base<T>(0) )
+        LogicError("[VR,* ] redistribution failed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height of matrix",50);
+        const Int n = Input("--n","width of matrix",30);
+        const Int numGrids = Input("--numGrids","number of grid requests",20);
+        ProcessInput();
+        PrintInputReport();
+
+        const int commSize = mpi::Size( comm );
+        for( const GridOrder order : {COLUMN_MAJOR,ROW_MAJOR} )
+        {
+            for( int height=1; height<=commSize; ++height )
+            {
+                if( commSize % height != 0 )
+                    continue;
+                const Grid& g = Grid::Cached( comm, height, order );
+                if( &Grid::Cached( comm, height, order ) != &g )
+                    LogicError("Grid was not cached");
+                TestRedistributions<double>( m, n, g );
+                CheckCommunicators( g );
+            }
+        }
+
+        // Compare repeatedly constructing a grid against the cache
+        double startTime = Grid::ConstructionTime();
+        for( Int k=0; k<numGrids; ++k )
+        {
+            Grid g( comm );
+        }
+        const double uncachedTime = Grid::ConstructionTime() - startTime;
+        startTime = Grid::ConstructionTime();
+        const Int startHits = Grid::NumCacheHits();
+        for( Int k=0; k<numGrids; ++k )
+            Grid::Cached( comm );
+        const double cachedTime = Grid::ConstructionTime() - startTime;
+        if( Grid::NumCacheHits() - startHits < numGrids-1 )
+            LogicError("Grid cache missed");
+        OutputFromRoot
+        (comm,numGrids," grid constructions took ",uncachedTime,
+         " seconds versus ",cachedTime," seconds with the cache");
+        Grid::ClearCache();
+        OutputFromRoot(comm,"Grid cache tests passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,124 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the hierarchical collectives over the given communicator of the
+// grid against the flat ones (using integers so that the different orders of
+// summation lead to identical results)
+void TestCollectives
+( const std::string& name, mpi::Comm comm, const Grid& g, Int count )
+{
+    const mpi::NodeHierarchy* hierarchy = g.Hierarchy( comm );
+    if( hierarchy == nullptr )
+        LogicError("No node hierarchy for the ",name," communicator");
+    const int commSize = mpi::Size( comm );
+
+    vector<Int> sendBuf( commSize*count );
+    for( auto& alpha : sendBuf )
+        alpha = SampleUniform<Int>( -100, 100 );
+
+    vector<Int> recvBuf( commSize*count ), recvBufRef( commSize*count );
+    mpi::AllGather( sendBuf.data(), count, recvBuf.data(), count, *hierarchy );
+    mpi::AllGather( sendBuf.data(), count, recvBufRef.data(), count, comm );
+    if( recvBuf != recvBufRef )
+        LogicError("Hierarchical AllGather over ",name," failed");
+
+    mpi::AllReduce
+    ( sendBuf.data(), recvBuf.data(), commSize*count, mpi::SUM, *hierarchy );
+    mpi::AllReduce
+    ( sendBuf.data(), recvBufRef.data(), commSize*count, mpi::SUM, comm );
+    if( recvBuf != recvBufRef )
+        LogicError("Hierarchical AllReduce over ",name," failed");
+
+    recvBuf.resize( count );
+    recvBufRef.resize( count );
+    mpi::ReduceScatter
+    ( sendBuf.data(), recvBuf.data(), count, mpi::SUM, *hierarchy );
+    mpi::ReduceScatter
+    ( sendBuf.data(), recvBufRef.data(), count, mpi::SUM, comm );
+    if( recvBuf != recvBufRef )
+        LogicError("Hierarchical ReduceScatter over ",name," failed");
+}
+
+// Compare the redistributions which use the hierarchical collectives against
+// those performed with the flat collectives
+template<typename T>
+void TestRedistributions( Int m, Int n, Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing redistributions with ",TypeName<T>());
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    DistMatrix<T,MC,STAR> A_MC_STAR(g), A_MC_STARRef(g);
+    DistMatrix<T,STAR,MR> A_STAR_MR(g), A_STAR_MRRef(g);
+    DistMatrix<T> B(g), BRef(g);
+
+    g.SetHierarchicalCollectives( false );
+    A_MC_STARRef = A;
+    A_STAR_MRRef = A;
+    Zeros( BRef, m, n );
+    AxpyContract( T(1), A_MC_STARRef, BRef );
+    AxpyContract( T(1), A_STAR_MRRef, BRef );
+
+    g.SetHierarchicalCollectives( true );
+    A_MC_STAR = A;
+    A_STAR_MR = A;
+    Zeros( B, m, n );
+    AxpyContract( T(1), A_MC_STAR, B );
+    AxpyContract( T(1), A_STAR_MR, B );
+
+    A_MC_STAR -= A_MC_STARRef;
+    A_STAR_MR -= A_STAR_MRRef;
+    if( FrobeniusNorm(A_MC_STAR) != Base<T>(0) )
+        LogicError("[MC,* ] <- [MC,MR] mismatch");
+    if( FrobeniusNorm(A_STAR_MR) != Base<T>(0) )
+        LogicError("[* ,MR] <- [MC,MR] mismatch");
+
+    B -= BRef;
+    const Base<T> errorNorm = FrobeniusNorm( B );
+    const Base<T> tol = 10*limits::Epsilon<Base<T>>()*FrobeniusNorm( BRef );
+    if( errorNorm > tol )
+        LogicError("AxpyContract error norm was ",errorNorm);
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",100);
+        const Int count = Input("--count","entries per process",17);
+        ProcessInput();
+        PrintInputReport();
+
+        Grid g( comm );
+        OutputFromRoot
+        (comm,"Grid spans ",g.NumNodes()," node(s) with ",g.NodeSize(),
+         " process(es) on the root's node");
+        if( g.NodeLeaderComm() == mpi::COMM_NULL && g.NodeRank() == 0 )
+            LogicError("Node leader is missing from the leader communicator");
+
+        g.SetHierarchicalCollectives( true );
+        TestCollectives( "MC", g.MCComm(), g, count );
+        TestCollectives( "MR", g.MRComm(), g, count );
+        TestCollectives( "VC", g.VCComm(), g, count );
+        TestCollectives( "VR", g.VRComm(), g, count );
+        OutputFromRoot(comm,"Hierarchical collectives passed");
+
+        TestRedistributions<double>( m, n, g );
+        TestRedistributions<Complex<float>>( m, n, g );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,176 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Messages beyond the range of an int cannot be afforded in a test, so the
+// maximum message count is instead lowered so that the same derived
+// datatypes and pieces are used for messages of modest size
+
+template<typename T,Dist U,Dist V>
+void TestRedistribution( const DistMatrix<T>& A, Int maxCount )
+{
+    const Grid& g = A.Grid();
+    DistMatrix<T,U,V> BRef(g), B(g);
+    BRef = A;
+    mpi::SetMaxMessageCount( maxCount );
+    B = A;
+    mpi::SetMaxMessageCount( std::numeric_limits<int>::max() );
+    B -= BRef;
+    if( FrobeniusNorm(B) != Base<T>(0) )
+        LogicError
+        ("[",DistToString(U),",",DistToString(V),"] <- [MC,MR] differed "
+         "with a maximum message count of ",maxCount);
+}
+
+template<typename T>
+void TestCollectives( Int count, Int maxCount, mpi::Comm comm )
+{
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    auto value = []( int q, Int i ) { return T(q*10000+i); };
+    vector<T> sendBuf(count), recvBuf(count*commSize);
+    for( Int i=0; i<count; ++i )
+        sendBuf[i] = value( commRank, i );
+
+    mpi::SetMaxMessageCount( maxCount );
+
+    mpi::AllGather( sendBuf.data(), count, recvBuf.data(), count, comm );
+    for( int q=0; q<commSize; ++q )
+        for( Int i=0; i<count; ++i )
+            if( recvBuf[q*count+i] != value(q,i) )
+                LogicError("AllGather of ",count," entries failed");
+
+    vector<T> bcastBuf( sendBuf );
+    mpi::Broadcast( bcastBuf.data(), count, 0, comm );
+    for( Int i=0; i<count; ++i )
+        if( bcastBuf[i] != value(0,i) )
+            LogicError("Broadcast of ",count," entries failed");
+
+    vector<T> sumBuf( sendBuf );
+    mpi::AllReduce( sumBuf.data(), count, mpi::SUM, comm );
+    for( Int i=0; i<count; ++i )
+    {
+        T sum = 0;
+        for( int q=0; q<commSize; ++q )
+            sum += value(q,i);
+        if( sumBuf[i] != sum )
+            LogicError("AllReduce of ",count," entries failed");
+    }
+
+    const int to = Mod( commRank+1, commSize );
+    const int from = Mod( commRank-1, commSize );
+    vector<T> shiftBuf( count );
+    mpi::SendRecv
+    ( sendBuf.data(), count, to, shiftBuf.data(), count, from, comm );
+    for( Int i=0; i<count; ++i )
+        if( shiftBuf[i] != value(from,i) )
+            LogicError("SendRecv of ",count," entries failed");
+
+    mpi::SetMaxMessageCount( std::numeric_limits<int>::max() );
+}
+
+// The variable-count collectives take Int counts and displacements, which
+// (with 64-bit integers) are exchanged point-to-point beyond the maximum
+// message count
+template<typename T>
+void TestVariableCollectives( Int count, Int maxCount, mpi::Comm comm )
+{
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    auto value =
+      []( int from, int to, Int i ) { return T(from*10000+to*100+i); };
+    const int root = commSize-1;
+
+    // Process q contributes count+q entries to every process
+    vector<Int> counts(commSize), displs;
+    for( int q=0; q<commSize; ++q )
+        counts[q] = count+q;
+    const Int totalRecv = Scan( counts, displs );
+    const Int sendCount = counts[commRank];
+
+    mpi::SetMaxMessageCount( maxCount );
+
+    vector<T> sendBuf(sendCount), recvBuf(totalRecv);
+    for( Int i=0; i<sendCount; ++i )
+        sendBuf[i] = value( commRank, 0, i );
+    mpi::Gather
+    ( sendBuf.data(), sendCount, recvBuf.data(), counts.data(), displs.data(),
+      root, comm );
+    if( commRank == root )
+        for( int q=0; q<commSize; ++q )
+            for( Int i=0; i<counts[q]; ++i )
+                if( recvBuf[displs[q]+i] != value(q,0,i) )
+                    LogicError("Gather of ",count,"+ entries failed");
+
+    mpi::AllGather
+    ( sendBuf.data(), sendCount, recvBuf.data(), counts.data(), displs.data(),
+      comm );
+    for( int q=0; q<commSize; ++q )
+        for( Int i=0; i<counts[q]; ++i )
+            if( recvBuf[displs[q]+i] != value(q,0,i) )
+                LogicError("AllGather of ",count,"+ entries failed");
+
+    // Process q sends count+q entries to every process
+    vector<Int> sendCounts(commSize,sendCount), sendDispls;
+    const Int totalSend = Scan( sendCounts, sendDispls );
+    sendBuf.resize( totalSend );
+    for( int q=0; q<commSize; ++q )
+        for( Int i=0; i<sendCount; ++i )
+            sendBuf[sendDispls[q]+i] = value( commRank, q, i );
+    mpi::AllToAll
+    ( sendBuf.data(), sendCounts.data(), sendDispls.data(),
+      recvBuf.data(), counts.data(), displs.data(), comm );
+    for( int q=0; q<commSize; ++q )
+        for( Int i=0; i<counts[q]; ++i )
+            if( recvBuf[displs[q]+i] != value(q,commRank,i) )
+                LogicError("AllToAll of ",count,"+ entries failed");
+
+    mpi::SetMaxMessageCount( std::numeric_limits<int>::max() );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",70);
+        const Int maxCount = Input("--maxCount","maximum message count",7);
+        ProcessInput();
+        PrintInputReport();
+
+        for( const Int count : {Int(0),Int(1),maxCount,2*maxCount,
+                                5*maxCount+3} )
+        {
+            TestCollectives<double>( count, maxCount, comm );
+            TestCollectives<Complex<float>>( count, maxCount, comm );
+            TestCollectives<Int>( count, maxCount, comm );
+            TestVariableCollectives<double>( count, maxCount, comm );
+            TestVariableCollectives<Complex<float>>( count, maxCount, comm );
+            TestVariableCollectives<Int>( count, maxCount, comm );
+        }
+        OutputFromRoot(comm,"Collectives passed");
+
+        const Grid g( comm );
+        DistMatrix<Complex<double>> A(g);
+        Uniform( A, m, n );
+        TestRedistribution<Complex<double>,STAR,STAR>( A, maxCount );
+        TestRedistribution<Complex<double>,MC,STAR>( A, maxCount );
+        TestRedistribution<Complex<double>,STAR,MR>( A, maxCount );
+        TestRedistribution<Complex<double>,MR,MC>( A, maxCount );
+        TestRedistribution<Complex<double>,VC,STAR>( A, maxCount );
+        OutputFromRoot(comm,"Redistributions passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -38,6 +38,42 @@ void TestMatrix( Int m, Int n, Int ldim )
     Output("passed");
 }
 
+template<typename T>
+void TestReserve( Int m, Int n )
+{
+    Output("Testing capacity management with ",TypeName<T>());
+
+    Matrix<T> A( m, 1 );
+    for( Int i=0; i<m; ++i )
+        A(i,0) = T(i);
+    A.Reserve( m*n );
+    if( A.Capacity() < m*n )
+        LogicError("Reserve did not increase the capacity");
+    for( Int i=0; i<m; ++i )
+        if( A.Get(i,0) != T(i) )
+            LogicError("Reserve did not preserve the contents");
+
+    // Growing column-by-column within the reservation must not reallocate
+    const T* buffer = A.LockedBuffer();
+    for( Int j=2; j<=n; ++j )
+    {
+        A.Resize( m, j );
+        if( A.LockedBuffer() != buffer )
+            LogicError("Resize within the capacity reallocated");
+    }
+    if( A.Get(m-1,0) != T(m-1) )
+        LogicError("Growing within the capacity lost the first column");
+
+    A.Resize( m, 1 );
+    A.ShrinkToFit();
+    if( A.Capacity() != m )
+        LogicError("ShrinkToFit left a capacity of ",A.Capacity());
+    if( A.Get(m-1,0) != T(m-1) )
+        LogicError("ShrinkToFit did not preserve the contents");
+
+    Output("passed");
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -58,6 +94,9 @@ main( int argc, char* argv[] )
             TestMatrix<double>( m, n, ldim );
             TestMatrix<Complex<double>>( m, n, ldim );
 
+            TestReserve<float>( m, n );
+            TestReserve<Complex<double>>( m, n );
+
 #ifdef EL_HAVE_QD
             TestMatrix<DoubleDouble>( m, n, ldim );
             TestMatrix<QuadDouble>( m, n, ldim );
@@ -0,0 +1,163 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void TestRecycling( Int m, Int n )
+{
+    Output("Testing recycling with ",TypeName<T>());
+    auto& pool = HostMemoryPool();
+    pool.ResetStatistics();
+
+    Memory<T> memory( m*n, 2 );
+    const auto address = reinterpret_cast<std::uintptr_t>(memory.Buffer());
+    if( address % CPUMemoryPool::Alignment != 0 )
+        LogicError("Pooled buffer was not aligned");
+    memory.Empty();
+
+    Matrix<T> A;
+    A.SetMemoryMode( 2 );
+    A.Resize( m, n );
+    if( A.Buffer() != reinterpret_cast<T*>(address) )
+        LogicError("Pooled buffer was not recycled");
+
+    const auto stats = pool.Statistics();
+    if( stats.hits != 1 || stats.misses != 1 )
+        LogicError
+        ("Expected one hit and one miss but found ",stats.hits," and ",
+         stats.misses);
+    Output("passed");
+}
+
+template<typename T>
+void TestSteadyStateGemm( Int m, Int n, Int k, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing steady-state Gemm with ",TypeName<T>());
+    auto& pool = HostMemoryPool();
+    const unsigned int oldMode = DefaultMemoryMode<Device::CPU>();
+    SetDefaultMemoryMode<Device::CPU>( 2 );
+    {
+        DistMatrix<T> A(g), B(g), C(g);
+        Uniform( A, m, k );
+        Uniform( B, k, n );
+        Zeros( C, m, n );
+
+        Gemm( NORMAL, NORMAL, T(1), A, B, T(0), C );
+        pool.ResetStatistics();
+        Gemm( NORMAL, NORMAL, T(1), A, B, T(0), C );
+        const auto stats = pool.Statistics();
+        if( stats.misses != 0 )
+            LogicError
+            ("Repeated Gemm performed ",stats.misses," fresh allocations");
+        OutputFromRoot
+        (g.Comm(),"  ",stats.hits," pool hits, ",stats.misses," misses");
+    }
+    SetDefaultMemoryMode<Device::CPU>( oldMode );
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+template<typename T>
+void TestScratchArena( Int m, Int n )
+{
+    Output("Testing scratch arena with ",TypeName<T>());
+    auto& arena = ThreadScratchArena();
+    ReserveScratchArena( 2*m*n*sizeof(T) );
+    if( arena.Capacity() < 2*m*n*sizeof(T) )
+        LogicError("Scratch arena was not pre-sized");
+    const size_t numFallbacks = arena.NumFallbacks();
+
+    T* firstBuffer;
+    {
+        simple_buffer<T,Device::CPU> send(m*n), recv(m*n, T(0));
+        firstBuffer = send.data();
+        if( reinterpret_cast<std::uintptr_t>(send.data()) %
+            ScratchArena::Alignment != 0 )
+            LogicError("Scratch buffer was not aligned");
+        for( Int i=0; i<m*n; ++i )
+            if( recv.data()[i] != T(0) )
+                LogicError("Scratch buffer was not filled");
+        if( arena.Used() == 0 )
+            LogicError("Scratch buffers did not come from the arena");
+    }
+    if( arena.Used() != 0 )
+        LogicError("Scratch arena was not drained");
+    {
+        simple_buffer<T,Device::CPU> send(m*n);
+        if( send.data() != firstBuffer )
+            LogicError("Scratch arena did not reuse its block");
+    }
+    if( arena.NumFallbacks() != numFallbacks )
+        LogicError("Scratch arena unexpectedly fell back to the heap");
+    Output("passed");
+}
+
+template<typename T>
+void TestFirstTouch( Int m, Int n )
+{
+    Output("Testing first-touch memory with ",TypeName<T>());
+    const size_t oldThreshold = FirstTouchThreshold();
+    SetFirstTouchThreshold( m*n*sizeof(T) );
+
+    Memory<T> large( m*n, 3 );
+    const auto address = reinterpret_cast<std::uintptr_t>(large.Buffer());
+    if( address % (size_t(1) << 21) != 0 )
+        LogicError("First-touch buffer was not huge-page aligned");
+    for( Int i=0; i<m*n; ++i )
+        large.Buffer()[i] = T(i);
+    large.Empty();
+
+    auto& pool = HostMemoryPool();
+    pool.ResetStatistics();
+    Memory<T> small( m*n-1, 3 );
+    const auto stats = pool.Statistics();
+    if( stats.hits + stats.misses == 0 )
+        LogicError("Small mode 3 buffer did not come from the pool");
+
+    SetFirstTouchThreshold( oldThreshold );
+    Output("passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",100);
+        const Int k = Input("--k","inner dimension",100);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
+        ProcessInput();
+        PrintInputReport();
+
+        SetBlocksize( nb );
+        const Grid g( comm );
+
+        if( mpi::Rank(comm) == 0 )
+        {
+            TestRecycling<float>( m, n );
+            TestRecycling<Complex<double>>( m, n );
+
+            TestScratchArena<float>( m, n );
+            TestScratchArena<Complex<double>>( m, n );
+
+            TestFirstTouch<double>( m, n );
+            TestFirstTouch<Complex<double>>( m, n );
+        }
+
+        TestSteadyStateGemm<float>( m, n, k, g );
+        TestSteadyStateGemm<double>( m, n, k, g );
+        TestSteadyStateGemm<Complex<double>>( m, n, k, g );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,139 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckEqual
+( const DistMatrix<T,STAR,STAR>& A, const DistMatrix<T,STAR,STAR>& B,
+  const std::string& name )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError(name," produced the wrong size");
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( A.GetLocal(i,j) != B.GetLocal(i,j) )
+                LogicError(name," mismatch at (",i,",",j,")");
+}
+
+// Compare redistributions into a node-shared [* ,* ] matrix against those
+// into a private one
+template<typename T,Dist U,Dist V>
+void TestRedistribution( const DistMatrix<T>& A, DistMatrix<T,STAR,STAR>& B )
+{
+    const Grid& g = A.Grid();
+    DistMatrix<T,U,V> AUV(g);
+    AUV = A;
+    DistMatrix<T,STAR,STAR> BRef(g);
+    BRef = AUV;
+    B = AUV;
+    CheckEqual( B, BRef, DistToString(U)+","+DistToString(V) );
+}
+
+template<typename T>
+void TestNodeShared( Int m, Int n, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing node-shared [* ,* ] with ",TypeName<T>());
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+
+    // Enabling and disabling the node-shared storage preserves the contents
+    DistMatrix<T,STAR,STAR> B(g), BRef(g);
+    BRef = A;
+    B = A;
+    B.SetNodeShared( true );
+    if( !B.NodeShared() )
+        LogicError("Storage was not node-shared");
+    CheckEqual( B, BRef, "SetNodeShared(true)" );
+
+    TestRedistribution<T,MC,MR>( A, B );
+    TestRedistribution<T,MR,MC>( A, B );
+    TestRedistribution<T,MC,STAR>( A, B );
+    TestRedistribution<T,STAR,MR>( A, B );
+    TestRedistribution<T,VC,STAR>( A, B );
+    TestRedistribution<T,STAR,VR>( A, B );
+    TestRedistribution<T,MR,STAR>( A, B );
+    TestRedistribution<T,STAR,MC>( A, B );
+    TestRedistribution<T,VR,STAR>( A, B );
+    TestRedistribution<T,STAR,VC>( A, B );
+    TestRedistribution<T,MD,STAR>( A, B );
+    TestRedistribution<T,STAR,MD>( A, B );
+    TestRedistribution<T,CIRC,CIRC>( A, B );
+
+    // Asynchronous copies fall back to the leader-only redistributions
+    {
+        DistMatrix<T,STAR,MR> AStarMR(g);
+        AStarMR = A;
+        DistMatrix<T,STAR,STAR> BAsync(g);
+        BAsync = AStarMR;
+        auto handle = CopyAsync( AStarMR, B );
+        handle.Wait();
+        CheckEqual( B, BAsync, "CopyAsync" );
+    }
+
+    // Zeroing is performed once per node
+    Zero( B );
+    Zeros( BRef, B.Height(), B.Width() );
+    CheckEqual( B, BRef, "Zero" );
+
+    // Growing the matrix reallocates the segment
+    DistMatrix<T> ALarge(g);
+    Uniform( ALarge, 2*m, n+1 );
+    TestRedistribution<T,MC,MR>( ALarge, B );
+
+    // Writes by the node leaders are seen by every process of their node
+    if( B.NodeLeader() )
+        B.SetLocal( 0, 0, T(7) );
+    B.NodeBarrier();
+    if( B.GetLocal(0,0) != T(7) )
+        LogicError("Write by the node leader was not visible");
+
+    // Queued updates are applied once to each node's copy
+    {
+        const int rank = mpi::Rank( g.Comm() );
+        DistMatrix<T,STAR,STAR> BQueued(g);
+        BQueued = B;
+        for( Int j=0; j<B.Width(); ++j )
+        {
+            B.QueueUpdate( rank % B.Height(), j, T(j+1) );
+            BQueued.QueueUpdate( rank % B.Height(), j, T(j+1) );
+        }
+        B.ProcessQueues();
+        BQueued.ProcessQueues();
+        CheckEqual( B, BQueued, "ProcessQueues" );
+    }
+
+    DistMatrix<T,STAR,STAR> C(g);
+    C = B;
+    B.SetNodeShared( false );
+    CheckEqual( B, C, "SetNodeShared(false)" );
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height of matrix",50);
+        const Int n = Input("--n","width of matrix",40);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestNodeShared<double>( m, n, g );
+        TestNodeShared<Complex<float>>( m, n, g );
+        TestNodeShared<Int>( m, n, g );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Start each nonblocking collective, poke the progress engine between the
+// blocks of some unrelated local work, and compare against the blocking
+// version of the collective
+template<typename T>
+void TestCollectives( Int count, Int numWorkBlocks, mpi::Comm comm )
+{
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    OutputFromRoot
+    (comm,"Testing ",TypeName<T>()," with ",count," entries");
+    vector<T> sendBuf( count*commSize );
+    for( Int i=0; i<count*commSize; ++i )
+        sendBuf[i] = T(commRank*1000+i);
+
+    auto overlap = [&]( mpi::Request<T>& request )
+    {
+        Matrix<T> A, B;
+        Uniform( A, 20, 20 );
+        for( Int block=0; block<numWorkBlocks; ++block )
+        {
+            Gemm( NORMAL, NORMAL, T(1), A, A, B );
+            mpi::Progress();
+        }
+        mpi::Wait( request );
+    };
+
+    mpi::Request<T> request;
+    vector<T> recvBuf( count*commSize ), recvBufRef( count*commSize );
+    mpi::IAllGather
+    ( sendBuf.data(), count, recvBuf.data(), count, comm, request );
+    overlap( request );
+    mpi::AllGather
+    ( sendBuf.data(), count, recvBufRef.data(), count, comm );
+    if( recvBuf != recvBufRef )
+        LogicError("IAllGather failed");
+
+    mpi::IAllToAll
+    ( sendBuf.data(), count, recvBuf.data(), count, comm, request );
+    overlap( request );
+    mpi::AllToAll
+    ( sendBuf.data(), count, recvBufRef.data(), count, comm );
+    if( recvBuf != recvBufRef )
+        LogicError("IAllToAll failed");
+
+    recvBuf.resize( count );
+    recvBufRef.resize( count );
+    mpi::IAllReduce
+    ( sendBuf.data(), recvBuf.data(), count, mpi::SUM, comm, request );
+    overlap( request );
+    mpi::AllReduce
+    ( sendBuf.data(), recvBufRef.data(), count, mpi::SUM, comm );
+    if( recvBuf != recvBufRef )
+        LogicError("IAllReduce failed");
+
+    vector<T> sumBuf( sendBuf.begin(), sendBuf.begin()+count );
+    mpi::IAllReduce( sumBuf.data(), count, mpi::SUM, comm, request );
+    overlap( request );
+    if( sumBuf != recvBufRef )
+        LogicError("In-place IAllReduce failed");
+
+    mpi::IReduceScatter
+    ( sendBuf.data(), recvBuf.data(), count, mpi::SUM, comm, request );
+    overlap( request );
+    mpi::ReduceScatter
+    ( sendBuf.data(), recvBufRef.data(), count, mpi::SUM, comm );
+    if( recvBuf != recvBufRef )
+        LogicError("IReduceScatter failed");
+
+    OutputFromRoot(comm,"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int count = Input("--count","entries per process",1000);
+        const Int numWorkBlocks =
+          Input("--numWorkBlocks","blocks of overlapped work",10);
+        const bool progressThread =
+          Input("--progressThread","use a progress thread?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( progressThread && !mpi::StartProgressThread() )
+            OutputFromRoot
+            (comm,"MPI_THREAD_MULTIPLE is unavailable, so not using a "
+             "progress thread");
+
+        for( const Int n : {Int(0),Int(1),count} )
+        {
+            TestCollectives<float>( n, numWorkBlocks, comm );
+            TestCollectives<double>( n, numWorkBlocks, comm );
+            TestCollectives<Complex<double>>( n, numWorkBlocks, comm );
+        }
+
+        // Pretend that the messages are too large for an int count so that
+        // the derived datatypes and the reductions in pieces are exercised
+        mpi::SetMaxMessageCount( 7 );
+        TestCollectives<double>( count, numWorkBlocks, comm );
+        TestCollectives<Complex<double>>( count, numWorkBlocks, comm );
+        mpi::SetMaxMessageCount( std::numeric_limits<int>::max() );
+
+        mpi::StopProgressThread();
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Every process queues several updates to every entry of the matrix, so
+// that each entry receives numDuplicates*commSize updates (many of which are
+// duplicates from the same process that should be combined before sending)
+template<typename T,Dist U,Dist V>
+void TestDuplicateUpdates
+( Int m, Int n, Int numDuplicates, Int flushThreshold, Int maxPendingBytes,
+  const Grid& g )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing [",DistToString(U),",",DistToString(V),
+     "] queued updates with ",TypeName<T>(),
+     (flushThreshold > 0 ? " (streaming)" : ""));
+    const Int commSize = mpi::Size( g.Comm() );
+
+    DistMatrix<T,U,V> A(g);
+    Zeros( A, m, n );
+    if( flushThreshold > 0 )
+    {
+        // The stream follows the matrix through a move assignment
+        DistMatrix<T,U,V> AStream(g);
+        Zeros( AStream, m, n );
+        AStream.SetRemoteUpdateFlushThreshold
+        ( flushThreshold, maxPendingBytes );
+        A = std::move( AStream );
+        if( A.RemoteUpdateFlushThreshold() != flushThreshold )
+            LogicError("The stream was not moved");
+    }
+    else
+        A.Reserve( numDuplicates*m*n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            for( Int k=0; k<numDuplicates; ++k )
+                A.QueueUpdate( i, j, T(j+1) );
+    A.ProcessQueues();
+    if( flushThreshold > 0 )
+        A.SetRemoteUpdateFlushThreshold( 0 );
+
+    DistMatrix<T,U,V> E(g);
+    Zeros( E, m, n );
+    for( Int jLoc=0; jLoc<E.LocalWidth(); ++jLoc )
+    {
+        const Int j = E.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<E.LocalHeight(); ++iLoc )
+            E.SetLocal( iLoc, jLoc, T(numDuplicates*commSize*(j+1)) );
+    }
+    E -= A;
+    const Base<T> errorNorm = FrobeniusNorm( E );
+    if( errorNorm != Base<T>(0) )
+        LogicError("Queued update error norm was ",errorNorm);
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height of matrix",50);
+        const Int n = Input("--n","width of matrix",50);
+        const Int numDuplicates =
+          Input("--numDuplicates","duplicates per process and entry",3);
+        const Int flushThreshold =
+          Input("--flushThreshold","queued updates per streamed flush",100);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+
+        // Process everything at once, stream in bounded batches, and then
+        // stream with so few bytes allowed in flight that most flushes are
+        // deferred
+        const Int thresholds[3] = { 0, flushThreshold, flushThreshold };
+        const Int byteLimits[3] = { 0, Int(1)<<26, 1 };
+        for( Int test=0; test<3; ++test )
+        {
+            const Int threshold = thresholds[test];
+            const Int byteLimit = byteLimits[test];
+            TestDuplicateUpdates<double,MC,MR>
+            ( m, n, numDuplicates, threshold, byteLimit, g );
+            TestDuplicateUpdates<float,MC,STAR>
+            ( m, n, numDuplicates, threshold, byteLimit, g );
+            TestDuplicateUpdates<Complex<double>,STAR,VR>
+            ( m, n, numDuplicates, threshold, byteLimit, g );
+            TestDuplicateUpdates<double,STAR,STAR>
+            ( m, n, numDuplicates, threshold, byteLimit, g );
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Redistribute an elemental matrix into a block distribution (which goes
+// through the general-purpose redistribution) and back, checking both the
+// result and that the repetitions reuse the cached plans
+template<typename T,Dist U,Dist V>
+void TestPlanReuse( Int m, Int n, Int numReps, const Grid& g )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing [",DistToString(U),",",DistToString(V),
+     "] plan reuse with ",TypeName<T>());
+    auto& plans = RedistributionPlans();
+
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    DistMatrix<T,STAR,STAR> AFull( A );
+
+    DistMatrix<T,U,V,BLOCK> B(g);
+    DistMatrix<T,STAR,STAR> BFull(g);
+    plans.ResetStatistics();
+    for( Int rep=0; rep<numReps; ++rep )
+    {
+        B = A;
+        BFull = B;
+    }
+    const auto stats = plans.Statistics();
+
+    Axpy( T(-1), AFull, BFull );
+    const Base<T> errorNorm = FrobeniusNorm( BFull );
+    if( errorNorm != Base<T>(0) )
+        LogicError("Redistribution error norm was ",errorNorm);
+    // Single-process grids bypass the general-purpose redistribution
+    if( g.Size() > 1 &&
+        (stats.misses > 2 || Int(stats.hits) < 2*(numReps-1)) )
+        LogicError
+        ("Expected at most two misses and at least ",2*(numReps-1),
+         " hits but found ",stats.misses," and ",stats.hits);
+    OutputFromRoot
+    (g.Comm(),"  ",stats.hits," plan hits, ",stats.misses," misses");
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+// Force many rounds of the value-only exchange
+template<typename T>
+void TestChunking( Int m, Int n, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing chunked exchange with ",TypeName<T>());
+    const Int oldChunkSize = RedistributionChunkSize();
+    SetRedistributionChunkSize( Max(m/7,Int(1)) );
+
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    DistMatrix<T,STAR,STAR> AFull( A );
+    DistMatrix<T,VR,STAR,BLOCK> B(g);
+    B = A;
+    DistMatrix<T,STAR,STAR> BFull(g);
+    BFull = B;
+
+    Axpy( T(-1), AFull, BFull );
+    const Base<T> errorNorm = FrobeniusNorm( BFull );
+    if( errorNorm != Base<T>(0) )
+        LogicError("Chunked redistribution error norm was ",errorNorm);
+
+    SetRedistributionChunkSize( oldChunkSize );
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+template<typename T>
+void TestGridInvalidation( Int m, Int n, mpi::Comm comm )
+{
+    OutputFromRoot(comm,"Testing plan invalidation with ",TypeName<T>());
+    auto& plans = RedistributionPlans();
+    plans.Clear();
+    {
+        const Grid g( comm );
+        DistMatrix<T> A(g);
+        DistMatrix<T,MC,MR,BLOCK> B(g);
+        Uniform( A, m, n );
+        B = A;
+        if( g.Size() > 1 && plans.Statistics().numPlans == 0 )
+            LogicError("No redistribution plan was cached");
+    }
+    if( plans.Statistics().numPlans != 0 )
+        LogicError("Destroying the grid did not invalidate its plans");
+    OutputFromRoot(comm,"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",100);
+        const Int numReps = Input("--numReps","number of repetitions",3);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+
+        TestPlanReuse<float,MC,MR>( m, n, numReps, g );
+        TestPlanReuse<double,VC,STAR>( m, n, numReps, g );
+        TestPlanReuse<Complex<double>,STAR,MR>( m, n, numReps, g );
+        TestPlanReuse<double,STAR,STAR>( m, n, numReps, g );
+
+        TestChunking<double>( m, n, g );
+        TestChunking<Complex<float>>( m, n, g );
+
+        TestGridInvalidation<double>( m, n, comm );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
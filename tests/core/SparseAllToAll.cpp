@@ -0,0 +1,108 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+const std::vector<std::pair<AllToAllAlgorithm,std::string>> algorithms =
+{ {ALLTOALL_NATIVE,"native"}, {ALLTOALL_PAIRWISE,"pairwise"},
+  {ALLTOALL_BRUCK,"Bruck"}, {ALLTOALL_SPARSE,"sparse"},
+  {ALLTOALL_DEFAULT,"adaptive"} };
+
+// Exchange up to maxCount entries with each of roughly density*p partners
+// using every algorithm, comparing against MPI_Alltoallv and reporting the
+// slowest process's time for each
+template<typename T>
+void TestAllToAll
+( double density, Int maxCount, Int numReps, mpi::Comm comm )
+{
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    OutputFromRoot
+    (comm,"Testing ",TypeName<T>()," with density ",density,
+     " and at most ",maxCount," entries per message");
+
+    vector<int> sendCounts(commSize), recvCounts(commSize);
+    for( int q=0; q<commSize; ++q )
+        if( q == commRank || SampleUniform<double>(0,1) < density )
+            sendCounts[q] = SampleUniform<Int>( 0, maxCount+1 );
+    mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+    vector<int> sendOffs, recvOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    const int totalRecv = Scan( recvCounts, recvOffs );
+
+    vector<T> sendBuf( totalSend );
+    for( auto& alpha : sendBuf )
+        alpha = SampleUniform<T>( T(-100), T(100) );
+    vector<T> recvBufRef( totalRecv );
+    mpi::SparseAllToAll
+    ( sendBuf, sendCounts, sendOffs, recvBufRef, recvCounts, recvOffs, comm,
+      ALLTOALL_NATIVE );
+
+    Timer timer;
+    for( const auto& algorithm : algorithms )
+    {
+        vector<T> recvBuf( totalRecv );
+        mpi::SparseAllToAll
+        ( sendBuf, sendCounts, sendOffs, recvBuf, recvCounts, recvOffs, comm,
+          algorithm.first );
+        if( recvBuf != recvBufRef )
+            LogicError("The ",algorithm.second," all-to-all failed");
+
+        mpi::Barrier( comm );
+        timer.Start();
+        for( Int rep=0; rep<numReps; ++rep )
+            mpi::SparseAllToAll
+            ( sendBuf, sendCounts, sendOffs, recvBuf, recvCounts, recvOffs,
+              comm, algorithm.first );
+        const double time =
+          mpi::AllReduce( timer.Stop(), mpi::MAX, comm ) / Max(numReps,1);
+        OutputFromRoot(comm,"  ",algorithm.second,": ",time," seconds");
+    }
+
+    // The all-to-all which also exchanges the counts
+    const AllToAllAlgorithm savedAlgorithm = mpi::GetAllToAllAlgorithm();
+    for( const auto& algorithm : algorithms )
+    {
+        mpi::SetAllToAllAlgorithm( algorithm.first );
+        const vector<T> recvBuf =
+          mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
+        if( recvBuf != recvBufRef )
+            LogicError
+            ("The ",algorithm.second," all-to-all with counts failed");
+    }
+    mpi::SetAllToAllAlgorithm( savedAlgorithm );
+    OutputFromRoot(comm,"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int smallCount = Input("--smallCount","small message size",4);
+        const Int largeCount =
+          Input("--largeCount","large message size",10000);
+        const Int numReps = Input("--numReps","timing repetitions",10);
+        ProcessInput();
+        PrintInputReport();
+
+        for( const double density : {0.1,0.5,1.} )
+        {
+            TestAllToAll<double>( density, smallCount, numReps, comm );
+            TestAllToAll<double>( density, largeCount, numReps, comm );
+        }
+        TestAllToAll<Complex<float>>( 1., smallCount, numReps, comm );
+        TestAllToAll<Int>( 0.5, largeCount, numReps, comm );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
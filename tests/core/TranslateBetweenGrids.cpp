@@ -0,0 +1,114 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Translate a matrix from one grid to another and back again, checking the
+// result on the second grid against a [* ,* ] copy on the first
+template<typename T,Dist U,Dist V>
+void TestTranslation
+( Int m, Int n, Int alignA, Int alignB, const Grid& gA, const Grid& gB )
+{
+    DistMatrix<T,U,V> A(gA);
+    if( V == STAR )
+        A.AlignCols( Mod(alignA,A.ColStride()) );
+    else
+        A.AlignRows( Mod(alignA,A.RowStride()) );
+    Uniform( A, m, n );
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+
+    DistMatrix<T,U,V> B(gB);
+    if( V == STAR )
+        B.AlignCols( Mod(alignB,B.ColStride()) );
+    else
+        B.AlignRows( Mod(alignB,B.RowStride()) );
+    B = A;
+    if( B.Participating() )
+    {
+        DistMatrix<T,STAR,STAR> B_STAR_STAR( B );
+        if( A_STAR_STAR.Participating() )
+        {
+            B_STAR_STAR.Matrix() -= A_STAR_STAR.Matrix();
+            if( FrobeniusNorm(B_STAR_STAR.Matrix()) != Base<T>(0) )
+                LogicError
+                ("[",DistToString(U),",",DistToString(V),
+                 "] translation failed");
+        }
+    }
+
+    DistMatrix<T,U,V> C(gA);
+    C = B;
+    C -= A;
+    if( FrobeniusNorm(C) != Base<T>(0) )
+        LogicError
+        ("[",DistToString(U),",",DistToString(V),"] translation back failed");
+}
+
+template<typename T>
+void TestTranslations( Int m, Int n, const Grid& gA, const Grid& gB )
+{
+    for( const Int alignA : {0,1} )
+    {
+        for( const Int alignB : {0,2} )
+        {
+            TestTranslation<T,VC,STAR>( m, n, alignA, alignB, gA, gB );
+            TestTranslation<T,VR,STAR>( m, n, alignA, alignB, gA, gB );
+            TestTranslation<T,STAR,VR>( m, n, alignA, alignB, gA, gB );
+            TestTranslation<T,STAR,VC>( m, n, alignA, alignB, gA, gB );
+            TestTranslation<T,MC,STAR>( m, n, alignA, alignB, gA, gB );
+            TestTranslation<T,MR,STAR>( m, n, alignA, alignB, gA, gB );
+            TestTranslation<T,STAR,MR>( m, n, alignA, alignB, gA, gB );
+            TestTranslation<T,STAR,MC>( m, n, alignA, alignB, gA, gB );
+        }
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commSize = mpi::Size( comm );
+    try
+    {
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",300);
+        const Int nb = Input("--nb","chunk width",32);
+        ProcessInput();
+        PrintInputReport();
+        SetBlocksize( nb );
+
+        // Translate between the full grid and grids over the leading
+        // subsets of its processes
+        mpi::Group group;
+        mpi::CommGroup( comm, group );
+        const Grid grid( comm );
+        for( int subSize=1; subSize<=commSize; ++subSize )
+        {
+            vector<int> subRanks( subSize );
+            for( int q=0; q<subSize; ++q )
+                subRanks[q] = q;
+            mpi::Group subGroup;
+            mpi::Incl( group, subSize, subRanks.data(), subGroup );
+            for( const GridOrder order : {COLUMN_MAJOR,ROW_MAJOR} )
+            {
+                const Grid subGrid
+                ( comm, subGroup, Grid::DefaultHeight(subSize), order );
+                TestTranslations<double>( m, n, grid, subGrid );
+                TestTranslations<Complex<float>>( n, m, subGrid, grid );
+            }
+            mpi::Free( subGroup );
+        }
+        mpi::Free( group );
+        OutputFromRoot(comm,"TranslateBetweenGrids tests passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,141 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+std::string PrecisionName( TransportPrecision precision )
+{
+    switch( precision )
+    {
+    case TRANSPORT_SINGLE: return "single";
+    case TRANSPORT_BFLOAT16: return "bfloat16";
+    default: return "full";
+    }
+}
+
+// The relative error introduced by shipping the matrix in the given
+// precision, and the rate (in GB/s of T) at which it is gathered
+template<typename T,Dist U,Dist V>
+void TestGather
+( const DistMatrix<T>& A, Grid& g, TransportPrecision precision,
+  Base<T> tol, Int numReps )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    DistMatrix<T,U,V> BRef(g), B(g);
+    Timer timer;
+    auto time = [&]( DistMatrix<T,U,V>& C )
+    {
+        C = A;
+        mpi::Barrier( g.Comm() );
+        timer.Start();
+        for( Int rep=0; rep<numReps; ++rep )
+            C = A;
+        mpi::Barrier( g.Comm() );
+        return timer.Stop() / Max(numReps,Int(1));
+    };
+    const double fullTime = time( BRef );
+    g.SetTransport( precision );
+    const double reducedTime = time( B );
+    g.SetTransport( TRANSPORT_FULL );
+
+    const Base<T> refNorm = FrobeniusNorm( BRef );
+    B -= BRef;
+    const Base<T> relError = FrobeniusNorm( B ) / refNorm;
+    const double gigabytes = double(m)*n*sizeof(T) / 1.e9;
+    OutputFromRoot
+    (g.Comm(),"  [",DistToString(U),",",DistToString(V),"] <- [MC,MR] in ",
+     PrecisionName(precision),": relative error ",relError,", ",
+     gigabytes/reducedTime," GB/s (versus ",gigabytes/fullTime,
+     " GB/s in full precision)");
+    if( relError > tol )
+        LogicError("Relative error of ",relError," exceeded ",tol);
+}
+
+template<typename T>
+void TestPrecision
+( Int m, Int n, Grid& g, TransportPrecision precision, Base<T> unitRoundoff,
+  Int numReps )
+{
+    OutputFromRoot(g.Comm(),"Testing ",TypeName<T>());
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    const Base<T> tol = 2*unitRoundoff;
+    TestGather<T,STAR,STAR>( A, g, precision, tol, numReps );
+    TestGather<T,MC,STAR>( A, g, precision, tol, numReps );
+    TestGather<T,STAR,MR>( A, g, precision, tol, numReps );
+
+    // The panels of the product travel in reduced precision while the
+    // local updates are accumulated in full precision
+    DistMatrix<T> B(g), C(g), CRef(g);
+    Uniform( B, n, m );
+    Gemm( NORMAL, NORMAL, T(1), A, B, CRef );
+    g.SetTransport( precision );
+    Gemm( NORMAL, NORMAL, T(1), A, B, C );
+    g.SetTransport( TRANSPORT_FULL );
+    const Base<T> refNorm = FrobeniusNorm( CRef );
+    C -= CRef;
+    const Base<T> relError = FrobeniusNorm( C ) / refNorm;
+    OutputFromRoot(g.Comm(),"  Gemm relative error: ",relError);
+    if( relError > n*tol )
+        LogicError("Gemm relative error of ",relError," exceeded ",n*tol);
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int m = Input("--m","height of matrix",500);
+        const Int n = Input("--n","width of matrix",300);
+        const Int numReps = Input("--numReps","timing repetitions",5);
+        ProcessInput();
+        PrintInputReport();
+
+        Grid g( comm );
+        const float singleRoundoff = limits::Epsilon<float>() / 2;
+        const float bfloat16Roundoff = 1.f / 256;
+        TestPrecision<double>
+        ( m, n, g, TRANSPORT_SINGLE, singleRoundoff, numReps );
+        TestPrecision<Complex<double>>
+        ( m, n, g, TRANSPORT_SINGLE, singleRoundoff, numReps );
+        TestPrecision<float>
+        ( m, n, g, TRANSPORT_BFLOAT16, bfloat16Roundoff, numReps );
+        TestPrecision<double>
+        ( m, n, g, TRANSPORT_BFLOAT16, bfloat16Roundoff, numReps );
+
+        // Other types are always shipped as they are
+        DistMatrix<Int> A(g);
+        Uniform( A, m, n, Int(0), Int(1000) );
+        DistMatrix<Int,STAR,STAR> B(g), BRef(g);
+        BRef = A;
+        g.SetTransport( TRANSPORT_SINGLE );
+        B = A;
+        g.SetTransport( TRANSPORT_FULL );
+        B -= BRef;
+        if( FrobeniusNorm(B) != Int(0) )
+            LogicError("Integer data was not shipped exactly");
+
+        // Single precision is already full precision for float
+        vector<float> sendBuf( n ), recvBuf( n*mpi::Size(comm) );
+        for( auto& alpha : sendBuf )
+            alpha = SampleUniform<float>();
+        mpi::AllGather
+        ( sendBuf.data(), n, recvBuf.data(), n, comm, TRANSPORT_SINGLE );
+        for( Int i=0; i<n; ++i )
+            if( recvBuf[i+mpi::Rank(comm)*n] != sendBuf[i] )
+                LogicError("float data was modified in single transport");
+        OutputFromRoot(comm,"Transport precision tests passed");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}